@@ -0,0 +1,691 @@
+/*
+ * Analog Filter Calculator - design library (libafc)
+ * Prototype tables/formulas and frequency denormalization shared by all
+ * calculators. Nothing in here allocates or prints.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <stdatomic.h>
+
+#include "afc.h"
+#include "afc_stats.h"
+#include "afc_tables.h"
+
+#define PI AFC_M_PI
+
+/*
+ * Chebyshev prototypes for the tabulated ripples come from afc_tables.h;
+ * other ripples and orders are memoized. Direct-mapped and fill-once: a slot is
+ * claimed with a CAS, filled, then published; a colliding key simply
+ * computes its prototype without caching. Readers never block, so batch
+ * workers can share the cache without locks.
+ */
+#define PROTO_CACHE_SLOTS 1024
+
+enum { SLOT_EMPTY = 0, SLOT_FILLING = 1, SLOT_READY = 2, SLOT_FAILED = 3 };
+
+typedef struct {
+    atomic_int state;
+    int order;
+    double ripple_dB;
+    double f3dB;
+    double g[AFC_MAX_ORDER + 1];
+} proto_slot;
+
+static proto_slot cheb_cache[PROTO_CACHE_SLOTS];
+
+static unsigned proto_hash(int order, double ripple_dB) {
+    uint64_t bits;
+    memcpy(&bits, &ripple_dB, sizeof bits);
+    bits ^= (uint64_t)order * 0x9E3779B97F4A7C15ull;
+    bits ^= bits >> 29;
+    bits *= 0xBF58476D1CE4E5B9ull;
+    bits ^= bits >> 32;
+    return (unsigned)(bits % PROTO_CACHE_SLOTS);
+}
+
+static void chebyshev_cached(int n, double ripple_dB, double *g, double *f3dB) {
+    if (n <= AFC_PROTO_TABLE_ORDER) {
+        for (int r = 0; r < AFC_CHEBYSHEV_TABLE_RIPPLES; r++) {
+            if (afc_chebyshev_ripple[r] == ripple_dB) {
+                memcpy(g, afc_chebyshev_g[r][n-1], (size_t)(n + 1) * sizeof *g);
+                *f3dB = afc_chebyshev_f3db[r][n-1];
+                return;
+            }
+        }
+    }
+
+    proto_slot *slot = &cheb_cache[proto_hash(n, ripple_dB)];
+    int state = atomic_load_explicit(&slot->state, memory_order_acquire);
+
+    if (state == SLOT_READY && slot->order == n && slot->ripple_dB == ripple_dB) {
+        memcpy(g, slot->g, (size_t)(n + 1) * sizeof *g);
+        *f3dB = slot->f3dB;
+        return;
+    }
+    afc_chebyshev_synthesize(n, ripple_dB, g, f3dB);
+    if (state == SLOT_EMPTY && atomic_compare_exchange_strong(&slot->state, &state, SLOT_FILLING)) {
+        slot->order = n;
+        slot->ripple_dB = ripple_dB;
+        slot->f3dB = *f3dB;
+        memcpy(slot->g, g, (size_t)(n + 1) * sizeof *g);
+        atomic_store_explicit(&slot->state, SLOT_READY, memory_order_release);
+    }
+}
+
+/*
+ * Bessel prototypes above the precomputed table are synthesized once per
+ * order and kept, using the same fill-once publication as the Chebyshev
+ * cache. Orders the synthesis cannot reach are remembered as failed, so
+ * order searches and sweeps do not retry them.
+ */
+static proto_slot bessel_cache[AFC_MAX_ORDER + 1];
+
+static int bessel_delay_g(int n, double *g, double *w3db) {
+    if (n <= AFC_BESSEL_TABLE_ORDER) {
+        memcpy(g, afc_bessel_delay_g[n-1], (size_t)(n + 1) * sizeof *g);
+        *w3db = afc_bessel_w3db[n-1];
+        return AFC_OK;
+    }
+
+    proto_slot *slot = &bessel_cache[n];
+    int state = atomic_load_explicit(&slot->state, memory_order_acquire);
+    if (state == SLOT_READY) {
+        memcpy(g, slot->g, (size_t)(n + 1) * sizeof *g);
+        *w3db = slot->f3dB;
+        return AFC_OK;
+    }
+    if (state == SLOT_FAILED)
+        return AFC_ERR_PRECISION;
+    int err = afc_bessel_synthesize(n, g, w3db);
+    if (err == AFC_ERR_PRECISION && state == SLOT_EMPTY)
+        atomic_compare_exchange_strong(&slot->state, &state, SLOT_FAILED);
+    if (err == AFC_OK && state == SLOT_EMPTY
+            && atomic_compare_exchange_strong(&slot->state, &state, SLOT_FILLING)) {
+        slot->order = n;
+        slot->f3dB = *w3db;
+        memcpy(slot->g, g, (size_t)(n + 1) * sizeof *g);
+        atomic_store_explicit(&slot->state, SLOT_READY, memory_order_release);
+    }
+    return err;
+}
+
+/*
+ * Elliptic prototypes, keyed by (order, ripple, stop-band loss), in the
+ * same fill-once slots with the tank capacitances alongside. A failed
+ * synthesis is cached too: it is as deterministic as a good one and takes
+ * as long.
+ */
+typedef struct {
+    atomic_int state;
+    int order, err;
+    double ripple_dB, stop_dB;
+    double f3dB;
+    double g[AFC_MAX_ORDER + 1], gz[AFC_MAX_ORDER + 1];
+} elliptic_slot;
+
+static elliptic_slot elliptic_cache[PROTO_CACHE_SLOTS];
+
+static int elliptic_cached(int n, double ripple_dB, double stop_dB, double *g, double *gz, double *f3dB) {
+    elliptic_slot *slot = &elliptic_cache[proto_hash(n, ripple_dB) ^ proto_hash(n, stop_dB)];
+    int state = atomic_load_explicit(&slot->state, memory_order_acquire);
+
+    if (state == SLOT_READY && slot->order == n && slot->ripple_dB == ripple_dB
+            && slot->stop_dB == stop_dB) {
+        if (slot->err == AFC_OK) {
+            memcpy(g, slot->g, (size_t)(n + 1) * sizeof *g);
+            memcpy(gz, slot->gz, (size_t)(n + 1) * sizeof *gz);
+            *f3dB = slot->f3dB;
+        }
+        return slot->err;
+    }
+    double ws;
+    int err = afc_elliptic_synthesize(n, ripple_dB, stop_dB, g, gz, f3dB, &ws);
+    // argument errors are cheap, only synthesis results are worth a slot
+    if ((err == AFC_OK || err == AFC_ERR_PRECISION || err == AFC_ERR_ELLIPTIC) && state == SLOT_EMPTY
+            && atomic_compare_exchange_strong(&slot->state, &state, SLOT_FILLING)) {
+        slot->order = n;
+        slot->ripple_dB = ripple_dB;
+        slot->stop_dB = stop_dB;
+        slot->err = err;
+        if (err == AFC_OK) {
+            slot->f3dB = *f3dB;
+            memcpy(slot->g, g, (size_t)(n + 1) * sizeof *g);
+            memcpy(slot->gz, gz, (size_t)(n + 1) * sizeof *gz);
+        }
+        atomic_store_explicit(&slot->state, SLOT_READY, memory_order_release);
+    }
+    return err;
+}
+
+// Elliptic g[0..n] and gz[0..n] for the spec, scaled like Chebyshev for
+// the 3 dB normalization.
+static int elliptic_prototype(const afc_spec *spec, double *g, double *gz) {
+    int n = spec->order;
+    double f3dB;
+
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    int err = elliptic_cached(n, spec->ripple_dB, spec->stop_dB, g, gz, &f3dB);
+    if (err != AFC_OK)
+        return err;
+    if (spec->norm != AFC_NORM_RIPPLE)
+        for (int i = 0; i < n; i++) {
+            g[i] *= f3dB;
+            gz[i] *= f3dB;
+        }
+    return AFC_OK;
+}
+
+int afc_prototype(afc_family family, int order, double ripple_dB, afc_norm norm, double *g) {
+    int n = order;
+
+    if (family == AFC_BUTTERWORTH) {
+        if (n < 1 || n > AFC_MAX_ORDER)
+            return AFC_ERR_ORDER;
+        if (n <= AFC_PROTO_TABLE_ORDER)
+            memcpy(g, afc_butterworth_g[n-1], (size_t)(n + 1) * sizeof *g);
+        else
+            afc_butterworth_synthesize(n, g);
+    } else if (family == AFC_CHEBYSHEV) {
+        double f3dB;
+        if (n < 1 || n > AFC_MAX_ORDER)
+            return AFC_ERR_ORDER;
+        if (!(ripple_dB > 0) || ripple_dB > 20)
+            return AFC_ERR_RIPPLE;
+        chebyshev_cached(n, ripple_dB, g, &f3dB);
+        // scaling g by f3dB moves the -3 dB point to the normalized cutoff
+        if (norm != AFC_NORM_RIPPLE)
+            for (int i = 0; i < n; i++)
+                g[i] *= f3dB;
+    } else if (family == AFC_BESSEL) {
+        double w3db;
+        if (n < 1 || n > AFC_MAX_ORDER)
+            return AFC_ERR_ORDER;
+        int err = bessel_delay_g(n, g, &w3db);
+        if (err != AFC_OK)
+            return err;
+        // the unit-delay ladder has its -3 dB point at w3db
+        if (norm != AFC_NORM_DELAY)
+            for (int i = 0; i < n; i++)
+                g[i] *= w3db;
+    } else {
+        // elliptic prototypes need the stop-band loss and tank values too,
+        // so they only come through afc_design()
+        return AFC_ERR_FAMILY;
+    }
+    return AFC_OK;
+}
+
+int afc_bessel_cutoff(int n, double *w3db) {
+    double g[AFC_MAX_ORDER + 1];
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    return bessel_delay_g(n, g, w3db);
+}
+
+double afc_load_impedance(const afc_spec *spec) {
+    double g[AFC_MAX_ORDER + 1];
+    int n = spec->order;
+
+    if (n < 1 || n > AFC_MAX_ORDER || spec->R <= 0)
+        return 0;
+    if (spec->family == AFC_ELLIPTIC) {
+        double gz[AFC_MAX_ORDER + 1];
+        // equal terminations at every order
+        return elliptic_prototype(spec, g, gz) == AFC_OK ? spec->R : 0;
+    }
+    if (afc_prototype(spec->family, n, spec->ripple_dB, spec->norm, g) != AFC_OK)
+        return 0;
+    // g(n+1) is a resistance after a shunt last element, a conductance
+    // after a series one
+    if (((n % 2 == 1) == (spec->topology == AFC_PI)))
+        return spec->R * g[n];
+    return spec->R / g[n];
+}
+
+/*
+ * Denormalization. A ladder alternates between two arms, the shunt and the
+ * series one, and for every filter type each arm's values are
+ *   C = Cg g + Cr / g,   L = Lg g + Lr / g
+ * with constants set once per spec (the unused ones zero). Orders up to
+ * AFC_PROTO_TABLE_ORDER have a kernel each whose loop the compiler unrolls
+ * into straight-line multiply-adds; larger orders use the plain loop.
+ */
+typedef struct {
+    double Cg, Cr, Lg, Lr;
+    afc_branch branch;
+    afc_form form;
+} denorm_arm;
+
+static inline void denorm_element(const denorm_arm *a, double g, afc_element *e) {
+    double r = 1.0 / g;
+    e->g = g;
+    e->C = a->Cg * g + a->Cr * r;
+    e->L = a->Lg * g + a->Lr * r;
+    e->branch = a->branch;
+    e->form = a->form;
+}
+
+static void denorm_any(int n, const denorm_arm *arm, const double *g, afc_element *out) {
+    for (int i = 0; i < n; i++)
+        denorm_element(&arm[i & 1], g[i], &out[i]);
+}
+
+#define DENORM_KERNEL(N) \
+    static void denorm_##N(const denorm_arm *arm, const double *g, afc_element *out) { \
+        _Pragma("GCC unroll 32") \
+        for (int i = 0; i < N; i++) \
+            denorm_element(&arm[i & 1], g[i], &out[i]); \
+    }
+
+DENORM_KERNEL(1)
+DENORM_KERNEL(2)
+DENORM_KERNEL(3)
+DENORM_KERNEL(4)
+DENORM_KERNEL(5)
+DENORM_KERNEL(6)
+DENORM_KERNEL(7)
+DENORM_KERNEL(8)
+DENORM_KERNEL(9)
+DENORM_KERNEL(10)
+DENORM_KERNEL(11)
+DENORM_KERNEL(12)
+DENORM_KERNEL(13)
+DENORM_KERNEL(14)
+DENORM_KERNEL(15)
+DENORM_KERNEL(16)
+DENORM_KERNEL(17)
+DENORM_KERNEL(18)
+DENORM_KERNEL(19)
+DENORM_KERNEL(20)
+DENORM_KERNEL(21)
+DENORM_KERNEL(22)
+DENORM_KERNEL(23)
+DENORM_KERNEL(24)
+DENORM_KERNEL(25)
+DENORM_KERNEL(26)
+DENORM_KERNEL(27)
+DENORM_KERNEL(28)
+DENORM_KERNEL(29)
+DENORM_KERNEL(30)
+DENORM_KERNEL(31)
+DENORM_KERNEL(32)
+
+typedef void (*denorm_kernel)(const denorm_arm *arm, const double *g, afc_element *out);
+
+static const denorm_kernel denorm_fixed[] = {
+    NULL,
+    denorm_1, denorm_2, denorm_3, denorm_4, denorm_5, denorm_6, denorm_7, denorm_8,
+    denorm_9, denorm_10, denorm_11, denorm_12, denorm_13, denorm_14, denorm_15, denorm_16,
+    denorm_17, denorm_18, denorm_19, denorm_20, denorm_21, denorm_22, denorm_23, denorm_24,
+    denorm_25, denorm_26, denorm_27, denorm_28, denorm_29, denorm_30, denorm_31, denorm_32
+};
+
+_Static_assert(sizeof denorm_fixed / sizeof denorm_fixed[0] == AFC_PROTO_TABLE_ORDER + 1,
+               "one denormalization kernel per tabulated order");
+
+// Arm constants for the spec's type; shunt is the shunt arm, series the other.
+static void denorm_arms(const afc_spec *spec, denorm_arm *shunt, denorm_arm *series) {
+    double R = spec->R, F = spec->freq, BW = spec->bw;
+    double w = 2 * PI * F, wb = 2 * PI * BW;
+
+    memset(shunt, 0, sizeof *shunt);
+    memset(series, 0, sizeof *series);
+    shunt->branch = AFC_SHUNT;
+    series->branch = AFC_SERIES;
+    switch (spec->type) {
+    case AFC_LOWPASS:
+        shunt->form = AFC_FORM_C;
+        shunt->Cg = 1.0 / (w * R);
+        series->form = AFC_FORM_L;
+        series->Lg = R / w;
+        break;
+    case AFC_HIGHPASS:
+        shunt->form = AFC_FORM_L;
+        shunt->Lr = R / w;
+        series->form = AFC_FORM_C;
+        series->Cr = 1.0 / (R * w);
+        break;
+    case AFC_BANDPASS:
+        // each arm resonates at F: shunt parallel LC, series series LC
+        shunt->form = AFC_FORM_PARALLEL_LC;
+        shunt->Cg = 1.0 / (R * wb);
+        shunt->Lr = (R * BW) / (w * F);
+        series->form = AFC_FORM_SERIES_LC;
+        series->Lg = R / wb;
+        series->Cr = BW / (w * F * R);
+        break;
+    case AFC_BANDREJECT:
+        // shunt series LC traps, series parallel LC blocks, all at F
+        shunt->form = AFC_FORM_SERIES_LC;
+        shunt->Lr = R / wb;
+        shunt->Cg = BW / (w * F * R);
+        series->form = AFC_FORM_PARALLEL_LC;
+        series->Cr = 1.0 / (R * wb);
+        series->Lg = (R * BW) / (w * F);
+        break;
+    }
+}
+
+// Spec checks shared by the denormalizations, in afc_denormalize() order.
+static int denorm_check(const afc_spec *spec) {
+    if (spec->type < AFC_LOWPASS || spec->type > AFC_BANDREJECT)
+        return AFC_ERR_TYPE;
+    if (spec->topology != AFC_PI && spec->topology != AFC_TEE)
+        return AFC_ERR_TOPOLOGY;
+    if (spec->order < 1 || spec->order > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    return AFC_OK;
+}
+
+static int denorm_values_check(const afc_spec *spec) {
+    if (!(spec->R > 0))
+        return AFC_ERR_IMPEDANCE;
+    if (!(spec->freq > 0) || ((spec->type == AFC_BANDPASS || spec->type == AFC_BANDREJECT) && !(spec->bw > 0)))
+        return AFC_ERR_FREQ;
+    return AFC_OK;
+}
+
+int afc_denormalize(const afc_spec *spec, const double *g, afc_element *out, int capacity) {
+    int n = spec->order, err;
+    denorm_arm arm[2];
+
+    if ((err = denorm_check(spec)) != AFC_OK)
+        return err;
+    if (n > capacity)
+        return AFC_ERR_SPACE;
+    if ((err = denorm_values_check(spec)) != AFC_OK)
+        return err;
+
+    // PI starts with a shunt branch, Tee with a series branch
+    long t0 = afc_stats_begin();
+    if (spec->topology == AFC_PI)
+        denorm_arms(spec, &arm[0], &arm[1]);
+    else
+        denorm_arms(spec, &arm[1], &arm[0]);
+    if (n <= AFC_PROTO_TABLE_ORDER)
+        denorm_fixed[n](arm, g, out);
+    else
+        denorm_any(n, arm, g, out);
+    afc_stats_end(AFC_STAGE_DENORM, t0);
+    return n;
+}
+
+/*
+ * A tank of the elliptic prototype is its own arm's element g in parallel
+ * (series arm) or in series (shunt arm) with the partner gz, which
+ * denormalizes like an element of the other arm. For LP and HP the two
+ * make one resonator. For BP and BR they are a series and a parallel LC;
+ * the pair is re-expanded (Foster) into two resonators of one kind in the
+ * same branch: two parallel LCs in series for a series branch, two series
+ * LCs in parallel for a shunt one. Both have the poles where
+ *   A w^4 - B w^2 + 1 = 0,  A = LaCa LbCb,  B = LaCa + LbCb + Ca Lb
+ * (a the series LC, b the parallel one) and residues
+ *   series branch  1/C = Lb (1 - LaCa w^2) / (A (w'^2 - w^2)),  L = 1 / (C w^2)
+ *   shunt branch   1/L = Ca (1 - LbCb w^2) / (A (w'^2 - w^2)),  C = 1 / (L w^2)
+ * Returns the number of elements written (1 or 2).
+ */
+static int denorm_tank(const denorm_arm *own, const denorm_arm *other, double g, double gz,
+                       afc_element *out) {
+    afc_element e, p;
+    denorm_element(own, g, &e);
+    denorm_element(other, gz, &p);
+
+    if (e.form == AFC_FORM_C || e.form == AFC_FORM_L) {
+        out->g = g;
+        out->C = e.C + p.C;   // each has only one of the two
+        out->L = e.L + p.L;
+        out->branch = own->branch;
+        out->form = own->branch == AFC_SERIES ? AFC_FORM_PARALLEL_LC : AFC_FORM_SERIES_LC;
+        return 1;
+    }
+
+    const afc_element *a = e.form == AFC_FORM_SERIES_LC ? &e : &p;
+    const afc_element *b = e.form == AFC_FORM_SERIES_LC ? &p : &e;
+    double ta = a->L * a->C, tb = b->L * b->C;
+    double A = ta * tb, B = ta + tb + a->C * b->L;
+    double root = sqrt(B * B - 4 * A);
+    double w2[2] = { 2 / (B + root), (B + root) / (2 * A) };
+
+    for (int i = 0; i < 2; i++) {
+        double spread = A * (w2[1-i] - w2[i]);
+        out[i].g = g;
+        out[i].branch = own->branch;
+        if (own->branch == AFC_SERIES) {
+            out[i].C = spread / (b->L * (1 - ta * w2[i]));
+            out[i].L = 1 / (out[i].C * w2[i]);
+            out[i].form = AFC_FORM_PARALLEL_LC;
+        } else {
+            out[i].L = spread / (a->C * (1 - tb * w2[i]));
+            out[i].C = 1 / (out[i].L * w2[i]);
+            out[i].form = AFC_FORM_SERIES_LC;
+        }
+    }
+    return 2;
+}
+
+int afc_denormalize_zeros(const afc_spec *spec, const double *g, const double *gz,
+                          afc_element *out, int capacity) {
+    int n = spec->order, count = 0, err;
+    denorm_arm arm[2];
+
+    if ((err = denorm_check(spec)) != AFC_OK)
+        return err;
+    if ((err = denorm_values_check(spec)) != AFC_OK)
+        return err;
+
+    long t0 = afc_stats_begin();
+    if (spec->topology == AFC_PI)
+        denorm_arms(spec, &arm[0], &arm[1]);
+    else
+        denorm_arms(spec, &arm[1], &arm[0]);
+    for (int i = 0; i < n && count >= 0; i++) {
+        int split = gz[i] > 0 && (spec->type == AFC_BANDPASS || spec->type == AFC_BANDREJECT);
+        if (count + 1 + split > capacity)
+            count = AFC_ERR_SPACE;
+        else if (gz[i] > 0)
+            count += denorm_tank(&arm[i & 1], &arm[!(i & 1)], g[i], gz[i], &out[count]);
+        else
+            denorm_element(&arm[i & 1], g[i], &out[count++]);
+    }
+    afc_stats_end(AFC_STAGE_DENORM, t0);
+    return count;
+}
+
+static int elliptic_design(const afc_spec *spec, afc_element *out, int capacity) {
+    double g[AFC_MAX_ORDER + 1], gz[AFC_MAX_ORDER + 1];
+    int err;
+
+    if ((err = denorm_check(spec)) != AFC_OK)
+        return err;
+    if ((err = denorm_values_check(spec)) != AFC_OK)
+        return err;
+    long t0 = afc_stats_begin();
+    err = elliptic_prototype(spec, g, gz);
+    afc_stats_end(AFC_STAGE_PROTOTYPE, t0);
+    if (err != AFC_OK)
+        return err;
+    return afc_denormalize_zeros(spec, g, gz, out, capacity);
+}
+
+int afc_design(const afc_spec *spec, afc_element *out, int capacity) {
+    double g[AFC_MAX_ORDER + 1];
+    int err;
+
+    if (spec->order < 1 || spec->order > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    if (spec->family == AFC_ELLIPTIC)
+        return elliptic_design(spec, out, capacity);
+    long t0 = afc_stats_begin();
+    err = afc_prototype(spec->family, spec->order, spec->ripple_dB, spec->norm, g);
+    afc_stats_end(AFC_STAGE_PROTOTYPE, t0);
+    if (err != AFC_OK)
+        return err;
+    return afc_denormalize(spec, g, out, capacity);
+}
+
+// Whether two specs share one normalized prototype: the fields
+// afc_prototype() and elliptic_prototype() act on, and the ladder shape.
+static int same_prototype(const afc_spec *a, const afc_spec *b) {
+    if (a->family != b->family || a->type != b->type || a->order != b->order ||
+        a->topology != b->topology)
+        return 0;
+    switch (a->family) {
+    case AFC_ELLIPTIC:
+        if (a->stop_dB != b->stop_dB)
+            return 0;
+        // fall through
+    case AFC_CHEBYSHEV:
+        return a->ripple_dB == b->ripple_dB &&
+               (a->norm == AFC_NORM_RIPPLE) == (b->norm == AFC_NORM_RIPPLE);
+    case AFC_BESSEL:
+        return (a->norm == AFC_NORM_DELAY) == (b->norm == AFC_NORM_DELAY);
+    default:
+        return 1;
+    }
+}
+
+/*
+ * Every element keeps its g, so apart from elliptic tanks a design is
+ * re-denormalized from its own coefficients. Elliptic LP/HP tanks and BP/BR
+ * designs whose fractional bandwidth is unchanged only scale: C by
+ * (F0 R0) / (F R), L by (F0 R) / (F R0). A BP/BR tank split at another
+ * fractional bandwidth depends on it non-linearly and is refused.
+ */
+int afc_rescale(const afc_spec *from, const afc_element *el, int n, const afc_spec *to,
+                afc_element *out, int capacity) {
+    double g[AFC_MAX_ORDER + 1];
+    int err;
+
+    if (!same_prototype(from, to) || n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ARGUMENT;
+    if ((err = denorm_check(to)) != AFC_OK || (err = denorm_values_check(to)) != AFC_OK)
+        return err;
+    if (n > capacity)
+        return AFC_ERR_SPACE;
+    if (from->family != AFC_ELLIPTIC) {
+        if (n != from->order)
+            return AFC_ERR_ARGUMENT;
+        for (int i = 0; i < n; i++)
+            g[i] = el[i].g;
+        return afc_denormalize(to, g, out, capacity);
+    }
+
+    if (!(from->R > 0) || !(from->freq > 0))
+        return AFC_ERR_ARGUMENT;
+    if (to->type == AFC_BANDPASS || to->type == AFC_BANDREJECT) {
+        double a = from->bw * to->freq, b = to->bw * from->freq;
+        if (!(fabs(a - b) <= 1e-12 * a))
+            return AFC_ERR_ARGUMENT;
+    }
+    double f = from->freq / to->freq, r = to->R / from->R;
+    double kC = f / r, kL = f * r;
+    for (int i = 0; i < n; i++) {
+        out[i] = el[i];
+        out[i].C *= kC;
+        out[i].L *= kL;
+    }
+    return n;
+}
+
+int afc_butterworth_order(afc_type type, double cutoff, double atten_dB, double offset_freq) {
+    double ratio;
+
+    if (type == AFC_LOWPASS && atten_dB > 0 && offset_freq > cutoff)
+        ratio = offset_freq / cutoff;
+    else if (type == AFC_HIGHPASS && atten_dB > 0 && offset_freq < cutoff && offset_freq > 0)
+        ratio = cutoff / offset_freq;
+    else
+        return AFC_ERR_FREQ;
+    return (int)ceil(log10(pow(10, atten_dB / 10) - 1) / (2 * log10(ratio)));
+}
+
+const char *afc_strerror(int err) {
+    switch (err) {
+    case AFC_OK:            return "success";
+    case AFC_ERR_FAMILY:    return "unknown filter family";
+    case AFC_ERR_TYPE:      return "unknown filter type";
+    case AFC_ERR_TOPOLOGY:  return "unknown topology";
+    case AFC_ERR_ORDER:     return "order out of range for this family";
+    case AFC_ERR_RIPPLE:    return "ripple must be > 0 and <= 20 dB";
+    case AFC_ERR_FREQ:      return "invalid frequency";
+    case AFC_ERR_IMPEDANCE: return "impedance must be > 0";
+    case AFC_ERR_SPACE:     return "element array too small";
+    case AFC_ERR_PRECISION: return "order too high for the synthesis precision (Bessel: build with -DAFC_BESSEL_QUAD; "
+                                   "elliptic: lower the order or the stop-band loss)";
+    case AFC_ERR_ELEMENT:   return "invalid element value";
+    case AFC_ERR_ARGUMENT:  return "invalid analysis setting";
+    case AFC_ERR_MEMORY:    return "out of memory";
+    case AFC_ERR_IO:        return "file error";
+    case AFC_ERR_FORMAT:    return "not a sweep file";
+    case AFC_ERR_NETLIST:   return "not a two-port LC ladder netlist";
+    case AFC_ERR_STOPBAND:  return "stop-band loss must exceed the ripple and be <= 300 dB";
+    case AFC_ERR_ELLIPTIC:  return "no elliptic ladder with positive elements for this order and mask "
+                                   "(stop band too close: try the next even order or more stop-band loss)";
+    default:                return "unknown error";
+    }
+}
+
+afc_family afc_family_from_name(const char *s) {
+    if (!strcasecmp(s, "butterworth")) return AFC_BUTTERWORTH;
+    if (!strcasecmp(s, "chebyshev"))   return AFC_CHEBYSHEV;
+    if (!strcasecmp(s, "bessel"))      return AFC_BESSEL;
+    if (!strcasecmp(s, "elliptic") || !strcasecmp(s, "cauer")) return AFC_ELLIPTIC;
+    return 0;
+}
+
+afc_type afc_type_from_name(const char *s) {
+    if (!strcasecmp(s, "lp") || !strcasecmp(s, "lowpass")    || !strcasecmp(s, "1")) return AFC_LOWPASS;
+    if (!strcasecmp(s, "hp") || !strcasecmp(s, "highpass")   || !strcasecmp(s, "2")) return AFC_HIGHPASS;
+    if (!strcasecmp(s, "bp") || !strcasecmp(s, "bandpass")   || !strcasecmp(s, "3")) return AFC_BANDPASS;
+    if (!strcasecmp(s, "br") || !strcasecmp(s, "bandreject") || !strcasecmp(s, "4")) return AFC_BANDREJECT;
+    return 0;
+}
+
+afc_topology afc_topology_from_name(const char *s) {
+    if (!strcasecmp(s, "pi")  || !strcasecmp(s, "1")) return AFC_PI;
+    if (!strcasecmp(s, "tee") || !strcasecmp(s, "2")) return AFC_TEE;
+    return 0;
+}
+
+int afc_norm_from_name(const char *s) {
+    if (!strcasecmp(s, "3db"))    return AFC_NORM_3DB;
+    if (!strcasecmp(s, "ripple")) return AFC_NORM_RIPPLE;
+    if (!strcasecmp(s, "delay"))  return AFC_NORM_DELAY;
+    return -1;
+}
+
+const char *afc_family_name(afc_family family) {
+    switch (family) {
+    case AFC_BUTTERWORTH: return "butterworth";
+    case AFC_CHEBYSHEV:   return "chebyshev";
+    case AFC_BESSEL:      return "bessel";
+    case AFC_ELLIPTIC:    return "elliptic";
+    }
+    return "?";
+}
+
+const char *afc_type_name(afc_type type) {
+    switch (type) {
+    case AFC_LOWPASS:    return "lp";
+    case AFC_HIGHPASS:   return "hp";
+    case AFC_BANDPASS:   return "bp";
+    case AFC_BANDREJECT: return "br";
+    }
+    return "?";
+}
+
+const char *afc_topology_name(afc_topology topology) {
+    switch (topology) {
+    case AFC_PI:  return "pi";
+    case AFC_TEE: return "tee";
+    }
+    return "?";
+}
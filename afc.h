@@ -0,0 +1,186 @@
+/*
+ * Analog Filter Calculator - design library (libafc)
+ * Normalized prototypes and LP/HP/BP/BR denormalization for PI and Tee
+ * ladders with equal source and load termination.
+ *
+ * The design entry points take a spec struct and fill a caller-provided
+ * element array: no heap allocation and no I/O.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_H
+#define AFC_H
+
+#define AFC_M_PI 3.141592653589793
+
+#define AFC_MAX_ORDER 64
+
+typedef enum {
+    AFC_BUTTERWORTH = 1,
+    AFC_CHEBYSHEV   = 2,
+    AFC_BESSEL      = 3,
+    AFC_ELLIPTIC    = 4
+} afc_family;
+
+typedef enum {
+    AFC_LOWPASS    = 1,
+    AFC_HIGHPASS   = 2,
+    AFC_BANDPASS   = 3,
+    AFC_BANDREJECT = 4
+} afc_type;
+
+typedef enum {
+    AFC_PI  = 1,   // element 1 is a shunt branch
+    AFC_TEE = 2    // element 1 is a series branch
+} afc_topology;
+
+// Which frequency the prototype is normalized to
+typedef enum {
+    AFC_NORM_3DB    = 0,   // freq is the -3 dB point (default)
+    AFC_NORM_RIPPLE = 1,   // Chebyshev, elliptic: freq is the ripple band edge
+    AFC_NORM_DELAY  = 2    // Bessel: unit group delay, i.e. 1/(2 pi freq) s
+} afc_norm;
+
+// Position of an element in the ladder
+typedef enum {
+    AFC_SHUNT  = 0,
+    AFC_SERIES = 1
+} afc_branch;
+
+// What the element is made of
+typedef enum {
+    AFC_FORM_C           = 1,
+    AFC_FORM_L           = 2,
+    AFC_FORM_SERIES_LC   = 3,
+    AFC_FORM_PARALLEL_LC = 4
+} afc_form;
+
+// Error codes (all negative)
+enum {
+    AFC_OK            =  0,
+    AFC_ERR_FAMILY    = -1,
+    AFC_ERR_TYPE      = -2,
+    AFC_ERR_TOPOLOGY  = -3,
+    AFC_ERR_ORDER     = -4,
+    AFC_ERR_RIPPLE    = -5,
+    AFC_ERR_FREQ      = -6,
+    AFC_ERR_IMPEDANCE = -7,
+    AFC_ERR_SPACE     = -8,
+    AFC_ERR_PRECISION = -9,
+    AFC_ERR_ELEMENT   = -10,
+    AFC_ERR_ARGUMENT  = -11,
+    AFC_ERR_MEMORY    = -12,
+    AFC_ERR_IO        = -13,
+    AFC_ERR_FORMAT    = -14,
+    AFC_ERR_NETLIST   = -15,
+    AFC_ERR_STOPBAND  = -16,
+    AFC_ERR_ELLIPTIC  = -17
+};
+
+typedef struct {
+    afc_family family;
+    afc_type type;
+    int order;
+    double ripple_dB;      // Chebyshev / elliptic pass-band ripple
+    double freq;           // cutoff (LP/HP) or center (BP/BR) frequency in Hz
+    double bw;             // bandwidth in Hz (BP/BR only)
+    afc_topology topology;
+    double R;              // source impedance in ohm
+    afc_norm norm;         // cutoff normalization, AFC_NORM_3DB if zeroed
+    double stop_dB;        // elliptic minimum stop-band loss
+} afc_spec;
+
+typedef struct {
+    double g;              // normalized coefficient
+    double C;              // capacitance in F (0 if the element has none)
+    double L;              // inductance in H (0 if the element has none)
+    afc_branch branch;
+    afc_form form;
+} afc_element;
+
+// Fill g[0..order-1] with the normalized low-pass prototype and g[order]
+// with the load termination g(n+1), so g needs order+1 entries. Chebyshev
+// prototypes come from the closed-form recurrence and are memoized per
+// (order, ripple); even orders have g(n+1) != 1.
+int afc_prototype(afc_family family, int order, double ripple_dB, afc_norm norm, double *g);
+
+// Closed-form prototypes (afc_proto.c): Butterworth g[0..n], Chebyshev
+// g[0..n] normalized to the ripple band edge with *f3dB its -3 dB point.
+// Orders up to AFC_PROTO_TABLE_ORDER (and for Chebyshev the common
+// ripples) are precomputed, so afc_prototype() only calls these outside
+// the tables.
+void afc_butterworth_synthesize(int n, double *g);
+void afc_chebyshev_synthesize(int n, double ripple_dB, double *g, double *f3dB);
+
+// Bessel ladder by Darlington synthesis of the reverse Bessel polynomial
+// (afc_bessel.c): g[0..n] normalized to unit group delay, *w3db the -3 dB
+// frequency of that prototype. Orders up to AFC_BESSEL_TABLE_ORDER are
+// precomputed, so afc_prototype() only calls this for larger ones.
+int afc_bessel_synthesize(int n, double *g, double *w3db);
+
+// -3 dB frequency of the unit-delay Bessel prototype of order n, from the
+// table or the synthesis cache.
+int afc_bessel_cutoff(int n, double *w3db);
+
+// Elliptic ladder by zero shifting (afc_elliptic.c), normalized to the
+// ripple band edge: g[0..n] as above, gz[i] the capacitance resonating
+// with the series inductor g[i] (0 for plain elements), *f3dB the -3 dB
+// and *ws the stop-band edge frequency. Even orders are type c, so every
+// order has equal terminations. AFC_ERR_ELLIPTIC: this order has no ladder
+// with positive elements for the mask (its stop-band edge is too close to
+// the pass band; the next even order usually has one); AFC_ERR_PRECISION:
+// the order is too high for double precision at this stop-band loss.
+int afc_elliptic_synthesize(int n, double ripple_dB, double stop_dB, double *g, double *gz,
+                            double *f3dB, double *ws);
+
+// Smallest elliptic order whose stop-band edge (relative to the ripple
+// edge) is at most ws and which has a ladder (orders that fail with
+// AFC_ERR_ELLIPTIC are passed over).
+int afc_elliptic_order(double ripple_dB, double stop_dB, double ws);
+
+// Loss in dB of the elliptic response at w, relative to the ripple edge
+// for AFC_NORM_RIPPLE and to the -3 dB frequency otherwise.
+int afc_elliptic_loss(int n, double ripple_dB, double stop_dB, afc_norm norm, double w,
+                      double *atten_dB);
+
+// Load impedance the ladder must be terminated in: R for everything except
+// even-order Chebyshev designs. Returns 0 if the spec is invalid.
+double afc_load_impedance(const afc_spec *spec);
+
+// Denormalize a prototype into ladder elements for the spec's type,
+// frequency, impedance and topology. Returns the element count or an error.
+int afc_denormalize(const afc_spec *spec, const double *g, afc_element *out, int capacity);
+
+// The same for a prototype with transmission zeros: gz[i] > 0 is the
+// capacitance resonating with the series inductor g[i], as returned by
+// afc_elliptic_synthesize(). The family of spec is not looked at.
+int afc_denormalize_zeros(const afc_spec *spec, const double *g, const double *gz,
+                          afc_element *out, int capacity);
+
+// afc_prototype followed by afc_denormalize.
+int afc_design(const afc_spec *spec, afc_element *out, int capacity);
+
+// Rescale n elements designed for `from` to the frequency, bandwidth and
+// impedance of `to` without going back to the prototype. The other fields
+// must match; AFC_ERR_ARGUMENT if they do not, or for an elliptic BP/BR
+// design whose fractional bandwidth changes (call afc_design() then).
+int afc_rescale(const afc_spec *from, const afc_element *el, int n, const afc_spec *to,
+                afc_element *out, int capacity);
+
+// Minimum Butterworth LP/HP order reaching atten_dB at offset_freq.
+int afc_butterworth_order(afc_type type, double cutoff, double atten_dB, double offset_freq);
+
+const char *afc_strerror(int err);
+
+// Name lookups used by the non-interactive front-ends (0 if unknown).
+afc_family afc_family_from_name(const char *s);
+afc_type afc_type_from_name(const char *s);
+afc_topology afc_topology_from_name(const char *s);
+int afc_norm_from_name(const char *s);   // -1 if unknown
+const char *afc_family_name(afc_family family);
+const char *afc_type_name(afc_type type);
+const char *afc_topology_name(afc_topology topology);
+
+#endif
@@ -0,0 +1,240 @@
+/*
+ * Analog Filter Calculator - Bessel-Thomson ladder synthesis
+ * Equal-terminated ladder g-values for any order, from the reverse Bessel
+ * polynomial by Darlington synthesis and a continued-fraction (Cauer)
+ * expansion of the input admittance.
+ *
+ * The common orders are precomputed into afc_tables.h by gen_afc_tables.c,
+ * which calls this same routine; afc.c only synthesizes at run time for
+ * orders above AFC_BESSEL_TABLE_ORDER.
+ *
+ * The expansion loses roughly two digits per order. In long double it is
+ * good to about order 34; build with -DAFC_BESSEL_QUAD (and -lquadmath) to
+ * run it in __float128, which reaches AFC_MAX_ORDER. Every result is
+ * checked against the Bessel response and rejected if precision ran out.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <complex.h>
+
+#include "afc.h"
+
+#ifdef AFC_BESSEL_QUAD
+#include <quadmath.h>
+typedef __float128 real;
+typedef __complex128 cplx;
+#define R_EPS     1e-28Q
+#define creal_r   crealq
+#define cimag_r   cimagq
+#define cabs_r    cabsq
+#define csqrt_r   csqrtq
+#define cexp_r    cexpq
+#define pow_r     powq
+#define fabs_r    fabsq
+#else
+typedef long double real;
+typedef long double complex cplx;
+#define R_EPS     1e-17L
+#define creal_r   creall
+#define cimag_r   cimagl
+#define cabs_r    cabsl
+#define csqrt_r   csqrtl
+#define cexp_r    cexpl
+#define pow_r     powl
+#define fabs_r    fabsl
+#endif
+
+// Evaluate the polynomial c[0] + c[1] s + ... + c[deg] s^deg
+static cplx poly_eval(const real *c, int deg, cplx s) {
+    cplx v = c[deg];
+    for (int k = deg - 1; k >= 0; k--)
+        v = v * s + c[k];
+    return v;
+}
+
+// |E(j w)|^2 for the real polynomial E
+static real mag2(const real *c, int deg, real w) {
+    cplx v = poly_eval(c, deg, I * w);
+    return creal_r(v) * creal_r(v) + cimag_r(v) * cimag_r(v);
+}
+
+/*
+ * Roots of c[0] + ... + c[deg] x^deg by the Aberth-Ehrlich iteration.
+ * Returns 0 if it failed to converge.
+ */
+static int poly_roots(const real *c, int deg, cplx *root) {
+    real dc[AFC_MAX_ORDER + 1];
+    real radius = 0;
+
+    for (int k = 0; k < deg; k++) {
+        real r = pow_r(fabs_r(c[k] / c[deg]), (real)1 / (deg - k));
+        if (r > radius)
+            radius = r;
+    }
+    for (int k = 1; k <= deg; k++)
+        dc[k-1] = k * c[k];
+    for (int k = 0; k < deg; k++)
+        root[k] = radius * cexp_r(I * (real)(2 * AFC_M_PI * k / deg + 0.4));
+
+    for (int iter = 0; iter < 5000; iter++) {
+        real worst = 0;
+        for (int k = 0; k < deg; k++) {
+            cplx ratio = poly_eval(c, deg, root[k]) / poly_eval(dc, deg - 1, root[k]);
+            cplx sum = 0;
+            for (int j = 0; j < deg; j++)
+                if (j != k)
+                    sum += 1 / (root[k] - root[j]);
+            cplx step = ratio / (1 - ratio * sum);
+            root[k] -= step;
+            real rel = cabs_r(step) / (cabs_r(root[k]) + R_EPS * R_EPS);
+            if (rel > worst)
+                worst = rel;
+        }
+        if (worst < R_EPS)
+            return 1;
+    }
+    return 0;
+}
+
+/*
+ * Check the synthesized ladder (shunt C first, 1 ohm both ends) against
+ * |S21| = 1/|E| at a few frequencies around the -3 dB point.
+ */
+static int ladder_matches(const real *E, int n, const double *g, real w) {
+    static const double wt[8] = {0.1, 0.25, 0.5, 0.7, 1.0, 1.4, 1.8, 2.5};
+
+    for (int i = 0; i < n; i++)
+        if (!(g[i] > 0) || !isfinite(g[i]))
+            return 0;
+    if (!(fabs(g[n] - 1) < 1e-6))
+        return 0;
+
+    for (int p = 0; p < 8; p++) {
+        cplx s = I * (real)wt[p];
+        // ABCD of the chain; Vs/V2 = A + B + C + D for 1 ohm terminations
+        cplx A = 1, B = 0, C = 0, D = 1;
+        for (int e = 0; e < n; e++) {
+            cplx x = s * (real)g[e] * w;
+            if (e % 2 == 0) { // shunt C
+                A += B * x;
+                C += D * x;
+            } else {          // series L
+                B += A * x;
+                D += C * x;
+            }
+        }
+        real got = cabs_r(A + B + C + D) / 2;
+        real want = cabs_r(poly_eval(E, n, s));
+        if (fabs_r(got / want - 1) > (real)1e-6)
+            return 0;
+    }
+    return 1;
+}
+
+/*
+ * Synthesize the order-n Bessel ladder for 1 ohm terminations.
+ * g[0..n-1] receive the element values normalized to unit group delay at
+ * DC, g[n] the load termination; *w3db receives the -3 dB frequency of
+ * that prototype (multiply g by it for a -3 dB normalized ladder).
+ * Elements run from the source: a shunt C first for a PI ladder.
+ */
+int afc_bessel_synthesize(int n, double *g, double *w3db) {
+    real a[AFC_MAX_ORDER + 1], E[AFC_MAX_ORDER + 1], F[AFC_MAX_ORDER + 1];
+    real num[AFC_MAX_ORDER + 1], den[AFC_MAX_ORDER + 1];
+    real P[AFC_MAX_ORDER + 1];
+    cplx xr[AFC_MAX_ORDER], fpoly[AFC_MAX_ORDER + 1];
+    real lo, hi, w;
+
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+
+    // reverse Bessel polynomial, a[k] = (2n-k)! / (2^(n-k) k! (n-k)!), a[0] = 1 after scaling
+    a[0] = 1;
+    for (int k = 0; k < n; k++)
+        a[k+1] = a[k] * 2 * (n - k) / ((real)(k + 1) * (2 * n - k));
+
+    // -3 dB frequency of the unit-delay prototype: |E(jw)|^2 = 2
+    hi = 1;
+    while (mag2(a, n, hi) < 2)
+        hi *= 2;
+    lo = 0;
+    for (int it = 0; it < 200; it++) {
+        real mid = (lo + hi) / 2;
+        if (mag2(a, n, mid) < 2)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    w = (lo + hi) / 2;
+
+    // work in -3 dB normalized frequency where the roots are O(1)
+    for (int k = 0; k <= n; k++)
+        E[k] = a[k] * pow_r(w, k);
+
+    /*
+     * |S11|^2 = 1 - 1/|E|^2, so F(s)F(-s) = E(s)E(-s) - 1. With x = s^2 and
+     * E = ev(x) + s od(x) this is ev^2 - x od^2 - 1, which vanishes at x = 0.
+     */
+    for (int k = 0; k <= n; k++)
+        P[k] = 0;
+    for (int i = 0; 2 * i <= n; i++)
+        for (int j = 0; 2 * j <= n; j++)
+            P[i+j] += E[2*i] * E[2*j];
+    for (int i = 0; 2 * i + 1 <= n; i++)
+        for (int j = 0; 2 * j + 1 <= n; j++)
+            P[i+j+1] -= E[2*i+1] * E[2*j+1];
+    P[0] -= 1;
+
+    /*
+     * P(x)/x has n-1 roots; each gives a zero sqrt(x) of F. Taking the
+     * right-half-plane root puts the small elements first (the orientation
+     * of the classic tables) and keeps the expansion well conditioned;
+     * the left-half-plane choice gives the reversed ladder but loses
+     * precision several orders earlier.
+     */
+    if (n > 1 && !poly_roots(P + 1, n - 1, xr))
+        return AFC_ERR_PRECISION;
+
+    fpoly[0] = 0;
+    fpoly[1] = E[n];   // F = E[n] * s * prod(s - s_i)
+    for (int k = 2; k <= n; k++)
+        fpoly[k] = 0;
+    for (int i = 0; i < n - 1; i++) {
+        cplx si = csqrt_r(xr[i]);
+        for (int k = i + 2; k >= 1; k--)
+            fpoly[k] = fpoly[k-1] - si * fpoly[k];
+        fpoly[0] = -si * fpoly[0];
+    }
+    for (int k = 0; k <= n; k++)
+        F[k] = creal_r(fpoly[k]);
+
+    // Y_in = (E + F) / (E - F) expanded as C1 s + 1/(L2 s + 1/(C3 s + ...))
+    int dden = n - 1;
+    for (int k = 0; k <= n; k++) {
+        num[k] = E[k] + F[k];
+        den[k] = E[k] - F[k];
+    }
+    for (int e = 0; e < n; e++) {
+        real q = num[dden+1] / den[dden];
+        g[e] = (double)(q / w);
+        // num - q s den: the top two terms cancel, leaving degree dden-1
+        for (int k = 1; k <= dden; k++)
+            num[k] -= q * den[k-1];
+        if (dden == 0)
+            break;
+        for (int k = 0; k <= dden; k++) {
+            real t = num[k];
+            num[k] = den[k];
+            den[k] = t;
+        }
+        dden--;
+    }
+    // the remainder is the load immittance; g(n+1) is its reciprocal
+    g[n] = (double)(den[0] / num[0]);
+    *w3db = (double)w;
+
+    return ladder_matches(E, n, g, w) ? AFC_OK : AFC_ERR_PRECISION;
+}
@@ -0,0 +1,245 @@
+/*
+ * Analog Filter Calculator - design result cache
+ * Sharded LRU map from normalized specs to designed ladders.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "afc_cache.h"
+
+#define CACHE_SHARDS 16
+
+// Normalized spec; built with memset so it can be hashed and compared
+// byte-wise.
+typedef struct {
+    int family, type, order, topology, norm, pad;
+    double ripple_dB, stop_dB, freq, bw, R;
+} cache_key;
+
+typedef struct cache_entry {
+    cache_key key;
+    uint64_t hash;
+    struct cache_entry *chain;        // next entry in the same bucket
+    struct cache_entry *newer, *older;
+    int n;                            // element count or error code
+    afc_element el[];
+} cache_entry;
+
+typedef struct {
+    _Alignas(64) pthread_mutex_t lock;
+    cache_entry **bucket;
+    size_t mask;                      // bucket count - 1
+    cache_entry *newest, *oldest;
+    long count, cap;
+    long hits, misses, evictions;
+} cache_shard;
+
+struct afc_design_cache {
+    cache_shard shard[CACHE_SHARDS];
+};
+
+static double zero_signed(double x) {
+    return x == 0 ? 0.0 : x;   // -0.0 and 0.0 are one key
+}
+
+static void make_key(const afc_spec *s, cache_key *k) {
+    memset(k, 0, sizeof *k);
+    k->family = s->family;
+    k->type = s->type;
+    k->order = s->order;
+    k->topology = s->topology;
+    k->freq = zero_signed(s->freq);
+    k->R = zero_signed(s->R);
+    if (s->type == AFC_BANDPASS || s->type == AFC_BANDREJECT)
+        k->bw = zero_signed(s->bw);
+    // only the choices afc_prototype() acts on
+    if (s->family == AFC_CHEBYSHEV || s->family == AFC_ELLIPTIC) {
+        k->ripple_dB = zero_signed(s->ripple_dB);
+        k->norm = s->norm == AFC_NORM_RIPPLE ? AFC_NORM_RIPPLE : AFC_NORM_3DB;
+        if (s->family == AFC_ELLIPTIC)
+            k->stop_dB = zero_signed(s->stop_dB);
+    } else if (s->family == AFC_BESSEL) {
+        k->norm = s->norm == AFC_NORM_DELAY ? AFC_NORM_DELAY : AFC_NORM_3DB;
+    }
+}
+
+static uint64_t hash_key(const cache_key *k) {
+    const unsigned char *p = (const unsigned char *)k;
+    uint64_t h = 0xCBF29CE484222325ull;   // FNV-1a, then a final mix
+    for (size_t i = 0; i < sizeof *k; i++)
+        h = (h ^ p[i]) * 0x100000001B3ull;
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 32;
+    return h;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Shard lists (callers hold the shard lock)                              */
+/* ---------------------------------------------------------------------- */
+
+static void unlink_lru(cache_shard *sh, cache_entry *e) {
+    if (e->newer)
+        e->newer->older = e->older;
+    else
+        sh->newest = e->older;
+    if (e->older)
+        e->older->newer = e->newer;
+    else
+        sh->oldest = e->newer;
+}
+
+static void push_newest(cache_shard *sh, cache_entry *e) {
+    e->newer = NULL;
+    e->older = sh->newest;
+    if (sh->newest)
+        sh->newest->newer = e;
+    else
+        sh->oldest = e;
+    sh->newest = e;
+}
+
+static cache_entry **find_slot(cache_shard *sh, const cache_key *k, uint64_t hash) {
+    cache_entry **p = &sh->bucket[(hash >> 4) & sh->mask];
+    while (*p && ((*p)->hash != hash || memcmp(&(*p)->key, k, sizeof *k)))
+        p = &(*p)->chain;
+    return p;
+}
+
+static void evict_oldest(cache_shard *sh) {
+    cache_entry *e = sh->oldest;
+    unlink_lru(sh, e);
+    *find_slot(sh, &e->key, e->hash) = e->chain;
+    free(e);
+    sh->count--;
+    sh->evictions++;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Public API                                                             */
+/* ---------------------------------------------------------------------- */
+
+afc_design_cache *afc_cache_create(long capacity) {
+    afc_design_cache *c = calloc(1, sizeof *c);
+    if (!c)
+        return NULL;
+    long per = (capacity + CACHE_SHARDS - 1) / CACHE_SHARDS;
+    if (per < 1)
+        per = 1;
+    // about one entry per bucket when full
+    size_t buckets = 1;
+    while ((long)buckets < per)
+        buckets <<= 1;
+    for (int s = 0; s < CACHE_SHARDS; s++) {
+        cache_shard *sh = &c->shard[s];
+        pthread_mutex_init(&sh->lock, NULL);
+        sh->cap = per;
+        sh->mask = buckets - 1;
+        if (!(sh->bucket = calloc(buckets, sizeof *sh->bucket))) {
+            afc_cache_destroy(c);
+            return NULL;
+        }
+    }
+    return c;
+}
+
+void afc_cache_destroy(afc_design_cache *c) {
+    if (!c)
+        return;
+    for (int s = 0; s < CACHE_SHARDS; s++) {
+        cache_shard *sh = &c->shard[s];
+        for (cache_entry *e = sh->newest, *next; e; e = next) {
+            next = e->older;
+            free(e);
+        }
+        free(sh->bucket);
+        pthread_mutex_destroy(&sh->lock);
+    }
+    free(c);
+}
+
+int afc_cache_design(afc_design_cache *c, const afc_spec *spec, afc_element *out,
+                     int capacity, int *hit) {
+    cache_key k;
+    make_key(spec, &k);
+    uint64_t hash = hash_key(&k);
+    cache_shard *sh = &c->shard[hash % CACHE_SHARDS];
+    int n;
+
+    pthread_mutex_lock(&sh->lock);
+    cache_entry *e = *find_slot(sh, &k, hash);
+    if (e) {
+        n = e->n;
+        if (n > capacity)
+            n = AFC_ERR_SPACE;
+        else if (n > 0)
+            memcpy(out, e->el, (size_t)n * sizeof *out);
+        unlink_lru(sh, e);
+        push_newest(sh, e);
+        sh->hits++;
+        pthread_mutex_unlock(&sh->lock);
+        if (hit)
+            *hit = 1;
+        return n;
+    }
+    sh->misses++;
+    pthread_mutex_unlock(&sh->lock);
+    if (hit)
+        *hit = 0;
+
+    // design into a full-size array so the entry does not depend on the
+    // caller's capacity
+    afc_element el[AFC_MAX_ORDER];
+    n = afc_design(spec, el, AFC_MAX_ORDER);
+    int count = n > 0 ? n : 0;
+    cache_entry *fresh = malloc(sizeof *fresh + (size_t)count * sizeof *fresh->el);
+    if (fresh) {
+        fresh->key = k;
+        fresh->hash = hash;
+        fresh->n = n;
+        memcpy(fresh->el, el, (size_t)count * sizeof *el);
+
+        pthread_mutex_lock(&sh->lock);
+        cache_entry **slot = find_slot(sh, &k, hash);
+        if (*slot) {
+            // another caller designed the same spec meanwhile
+            free(fresh);
+        } else {
+            if (sh->count == sh->cap)
+                evict_oldest(sh);
+            // eviction may have changed the chain, so look the slot up again
+            slot = find_slot(sh, &k, hash);
+            fresh->chain = NULL;
+            *slot = fresh;
+            push_newest(sh, fresh);
+            sh->count++;
+        }
+        pthread_mutex_unlock(&sh->lock);
+    }
+
+    if (n > capacity)
+        return AFC_ERR_SPACE;
+    if (n > 0)
+        memcpy(out, el, (size_t)n * sizeof *out);
+    return n;
+}
+
+void afc_cache_get_stats(afc_design_cache *c, afc_cache_stats *st) {
+    memset(st, 0, sizeof *st);
+    for (int s = 0; s < CACHE_SHARDS; s++) {
+        cache_shard *sh = &c->shard[s];
+        pthread_mutex_lock(&sh->lock);
+        st->hits += sh->hits;
+        st->misses += sh->misses;
+        st->evictions += sh->evictions;
+        st->entries += sh->count;
+        st->capacity += sh->cap;
+        pthread_mutex_unlock(&sh->lock);
+    }
+}
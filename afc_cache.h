@@ -0,0 +1,44 @@
+/*
+ * Analog Filter Calculator - design result cache
+ * A bounded LRU cache in front of afc_design(), keyed by the normalized
+ * spec: family, type, order, topology, impedance, frequency, plus ripple
+ * (Chebyshev and elliptic), stop-band loss (elliptic only), bandwidth
+ * (BP/BR only) and the cutoff normalization
+ * where the family has a choice. Specs that differ only in fields the
+ * design ignores share one entry. Failed designs are cached as well.
+ *
+ * The cache is split into shards, each an LRU list and hash chain under its
+ * own mutex, so concurrent callers rarely wait on each other. The design
+ * itself runs outside the lock.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_CACHE_H
+#define AFC_CACHE_H
+
+#include "afc.h"
+
+typedef struct afc_design_cache afc_design_cache;
+
+typedef struct {
+    long hits, misses;
+    long evictions;
+    long entries, capacity;
+} afc_cache_stats;
+
+// Cache holding up to capacity designs (at least one per shard); NULL if
+// out of memory.
+afc_design_cache *afc_cache_create(long capacity);
+void afc_cache_destroy(afc_design_cache *cache);
+
+// afc_design() through the cache. *hit (if not NULL) is set to 1 when the
+// result came from the cache.
+int afc_cache_design(afc_design_cache *cache, const afc_spec *spec, afc_element *out,
+                     int capacity, int *hit);
+
+// Counters summed over all shards.
+void afc_cache_get_stats(afc_design_cache *cache, afc_cache_stats *stats);
+
+#endif
@@ -0,0 +1,478 @@
+/*
+ * Analog Filter Calculator - prototype catalog and mask queries
+ * The curves come from the ladder itself: every prototype is denormalized
+ * to a 1 rad/s low-pass between 1 ohm terminations and swept with
+ * afc_ladder_response(), so the catalog describes exactly the ladders that
+ * afc_denormalize() will produce.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "afc_catalog.h"
+#include "afc_input.h"
+#include "afc_parallel.h"
+#include "afc_response.h"
+#include "afc_spec.h"
+
+#define K             AFC_CATALOG_POINTS
+#define G_WIDTH       (AFC_CATALOG_ORDER + 1)
+#define W_DC          1e-3     // where the DC delay is taken
+#define PASS_SLACK    1e-6     // dB; a ripple equal to the mask's passes
+#define BUILD_CHUNK   8
+
+// Chebyshev ripple grid: 0.001 dB steps to 0.01 dB, then 0.01 dB steps
+// to 0.1, 0.05 dB steps to 1 and 0.25 dB steps to 3 dB
+static int chebyshev_ripples(double *r) {
+    int n = 0;
+    for (int i = 1; i <= 10; i++) r[n++] = 0.001 * i;
+    for (int i = 2; i <= 10; i++) r[n++] = 0.01 * i;
+    for (int i = 3; i <= 20; i++) r[n++] = 0.05 * i;
+    for (int i = 5; i <= 12; i++) r[n++] = 0.25 * i;
+    return n;
+}
+
+static const double elliptic_ripples[] = { 0.01, 0.05, 0.1, 0.25, 0.5, 1.0 };
+#define ELLIPTIC_RIPPLES (int)(sizeof elliptic_ripples / sizeof elliptic_ripples[0])
+#define STOP_FIRST  20         // elliptic stop-band loss grid in dB
+#define STOP_LAST   100
+#define STOP_STEP   5
+
+static double grid_log_w(int k) {
+    return log(AFC_CATALOG_W_MIN) + k * log(AFC_CATALOG_W_MAX / AFC_CATALOG_W_MIN) / (K - 1);
+}
+
+static afc_norm family_norm(afc_family family) {
+    return family == AFC_CHEBYSHEV || family == AFC_ELLIPTIC ? AFC_NORM_RIPPLE : AFC_NORM_3DB;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Building                                                               */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    int32_t family, order, parts, valid;
+    double ripple, stop, size, reach;
+    double g[G_WIDTH], gz[AFC_CATALOG_ORDER];
+    double loss_max[K], loss_min[K], gd_var[K];
+} entry;
+
+static void build_entry(entry *e) {
+    double g[AFC_MAX_ORDER + 1] = { 0 }, gz[AFC_MAX_ORDER + 1] = { 0 };
+    double freq[K + 1], il[K + 1], gd[K + 1], f3dB, ws;
+    afc_element el[AFC_MAX_ORDER];
+    afc_spec spec = { .family = e->family, .type = AFC_LOWPASS, .order = e->order,
+                      .ripple_dB = e->ripple, .freq = 1 / (2 * AFC_M_PI), .topology = AFC_PI,
+                      .R = 1, .norm = family_norm(e->family), .stop_dB = e->stop };
+    int n = e->order, err;
+
+    e->valid = 0;
+    if (e->family == AFC_ELLIPTIC)
+        err = afc_elliptic_synthesize(n, e->ripple, e->stop, g, gz, &f3dB, &ws);
+    else
+        err = afc_prototype(e->family, n, e->ripple, spec.norm, g);
+    if (err != AFC_OK)
+        return;
+    int parts = afc_denormalize_zeros(&spec, g, gz, el, AFC_MAX_ORDER);
+    double RL = afc_load_impedance(&spec);
+    if (parts < 1 || !(RL > 0))
+        return;
+
+    freq[0] = W_DC / (2 * AFC_M_PI);
+    for (int k = 0; k < K; k++)
+        freq[k + 1] = exp(grid_log_w(k)) / (2 * AFC_M_PI);
+    afc_response out = { .il_dB = il, .gd = gd };
+    if (afc_ladder_response(el, parts, 1, RL, freq, K + 1, &out) != AFC_OK)
+        return;
+
+    double hi = il[0], lo = INFINITY, gmax = gd[0], gmin = gd[0];
+    for (int k = 0; k < K; k++) {
+        hi = fmax(hi, il[k + 1]);
+        gmax = fmax(gmax, gd[k + 1]);
+        gmin = fmin(gmin, gd[k + 1]);
+        e->loss_max[k] = hi;
+        e->gd_var[k] = (gmax - gmin) / gd[0];
+    }
+    for (int k = K - 1; k >= 0; k--)
+        e->loss_min[k] = lo = fmin(lo, il[k + 1]);
+    e->reach = e->loss_min[K - 1];
+
+    e->size = 0;
+    for (int i = 0; i < n; i++)
+        e->size += g[i] + gz[i];
+    e->parts = 0;
+    for (int i = 0; i < parts; i++)
+        e->parts += el[i].form == AFC_FORM_C || el[i].form == AFC_FORM_L ? 1 : 2;
+    memcpy(e->g, g, (n + 1) * sizeof *g);
+    memcpy(e->gz, gz, n * sizeof *gz);
+    e->valid = isfinite(e->size) && isfinite(hi) && isfinite(e->gd_var[K - 1]);
+}
+
+static void build_chunk(void *ctx, long begin, long end, int tid) {
+    entry *entries = ctx;
+    (void)tid;
+    for (long i = begin; i < end; i++)
+        build_entry(&entries[i]);
+}
+
+static int entry_cmp(const void *pa, const void *pb) {
+    const entry *a = *(const entry *const *)pa, *b = *(const entry *const *)pb;
+    if (a->order != b->order)
+        return a->order - b->order;
+    if (a->ripple != b->ripple)
+        return a->ripple < b->ripple ? -1 : 1;
+    if (a->family != b->family)
+        return a->family - b->family;
+    return (a->stop > b->stop) - (a->stop < b->stop);
+}
+
+static long grid(entry *e) {
+    double ripples[64];
+    int nr = chebyshev_ripples(ripples);
+    long count = 0;
+
+    for (int n = 1; n <= AFC_CATALOG_ORDER; n++) {
+        if (e) {
+            e[count++] = (entry){ .family = AFC_BUTTERWORTH, .order = n };
+            e[count++] = (entry){ .family = AFC_BESSEL, .order = n };
+        } else {
+            count += 2;
+        }
+        for (int r = 0; r < nr; r++, count++)
+            if (e)
+                e[count] = (entry){ .family = AFC_CHEBYSHEV, .order = n, .ripple = ripples[r] };
+        if (n < 2 || n > AFC_CATALOG_ELLIPTIC_ORDER)
+            continue;
+        for (int r = 0; r < ELLIPTIC_RIPPLES; r++)
+            for (int s = STOP_FIRST; s <= STOP_LAST; s += STOP_STEP, count++)
+                if (e)
+                    e[count] = (entry){ .family = AFC_ELLIPTIC, .order = n,
+                                        .ripple = elliptic_ripples[r], .stop = s };
+    }
+    return count;
+}
+
+enum { COL_FAMILY, COL_ORDER, COL_PARTS, COL_RIPPLE, COL_STOP, COL_SIZE, COL_REACH, COL_G, COL_GZ,
+       COL_LOSS_MAX, COL_LOSS_MIN, COL_GD_VAR, NCOLS };
+
+static const afc_sweep_layout layout[NCOLS] = {
+    { "family",   AFC_COL_I32, 1 },
+    { "order",    AFC_COL_I32, 1 },
+    { "parts",    AFC_COL_I32, 1 },
+    { "ripple",   AFC_COL_F64, 1 },
+    { "stop",     AFC_COL_F64, 1 },
+    { "size",     AFC_COL_F64, 1 },
+    { "reach",    AFC_COL_F64, 1 },
+    { "g",        AFC_COL_F64, G_WIDTH },
+    { "gz",       AFC_COL_F64, AFC_CATALOG_ORDER },
+    { "loss_max", AFC_COL_F64, K },
+    { "loss_min", AFC_COL_F64, K },
+    { "gd_var",   AFC_COL_F64, K },
+};
+
+int afc_catalog_build(const char *path, int threads) {
+    long count = grid(NULL), rows = 0;
+    entry *entries = malloc(count * sizeof *entries);
+    entry **sorted = malloc(count * sizeof *sorted);
+    afc_sweep_file f;
+    int rc;
+
+    if (!entries || !sorted) {
+        free(entries);
+        free(sorted);
+        return AFC_ERR_MEMORY;
+    }
+    grid(entries);
+    afc_parallel_for(count, BUILD_CHUNK, threads, build_chunk, entries);
+
+    // elliptic designs past the precision limit are left out
+    for (long i = 0; i < count; i++)
+        if (entries[i].valid)
+            sorted[rows++] = &entries[i];
+    qsort(sorted, rows, sizeof *sorted, entry_cmp);
+
+    if ((rc = afc_sweep_create(path, layout, NCOLS, (uint64_t)rows, &f)) == AFC_OK) {
+        void *col[NCOLS];
+        for (int c = 0; c < NCOLS; c++)
+            col[c] = afc_sweep_data(&f, &f.columns[c]);
+        for (long r = 0; r < rows; r++) {
+            const entry *e = sorted[r];
+            ((int32_t *)col[COL_FAMILY])[r] = e->family;
+            ((int32_t *)col[COL_ORDER])[r] = e->order;
+            ((int32_t *)col[COL_PARTS])[r] = e->parts;
+            ((double *)col[COL_RIPPLE])[r] = e->ripple;
+            ((double *)col[COL_STOP])[r] = e->stop;
+            ((double *)col[COL_SIZE])[r] = e->size;
+            ((double *)col[COL_REACH])[r] = e->reach;
+            memcpy((double *)col[COL_G] + r * G_WIDTH, e->g, sizeof e->g);
+            memcpy((double *)col[COL_GZ] + r * AFC_CATALOG_ORDER, e->gz, sizeof e->gz);
+            memcpy((double *)col[COL_LOSS_MAX] + r * K, e->loss_max, sizeof e->loss_max);
+            memcpy((double *)col[COL_LOSS_MIN] + r * K, e->loss_min, sizeof e->loss_min);
+            memcpy((double *)col[COL_GD_VAR] + r * K, e->gd_var, sizeof e->gd_var);
+        }
+        rc = afc_sweep_close(&f);
+    }
+    free(entries);
+    free(sorted);
+    return rc;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Opening                                                                */
+/* ---------------------------------------------------------------------- */
+
+void afc_catalog_close(afc_catalog *cat) {
+    if (cat->file.map)
+        afc_sweep_close(&cat->file);
+    memset(cat, 0, sizeof *cat);
+}
+
+int afc_catalog_open(const char *path, afc_catalog *cat) {
+    const void *col[NCOLS];
+    int rc;
+
+    memset(cat, 0, sizeof *cat);
+    if ((rc = afc_sweep_open(path, &cat->file)) != AFC_OK)
+        return rc;
+    for (int c = 0; c < NCOLS; c++) {
+        const afc_sweep_column *sc = afc_sweep_find(&cat->file, layout[c].name);
+        if (!sc || sc->type != (uint32_t)layout[c].type || sc->width != layout[c].width) {
+            afc_catalog_close(cat);
+            return AFC_ERR_FORMAT;
+        }
+        col[c] = afc_sweep_data(&cat->file, sc);
+    }
+    cat->rows = (long)cat->file.rows;
+    cat->family = col[COL_FAMILY];
+    cat->order = col[COL_ORDER];
+    cat->parts = col[COL_PARTS];
+    cat->ripple = col[COL_RIPPLE];
+    cat->stop = col[COL_STOP];
+    cat->size = col[COL_SIZE];
+    cat->reach = col[COL_REACH];
+    cat->g = col[COL_G];
+    cat->gz = col[COL_GZ];
+    cat->loss_max = col[COL_LOSS_MAX];
+    cat->loss_min = col[COL_LOSS_MIN];
+    cat->gd_var = col[COL_GD_VAR];
+
+    // the order index; rows must come sorted by order
+    long r = 0;
+    for (int o = 0; o <= AFC_CATALOG_ORDER + 1; o++) {
+        while (r < cat->rows && cat->order[r] < o)
+            r++;
+        cat->first[o] = r;
+    }
+    for (long i = 0; i < cat->rows; i++)
+        if (cat->order[i] < 1 || cat->order[i] > AFC_CATALOG_ORDER ||
+            (i && cat->order[i] < cat->order[i - 1])) {
+            afc_catalog_close(cat);
+            return AFC_ERR_FORMAT;
+        }
+    return AFC_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Queries                                                                */
+/* ---------------------------------------------------------------------- */
+
+// One frequency, or two as "f1:f2"
+static int parse_band(const char *s, double *v, int two) {
+    const char *end;
+    if (afc_scan_double(s, NULL, &v[0], &end))
+        return 0;
+    if (two) {
+        if (*end != ':' || afc_scan_double(end + 1, NULL, &v[1], &end))
+            return 0;
+    }
+    while (*end == ' ' || *end == '\t')
+        end++;
+    return *end == '\0';
+}
+
+const char *afc_mask_from_csv(char *line, afc_mask *mask) {
+    char *field[8] = { 0 };
+    int nf = 0;
+    double pct;
+
+    for (char *p = line; nf < 8; ) {
+        field[nf++] = p;
+        char *comma = strchr(p, ',');
+        if (!comma)
+            break;
+        *comma = '\0';
+        p = comma + 1;
+    }
+    for (int i = 0; i < 8; i++)
+        field[i] = field[i] ? afc_trim(field[i]) : "";
+    if (nf < 5)
+        return "too few fields";
+
+    memset(mask, 0, sizeof *mask);
+    if (!(mask->type = afc_type_from_name(field[0])))
+        return "unknown filter type";
+    int two = mask->type == AFC_BANDPASS || mask->type == AFC_BANDREJECT;
+    if (!parse_band(field[1], mask->pass, two))
+        return two ? "invalid pass band, expected f1:f2" : "invalid pass-band edge";
+    if (!parse_band(field[2], mask->stop, two))
+        return two ? "invalid stop band, expected f1:f2" : "invalid stop-band edge";
+    if (!afc_parse_number(field[3], 0, &mask->pass_dB))
+        return "invalid pass-band loss";
+    if (!afc_parse_number(field[4], 0, &mask->stop_dB))
+        return "invalid stop-band loss";
+    if (!(mask->topology = afc_topology_from_name(field[5][0] ? field[5] : "pi")))
+        return "unknown topology";
+    if (!afc_parse_number(field[6], 50.0, &mask->R))
+        return "invalid impedance";
+    if (!afc_parse_number(field[7], 0, &pct))
+        return "invalid delay tolerance";
+    mask->delay_tol = pct / 100;
+    return NULL;
+}
+
+// Ratio of stop- to pass-band edge on the prototype, as in afc_order.c,
+// or 0 if the mask is inconsistent.
+static double stop_ratio(const afc_mask *m) {
+    const double *p = m->pass, *s = m->stop;
+    double F = sqrt(p[0] * p[1]), B = p[1] - p[0];
+
+    switch (m->type) {
+    case AFC_LOWPASS:
+        return s[0] > p[0] ? s[0] / p[0] : 0;
+    case AFC_HIGHPASS:
+        return s[0] < p[0] ? p[0] / s[0] : 0;
+    case AFC_BANDPASS:
+        if (!(s[0] < p[0] && p[0] < p[1] && p[1] < s[1]))
+            return 0;
+        return fmin((F * F - s[0] * s[0]) / (s[0] * B), (s[1] * s[1] - F * F) / (s[1] * B));
+    case AFC_BANDREJECT:
+        if (!(p[0] < s[0] && s[0] < s[1] && s[1] < p[1]))
+            return 0;
+        return fmin(s[0] * B / (F * F - s[0] * s[0]), s[1] * B / (s[1] * s[1] - F * F));
+    default:
+        return 0;
+    }
+}
+
+// Linear interpolation of curve v at a (fractional) grid position x.
+static double curve_at(const double *v, double x) {
+    if (x <= 0)
+        return v[0];
+    if (x >= K - 1)
+        return v[K - 1];
+    int k = (int)x;
+    return v[k] + (x - k) * (v[k + 1] - v[k]);
+}
+
+// Grid position where loss_max first passes limit, or -1.
+static double pass_edge(const double *loss_max, double limit) {
+    if (loss_max[0] > limit || loss_max[K - 1] <= limit)
+        return -1;
+    int lo = 0, hi = K - 1;   // loss_max[lo] <= limit < loss_max[hi]
+    while (hi - lo > 1) {
+        int mid = (lo + hi) / 2;
+        if (loss_max[mid] > limit)
+            hi = mid;
+        else
+            lo = mid;
+    }
+    double t = (limit - PASS_SLACK - loss_max[lo]) / (loss_max[hi] - loss_max[lo]);
+    return lo + fmax(0, fmin(1, t));
+}
+
+static int better(const afc_candidate *a, const afc_candidate *b) {
+    if (a->spec.order != b->spec.order)
+        return a->spec.order < b->spec.order;
+    if (a->parts != b->parts)
+        return a->parts < b->parts;
+    return a->size < b->size;
+}
+
+int afc_catalog_query(const afc_catalog *cat, const afc_mask *mask, afc_candidate *out, int max) {
+    double ws = stop_ratio(mask);
+    double step = log(AFC_CATALOG_W_MAX / AFC_CATALOG_W_MIN) / (K - 1);
+    double limit = mask->pass_dB + PASS_SLACK;
+    int found = 0;
+
+    if (max < 1)
+        return AFC_ERR_ARGUMENT;
+    if (!(mask->pass[0] > 0) || !(mask->stop[0] > 0) || !(ws > 1))
+        return AFC_ERR_FREQ;
+    if (!(mask->pass_dB > 0) || !(mask->stop_dB > mask->pass_dB) || !(mask->R > 0) ||
+        mask->delay_tol < 0)
+        return AFC_ERR_ARGUMENT;
+
+    for (int o = 1; o <= AFC_CATALOG_ORDER && found < max; o++) {
+        // rows of this order are sorted by ripple: stop at the first too large
+        long lo = cat->first[o], hi = cat->first[o + 1];
+        for (long a = lo; a < hi; ) {
+            long mid = (a + hi) / 2;
+            if (cat->ripple[mid] <= limit)
+                a = mid + 1;
+            else
+                hi = mid;
+        }
+        for (long r = lo; r < hi; r++) {
+            if ((mask->family && cat->family[r] != (int32_t)mask->family) ||
+                cat->reach[r] < mask->stop_dB)
+                continue;
+            double x = pass_edge(cat->loss_max + r * K, limit);
+            if (x < 0)
+                continue;
+            double floor_dB = curve_at(cat->loss_min + r * K, x + log(ws) / step);
+            if (floor_dB < mask->stop_dB)
+                continue;
+            double var = curve_at(cat->gd_var + r * K, x);
+            if (mask->delay_tol > 0 && var > mask->delay_tol)
+                continue;
+
+            afc_candidate c = { .row = r, .parts = cat->parts[r], .size = cat->size[r],
+                                .edge = exp(log(AFC_CATALOG_W_MIN) + x * step),
+                                .margin_dB = floor_dB - mask->stop_dB, .delay_var = var };
+            afc_spec *s = &c.spec;
+            s->family = cat->family[r];
+            s->type = mask->type;
+            s->order = o;
+            s->ripple_dB = cat->ripple[r];
+            s->stop_dB = cat->stop[r];
+            s->topology = mask->topology;
+            s->R = mask->R;
+            s->norm = family_norm(s->family);
+            // put the prototype's edge W on the mask's pass-band edge
+            switch (mask->type) {
+            case AFC_LOWPASS:  s->freq = mask->pass[0] / c.edge; break;
+            case AFC_HIGHPASS: s->freq = mask->pass[0] * c.edge; break;
+            default:
+                s->freq = sqrt(mask->pass[0] * mask->pass[1]);
+                s->bw = (mask->pass[1] - mask->pass[0]);
+                s->bw = mask->type == AFC_BANDPASS ? s->bw / c.edge : s->bw * c.edge;
+                break;
+            }
+
+            // insert into the ranked list
+            int at = found < max ? found++ : max;
+            while (at > 0 && better(&c, &out[at - 1])) {
+                if (at < max)
+                    out[at] = out[at - 1];
+                at--;
+            }
+            if (at < max)
+                out[at] = c;
+        }
+    }
+    return found;
+}
+
+int afc_catalog_design(const afc_catalog *cat, const afc_candidate *c, afc_element *out,
+                       int capacity) {
+    if (c->row < 0 || c->row >= cat->rows)
+        return AFC_ERR_ARGUMENT;
+    const double *g = cat->g + c->row * G_WIDTH;
+    if (c->spec.family == AFC_ELLIPTIC)
+        return afc_denormalize_zeros(&c->spec, g, cat->gz + c->row * AFC_CATALOG_ORDER, out, capacity);
+    return afc_denormalize(&c->spec, g, out, capacity);
+}
@@ -0,0 +1,102 @@
+/*
+ * Analog Filter Calculator - prototype catalog and mask queries
+ * A catalog holds normalized low-pass prototypes of every family, built
+ * once and stored in a sweep file (afc_sweep.h): Butterworth and Bessel
+ * (-3 dB normalized) and Chebyshev over a ripple grid at every order up to
+ * AFC_CATALOG_ORDER, and elliptic over a ripple and stop-band grid up to
+ * AFC_CATALOG_ELLIPTIC_ORDER (both ripple-edge normalized).
+ *
+ * Besides its g (and elliptic gz) values, each row keeps three curves
+ * sampled at AFC_CATALOG_POINTS log-spaced frequencies W of the prototype:
+ *   loss_max  the largest loss from DC up to W, so the first W where it
+ *             passes a pass-band limit is the edge of the pass band
+ *   loss_min  the smallest loss from W up, the stop-band floor beyond W
+ *   gd_var    the spread of the group delay from DC up to W, relative to
+ *             the delay at DC
+ * All three are monotone, so checking a mask against a row takes a binary
+ * search and two lookups; the end of loss_min is also kept in a column of
+ * its own, which rules most rows out without touching their curves. Rows are sorted by order and then ripple, so a
+ * query walks the orders from the lowest and, within one, only the rows
+ * whose ripple fits the mask; it stops at the first order with enough
+ * matches. Matching rows are ranked by order, part count and then the
+ * sum of the normalized values (the smaller, the smaller the parts).
+ *
+ * A mask is mapped onto the low-pass prototype as in afc_order.h; a match
+ * is scaled so its pass-band edge lands on the mask's, and denormalized
+ * with afc_denormalize() or afc_denormalize_zeros().
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_CATALOG_H
+#define AFC_CATALOG_H
+
+#include <stdint.h>
+
+#include "afc.h"
+#include "afc_sweep.h"
+
+#define AFC_CATALOG_ORDER          32
+#define AFC_CATALOG_ELLIPTIC_ORDER 15
+#define AFC_CATALOG_POINTS         128
+#define AFC_CATALOG_W_MIN          0.05    // sampled W range of the curves
+#define AFC_CATALOG_W_MAX          50.0
+
+// Requirements, in Hz and dB
+typedef struct {
+    afc_type type;
+    double pass[2];        // pass-band edge (LP/HP), or lower and upper edges
+    double stop[2];        // stop-band edge, or lower and upper edges
+    double pass_dB;        // most loss in the pass band
+    double stop_dB;        // least loss in the stop band
+    double delay_tol;      // group delay spread in the pass band, as a
+                           // fraction of the DC delay (0: any)
+    afc_family family;     // 0: any
+    afc_topology topology;
+    double R;
+} afc_mask;
+
+typedef struct {
+    long row;              // in the catalog
+    afc_spec spec;         // the match, scaled to the mask
+    int parts;             // inductors and capacitors of its low-pass ladder
+    double size;           // sum of the normalized values
+    double edge;           // prototype W of the pass-band edge
+    double margin_dB;      // stop-band loss beyond the mask
+    double delay_var;      // group delay spread in the pass band
+} afc_candidate;
+
+typedef struct {
+    afc_sweep_file file;
+    long rows;
+    const int32_t *family, *order, *parts;
+    const double *ripple, *stop, *size;
+    const double *reach;                 // loss_min at W_MAX, the most any stop band gets
+    const double *g, *gz;
+    const double *loss_max, *loss_min, *gd_var;
+    long first[AFC_CATALOG_ORDER + 2];   // rows of order o are first[o] .. first[o + 1] - 1
+} afc_catalog;
+
+// Synthesize the whole grid (split across threads, 0 = all cores) and
+// write it to path.
+int afc_catalog_build(const char *path, int threads);
+
+// Map a catalog for queries; close it with afc_catalog_close().
+int afc_catalog_open(const char *path, afc_catalog *cat);
+void afc_catalog_close(afc_catalog *cat);
+
+// Parse a mask record
+//   type,pass,stop,pass_dB,stop_dB[,topology[,impedance[,delay %]]]
+// where pass and stop are "f1:f2" for BP and BR. Returns NULL or a message.
+const char *afc_mask_from_csv(char *line, afc_mask *mask);
+
+// The best at most max matches of the mask, best first. Returns the count
+// (0 if nothing in the catalog meets it) or an error.
+int afc_catalog_query(const afc_catalog *cat, const afc_mask *mask, afc_candidate *out, int max);
+
+// Ladder elements of a match. Returns the element count or an error.
+int afc_catalog_design(const afc_catalog *cat, const afc_candidate *c, afc_element *out,
+                       int capacity);
+
+#endif
@@ -0,0 +1,530 @@
+/*
+ * Analog Filter Calculator - elliptic (Cauer) ladder synthesis
+ * Equal-terminated ladder values for the elliptic approximation: shunt
+ * capacitors alternating with series parallel-LC tanks (PI form), each tank
+ * resonating at one transmission zero.
+ *
+ * The elliptic functions are evaluated from the nome q = exp(-pi K'/K)
+ * only: q from the modulus by its fast-converging series, the degree
+ * equation as q = q1^(1/n), and the modulus, the cd() zeros and the
+ * (complex) natural modes as ratios of theta series. No complete integral,
+ * Landen chain or polynomial root finder is needed and every series
+ * converges geometrically for the moduli that occur.
+ *
+ * Even orders use the type-c variant: the highest transmission zero moves
+ * to infinity and the lowest reflection zero to DC, so even orders are
+ * ladders with equal terminations as well (the stop-band edge moves up a
+ * little). The ladder comes from E(s)E(-s) = P(s)P(-s) + F(s)F(-s) by
+ * zero shifting: a partial shunt capacitor puts a zero of the remaining
+ * admittance on the next transmission zero, which the tank then removes.
+ * Every result is checked against the characteristic function.
+ *
+ * Masks that are nearly degenerate for the order, a small ripple and a
+ * low stop-band loss that put the stop-band edge close to the pass band,
+ * may have no ladder with positive elements: the last partial capacitor comes
+ * out negative in every zero order tried. This is a property of the
+ * ladder, not of the arithmetic, and returns AFC_ERR_ELLIPTIC. It hits odd
+ * orders first: the type-c even order above has the same tanks and one
+ * more shunt capacitor to spread the remainder over, so e.g. 0.01 dB
+ * ripple and 20 dB stop band fails at n = 7 and 9-11 but works at 8 and
+ * 12. Orders above about 13 lose too much precision at high stop-band
+ * loss for the termination to come out right; that returns
+ * AFC_ERR_PRECISION.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <complex.h>
+
+#include "afc.h"
+
+typedef long double real;
+typedef long double complex cplx;
+
+#define R_EPS 1e-17L
+#define HALF_ORDER (AFC_MAX_ORDER / 2 + 1)
+
+/* ---------------------------------------------------------------------- */
+/* Nome and theta functions                                               */
+/* ---------------------------------------------------------------------- */
+
+// Nome of a modulus below 1/sqrt(2): q = l + 2 l^5 + 15 l^9 + 150 l^13 + ...
+// with 2 l = (1 - sqrt(k')) / (1 + sqrt(k')), arranged so small k keep
+// their precision.
+static real nome_series(real k) {
+    real kc = sqrtl((1 - k) * (1 + k));
+    real skc = sqrtl(kc);
+    real l = k * k / ((1 + kc) * (1 + skc) * 2 * (1 + skc));
+    real l4 = l * l * l * l;
+    return l * (1 + l4 * (2 + l4 * (15 + l4 * (150 + l4 * 1707))));
+}
+
+// ln q(k) for 0 < k < 1, through ln q(k) ln q(k') = pi^2 above 1/sqrt(2)
+static real log_nome(real k) {
+    if (k * k <= 0.5L)
+        return logl(nome_series(k));
+    return (real)(AFC_M_PI * AFC_M_PI) / logl(nome_series(sqrtl((1 - k) * (1 + k))));
+}
+
+/*
+ * theta2(z) / theta3(z) of nome q, z in units of pi/2K (complex off the real
+ * axis, where the poles lie). Both series run over cos(j z) with weights
+ * q^(j^2/4), odd j for theta2 and even j for theta3, so one recurrence
+ * serves both.
+ */
+static cplx theta_ratio(real q, cplx z) {
+    cplx c1 = ccosl(z), cj = c1, cprev = 1;   // cos(j z), cos((j-1) z)
+    real w = sqrtl(sqrtl(q)), ratio = w, qh = sqrtl(q);
+    cplx t2 = 0, t3 = 0;
+    for (int j = 1; j < 400; j++) {
+        if (j % 2)
+            t2 += w * cj;
+        else
+            t3 += w * cj;
+        if (w * (fabsl(creall(cj)) + fabsl(cimagl(cj))) < R_EPS * R_EPS)
+            break;
+        cplx next = 2 * c1 * cj - cprev;
+        cprev = cj;
+        cj = next;
+        ratio *= qh;
+        w *= ratio;
+    }
+    return 2 * t2 / (1 + 2 * t3);
+}
+
+/*
+ * Order-n modulus k (pass-band to stop-band edge) and nome for the
+ * discrimination k1 = eps_p / eps_s: q(k) = q(k1)^(1/n), k = (theta2 / theta3)^2.
+ */
+static real degree_nome(int n, real k1, real *k) {
+    real q = expl(log_nome(k1) / n);
+    real r = creall(theta_ratio(q, 0));
+    *k = r * r;
+    return q;
+}
+
+// cd(u, k) at u = z 2K / pi, as theta2(z) / (sqrt(k) theta3(z))
+static cplx cd_theta(real q, real sk, cplx z) {
+    return theta_ratio(q, z) / sk;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Real polynomials, ascending coefficients                               */
+/* ---------------------------------------------------------------------- */
+
+static cplx poly_eval(const real *c, int deg, cplx s) {
+    cplx v = c[deg];
+    for (int k = deg - 1; k >= 0; k--)
+        v = v * s + c[k];
+    return v;
+}
+
+// p *= (s^2 + w); returns the new degree
+static int mul_quad(real *p, int deg, real w) {
+    p[deg + 2] = 0;
+    p[deg + 1] = 0;
+    for (int k = deg + 2; k >= 0; k--)
+        p[k] = (k >= 2 ? p[k-2] : 0) + w * p[k];
+    return deg + 2;
+}
+
+// p /= (s^2 + w), dropping the (tiny) remainder; returns the new degree
+static int div_quad(real *p, int deg, real w) {
+    real q[AFC_MAX_ORDER + 3];
+    for (int k = deg - 2; k >= 0; k--)
+        q[k] = p[k+2] - (k + 2 <= deg - 2 ? w * q[k+2] : 0);
+    for (int k = 0; k <= deg - 2; k++)
+        p[k] = q[k];
+    p[deg] = p[deg - 1] = 0;
+    return deg - 2;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Characteristic function                                                */
+/* ---------------------------------------------------------------------- */
+
+/*
+ * K(s) = h s^odd prod(s^2 + X_i) / prod(s^2 + W_j): X the squared
+ * reflection zeros, W the squared transmission zeros, the pass-band edge
+ * at 1 with |K(j)| = eps.
+ */
+typedef struct {
+    int n, odd;
+    int nx, nw;
+    real X[HALF_ORDER], W[HALF_ORDER];
+    real h;
+    real ws;      // stop-band edge
+    real q, sk;   // nome and sqrt of the order-n modulus
+    real a, b, c; // y -> (y - c) / (a - b y) from the standard to this form
+} elliptic_char;
+
+static int characteristic(int n, real ripple_dB, real stop_dB, elliptic_char *kc) {
+    real eps = sqrtl(powl(10, ripple_dB / 10) - 1);
+    real eps_s = sqrtl(powl(10, stop_dB / 10) - 1);
+    real k, q = degree_nome(n, eps / eps_s, &k);
+    real x[HALF_ORDER];
+    int half = n / 2;
+
+    if (!(k > 0) || !(k < 1))
+        return AFC_ERR_PRECISION;
+    // positive zeros of the elliptic rational function, cd((2i-1)K/n), descending
+    for (int i = 0; i < half; i++)
+        x[i] = creall(cd_theta(q, sqrtl(k), (real)(AFC_M_PI * (2 * i + 1) / (2 * n))));
+
+    kc->n = n;
+    kc->odd = n % 2;
+    kc->nx = kc->nw = 0;
+    kc->ws = 1 / k;
+    kc->q = q;
+    kc->sk = sqrtl(k);
+    kc->a = 1;
+    kc->b = kc->c = 0;
+    if (kc->odd) {
+        for (int i = 0; i < half; i++) {
+            kc->X[kc->nx++] = x[i] * x[i];
+            kc->W[kc->nw++] = 1 / (k * k * x[i] * x[i]);
+        }
+    } else {
+        /*
+         * Type c: x^2 = (a W + c) / (1 + b W) keeps the edge at 1, sends the
+         * smallest zero x_m to 0 and the largest pole 1/(k x_m) to infinity.
+         */
+        real xm2 = x[half-1] * x[half-1];
+        real xp2 = 1 / (k * k * xm2);
+        real b = (1 - xm2) / (xp2 - 1), a = b * xp2, c = xm2;
+        for (int i = 0; i < half; i++) {
+            real y = x[i] * x[i];
+            kc->X[kc->nx++] = i == half - 1 ? 0 : (y - c) / (a - b * y);
+            if (i < half - 1) {
+                real p = 1 / (k * k * y);
+                kc->W[kc->nw++] = (p - c) / (a - b * p);
+            }
+        }
+        real ys = 1 / (k * k);
+        kc->ws = sqrtl((ys - c) / (a - b * ys));
+        kc->a = a;
+        kc->b = b;
+        kc->c = c;
+    }
+
+    real fj = 1, pj = 1;
+    for (int i = 0; i < kc->nx; i++)
+        fj *= fabsl(kc->X[i] - 1);
+    for (int j = 0; j < kc->nw; j++)
+        pj *= fabsl(kc->W[j] - 1);
+    kc->h = eps * pj / fj;
+    return AFC_OK;
+}
+
+// |K(j w)|^2
+static real char_mag2(const elliptic_char *kc, real w) {
+    real v = kc->h * kc->h * (kc->odd ? w * w : 1);
+    for (int i = 0; i < kc->nx; i++)
+        v *= (kc->X[i] - w * w) * (kc->X[i] - w * w);
+    for (int j = 0; j < kc->nw; j++)
+        v /= (kc->W[j] - w * w) * (kc->W[j] - w * w);
+    return v;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Ladder extraction                                                      */
+/* ---------------------------------------------------------------------- */
+
+// |K|^2 at the squared frequency y of the standard form (complex off the axis)
+static real char_mag2_std(const elliptic_char *kc, cplx y) {
+    cplx Y = (y - kc->c) / (kc->a - kc->b * y);
+    real yr = creall(Y), yi = cimagl(Y);
+    real v = kc->h * kc->h * (kc->odd ? sqrtl(yr * yr + yi * yi) : 1);
+    for (int i = 0; i < kc->nx; i++)
+        v *= (kc->X[i] - yr) * (kc->X[i] - yr) + yi * yi;
+    for (int j = 0; j < kc->nw; j++)
+        v /= (kc->W[j] - yr) * (kc->W[j] - yr) + yi * yi;
+    return v;
+}
+
+/*
+ * Hurwitz E(s) with E(s)E(-s) = P(s)P(-s) + F(s)F(-s); returns 0 on failure.
+ * The natural modes are j cd((2i-1)K/n - j v K) of the standard form: v is
+ * the one offset from the real axis where |K| = 1 (it rises monotonically
+ * from the reflection zero to the pole at v = K'/K), found by bisection,
+ * and the type-c map then moves them like the zeros.
+ */
+static int hurwitz_e(const elliptic_char *kc, real *E) {
+    cplx z[AFC_MAX_ORDER];
+    int n = kc->n;
+    real lo = 0, hi = -logl(kc->q) / 2;   // v in units of pi/2K
+
+    for (int it = 0; it < 200 && hi - lo > R_EPS * hi; it++) {
+        real mid = (lo + hi) / 2;
+        cplx w = cd_theta(kc->q, kc->sk, (real)(AFC_M_PI / (2 * n)) - I * mid);
+        if (char_mag2_std(kc, w * w) < 1)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    // s^2 = -y of each mode, mapped
+    for (int i = 0; i < n; i++) {
+        cplx w = cd_theta(kc->q, kc->sk, (real)(AFC_M_PI * (2 * i + 1) / (2 * n)) - I * lo);
+        z[i] = -(w * w - kc->c) / (kc->a - kc->b * w * w);
+    }
+
+    // E = h prod(s - s_r) over the left-half-plane square roots, real
+    // roots as linear factors and conjugate pairs as quadratics
+    int deg = 0;
+    E[0] = kc->h;
+    for (int r = 0; r < n; r++) {
+        cplx s = csqrtl(z[r]);
+        if (creall(s) > 0)
+            s = -s;
+        if (!(creall(s) < 0))
+            return 0;
+        if (fabsl(cimagl(s)) <= 1e-12L * cabsl(s)) {
+            E[deg + 1] = 0;
+            for (int k = deg + 1; k >= 0; k--)
+                E[k] = (k ? E[k-1] : 0) - creall(s) * E[k];
+            deg++;
+        } else if (cimagl(s) > 0) {
+            real b = -2 * creall(s), c = creall(s) * creall(s) + cimagl(s) * cimagl(s);
+            E[deg + 1] = E[deg + 2] = 0;
+            for (int k = deg + 2; k >= 0; k--)
+                E[k] = (k >= 2 ? E[k-2] : 0) + (k >= 1 ? b * E[k-1] : 0) + c * E[k];
+            deg += 2;
+        }
+    }
+    return deg == n;
+}
+
+// w where |K(jw)| = 1, between the pass-band edge and the first zero
+static real corner_3db(const elliptic_char *kc) {
+    real lo = 1, hi = 2;
+    if (char_mag2(kc, 1) >= 1)
+        return 1;
+    for (int j = 0; j < kc->nw; j++)
+        if (sqrtl(kc->W[j]) < hi || j == 0)
+            hi = sqrtl(kc->W[j]);
+    if (kc->nw == 0)
+        while (char_mag2(kc, hi) < 1)
+            hi *= 2;
+    for (int it = 0; it < 200 && hi - lo > R_EPS * hi; it++) {
+        real mid = (lo + hi) / 2;
+        if (char_mag2(kc, mid) < 1)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return (lo + hi) / 2;
+}
+
+/*
+ * Expand Y = (E + F) / (E - F) for the given order of transmission zeros.
+ * g and gz as for afc_elliptic_synthesize(); returns 1, -1 if an element
+ * came out negative or zero, 0 if the expansion lost its precision.
+ */
+static int extract(const elliptic_char *kc, const real *E, const int *zorder, double *g, double *gz) {
+    real N[AFC_MAX_ORDER + 3] = {0}, Dn[AFC_MAX_ORDER + 3] = {0}, F[AFC_MAX_ORDER + 3] = {0};
+    int n = kc->n, dn, dd, e = 0;
+
+    // F = h s^odd prod(s^2 + X), with the sign that gives E - F degree n-1
+    int df = kc->odd;
+    F[df] = kc->h;
+    for (int i = 0; i < kc->nx; i++)
+        df = mul_quad(F, df, kc->X[i]);
+    for (int k = 0; k <= n; k++) {
+        N[k] = E[k] + F[k];
+        Dn[k] = E[k] - F[k];
+    }
+    Dn[n] = 0;
+    dn = n;
+    dd = n - 1;
+
+    for (int z = 0; z < kc->nw; z++) {
+        real W = kc->W[zorder[z]], w = sqrtl(W);
+        cplx jw = I * w;
+
+        // partial shunt C: Y - s Cp vanishes at jw
+        real Cp = creall(poly_eval(N, dn, jw) / (jw * poly_eval(Dn, dd, jw)));
+        for (int k = dn; k >= 1; k--)
+            N[k] -= Cp * Dn[k-1];
+        dn = div_quad(N, dn, W);
+
+        // the impedance now has a pole at jw: remove it as a tank
+        real A = creall(poly_eval(Dn, dd, jw) / (jw * poly_eval(N, dn, jw)));
+        for (int k = dn + 1; k >= 1; k--)
+            Dn[k] -= A * N[k-1];
+        dd = div_quad(Dn, dd, W);
+
+        g[e] = (double)Cp;
+        gz[e++] = 0;
+        g[e] = (double)(A / W);   // L of the tank; its C is 1/A
+        gz[e++] = (double)(1 / A);
+    }
+
+    // poles at infinity: shunt C, series L, ... down to the termination
+    real *num = N, *den = Dn;
+    int d = dd;
+    while (e < n) {
+        real v = num[d+1] / den[d];
+        g[e] = (double)v;
+        gz[e++] = 0;
+        // num - v s den: the top two terms cancel, leaving degree d-1
+        for (int k = 1; k <= d; k++)
+            num[k] -= v * den[k-1];
+        if (d == 0)
+            break;
+        real *t = num;
+        num = den;
+        den = t;
+        d--;
+    }
+    // the remainder is the load immittance; g(n+1) is its reciprocal
+    g[n] = (double)(den[0] / num[0]);
+    gz[n] = 0;
+
+    if (e != n)
+        return 0;
+    for (int i = 0; i < n; i++)
+        if (!isfinite(g[i]) || !isfinite(gz[i]))
+            return 0;
+    for (int i = 0; i < n; i++)
+        if (!(g[i] > 0) || !(gz[i] >= 0))
+            return -1;
+    return fabs(g[n] - 1) < 1e-6;
+}
+
+// |S21|^2 of the ladder against 1 / (1 + |K|^2) around the pass band; the
+// tolerance has an absolute floor, since deep in the stop band the double
+// element values cannot reproduce the loss to a relative one
+static int ladder_matches(const elliptic_char *kc, const double *g, const double *gz) {
+    static const double wt[6] = {0.3, 0.7, 1.0, 1.05, 1.2, 2.0};
+
+    for (int p = 0; p < 6; p++) {
+        cplx s = I * (real)wt[p];
+        cplx A = 1, B = 0, C = 0, D = 1;
+        for (int e = 0; e < kc->n; e++) {
+            if (e % 2 == 0) {    // shunt C
+                cplx y = s * (real)g[e];
+                A += B * y;
+                C += D * y;
+            } else {             // series L, or a tank with gz as its C
+                cplx z = gz[e] > 0 ? 1 / (1 / (s * (real)g[e]) + s * (real)gz[e]) : s * (real)g[e];
+                B += A * z;
+                D += C * z;
+            }
+        }
+        real got = 4 / (cabsl(A + B + C + D) * cabsl(A + B + C + D));
+        real want = 1 / (1 + char_mag2(kc, wt[p]));
+        if (!(fabsl(got - want) <= 1e-5L * want + 1e-12L))
+            return 0;
+    }
+    return 1;
+}
+
+/*
+ * Synthesize the order-n elliptic ladder for 1 ohm terminations, normalized
+ * to the ripple band edge: g[0..n-1] element values from the source (shunt
+ * C first), g[n] the load termination (1); gz[i] is the capacitance
+ * resonating with series inductor g[i] (0 for plain elements). *f3dB
+ * receives the -3 dB frequency and *ws the stop-band edge, both relative
+ * to the ripple edge.
+ */
+int afc_elliptic_synthesize(int n, double ripple_dB, double stop_dB, double *g, double *gz,
+                            double *f3dB, double *ws) {
+    elliptic_char kc;
+    real E[AFC_MAX_ORDER + 3];
+    int zorder[HALF_ORDER];
+    int err;
+
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    if (!(ripple_dB > 0) || ripple_dB > 20)
+        return AFC_ERR_RIPPLE;
+    if (!(stop_dB > ripple_dB) || stop_dB > 300)
+        return AFC_ERR_STOPBAND;
+    if ((err = characteristic(n, ripple_dB, stop_dB, &kc)) != AFC_OK)
+        return err;
+    if (!hurwitz_e(&kc, E))
+        return AFC_ERR_PRECISION;
+
+    /*
+     * Order of the zeros along the ladder: the lowest (W is ascending) in
+     * the middle and the others alternating outwards keeps the partial
+     * capacitors positive; ascending and descending order are fallbacks.
+     */
+    int m = kc.nw, mid = (m - 1) / 2, ok = 0, negative = 1;
+    for (int attempt = 0; attempt < 3 && !ok; attempt++) {
+        for (int j = 0; j < m; j++) {
+            int d = (j + 1) / 2;
+            int pos = attempt == 0 ? (j % 2 ? mid + d : mid - d) : attempt == 1 ? j : m - 1 - j;
+            zorder[pos] = j;
+        }
+        int got = extract(&kc, E, zorder, g, gz);
+        negative &= got < 0;
+        ok = got > 0 && ladder_matches(&kc, g, gz);
+    }
+    if (!ok)
+        return negative ? AFC_ERR_ELLIPTIC : AFC_ERR_PRECISION;
+
+    *f3dB = (double)corner_3db(&kc);
+    *ws = (double)kc.ws;
+    return AFC_OK;
+}
+
+/*
+ * Smallest order whose stop-band edge is at or below ws, for the ripple
+ * and stop-band loss: n >= ln q(k1) / ln q(1/ws) for odd orders; an even
+ * order is accepted only if its type-c edge also fits.
+ */
+int afc_elliptic_order(double ripple_dB, double stop_dB, double ws) {
+    if (!(ripple_dB > 0) || ripple_dB > 20)
+        return AFC_ERR_RIPPLE;
+    if (!(stop_dB > ripple_dB) || stop_dB > 300)
+        return AFC_ERR_STOPBAND;
+    if (!(ws > 1))
+        return AFC_ERR_FREQ;
+
+    real eps = sqrtl(powl(10, (real)ripple_dB / 10) - 1);
+    real eps_s = sqrtl(powl(10, (real)stop_dB / 10) - 1);
+    real ratio = log_nome(eps / eps_s) / log_nome(1 / (real)ws);
+    int n = (int)ceill(ratio - 1e-9L);
+    if (n < 1)
+        n = 1;
+    for (; n <= AFC_MAX_ORDER; n++) {
+        elliptic_char kc;
+        double g[AFC_MAX_ORDER + 1], gz[AFC_MAX_ORDER + 1], f3dB, edge;
+        if (characteristic(n, ripple_dB, stop_dB, &kc) != AFC_OK)
+            return AFC_ERR_PRECISION;
+        if (kc.ws > ws * (1 + 1e-12))
+            continue;
+        // a nearly degenerate mask may have no ladder at this order
+        int err = afc_elliptic_synthesize(n, ripple_dB, stop_dB, g, gz, &f3dB, &edge);
+        if (err != AFC_ERR_ELLIPTIC)
+            return n;
+    }
+    return AFC_ERR_ORDER;
+}
+
+/*
+ * Loss in dB of the order-n elliptic response at w, in units of the ripple
+ * edge (AFC_NORM_RIPPLE) or of the -3 dB frequency (any other norm).
+ */
+int afc_elliptic_loss(int n, double ripple_dB, double stop_dB, afc_norm norm, double w,
+                      double *atten_dB) {
+    elliptic_char kc;
+    int err;
+
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    if (!(ripple_dB > 0) || ripple_dB > 20)
+        return AFC_ERR_RIPPLE;
+    if (!(stop_dB > ripple_dB) || stop_dB > 300)
+        return AFC_ERR_STOPBAND;
+    if (!(w >= 0))
+        return AFC_ERR_FREQ;
+    if ((err = characteristic(n, ripple_dB, stop_dB, &kc)) != AFC_OK)
+        return err;
+    real x = norm == AFC_NORM_RIPPLE ? w : w * corner_3db(&kc);
+    *atten_dB = (double)(10 * log10l(1 + char_mag2(&kc, x)));
+    return AFC_OK;
+}
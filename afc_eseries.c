@@ -0,0 +1,205 @@
+/*
+ * Analog Filter Calculator - IEC 60063 preferred values
+ * Each table is the series mantissas repeated over DECADES decades; a value
+ * is computed from its index, so the sorted table needs no storage.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+
+#include "afc_eseries.h"
+
+#define DECADES 18   // 1e-15 .. 1e2 times the mantissa
+
+static const short e12[] = {
+    10, 12, 15, 18, 22, 27, 33, 39, 47, 56, 68, 82
+};
+
+static const short e24[] = {
+    10, 11, 12, 13, 15, 16, 18, 20, 22, 24, 27, 30,
+    33, 36, 39, 43, 47, 51, 56, 62, 68, 75, 82, 91
+};
+
+static const short e48[] = {
+    100, 105, 110, 115, 121, 127, 133, 140, 147, 154, 162, 169,
+    178, 187, 196, 205, 215, 226, 237, 249, 261, 274, 287, 301,
+    316, 332, 348, 365, 383, 402, 422, 442, 464, 487, 511, 536,
+    562, 590, 619, 649, 681, 715, 750, 787, 825, 866, 909, 953
+};
+
+static const short e96[] = {
+    100, 102, 105, 107, 110, 113, 115, 118, 121, 124, 127, 130,
+    133, 137, 140, 143, 147, 150, 154, 158, 162, 165, 169, 174,
+    178, 182, 187, 191, 196, 200, 205, 210, 215, 221, 226, 232,
+    237, 243, 249, 255, 261, 267, 274, 280, 287, 294, 301, 309,
+    316, 324, 332, 340, 348, 357, 365, 374, 383, 392, 402, 412,
+    422, 432, 442, 453, 464, 475, 487, 499, 511, 523, 536, 549,
+    562, 576, 590, 604, 619, 634, 649, 665, 681, 698, 715, 732,
+    750, 768, 787, 806, 825, 845, 866, 887, 909, 931, 953, 976
+};
+
+static const double decade[DECADES] = {
+    1e-15, 1e-14, 1e-13, 1e-12, 1e-11, 1e-10, 1e-9, 1e-8, 1e-7,
+    1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2
+};
+
+static const short *mantissas(afc_eseries series, double *scale) {
+    *scale = series >= AFC_E48 ? 100 : 10;
+    switch (series) {
+    case AFC_E12: return e12;
+    case AFC_E24: return e24;
+    case AFC_E48: return e48;
+    case AFC_E96: return e96;
+    }
+    return 0;
+}
+
+int afc_eseries_size(afc_eseries series) {
+    double scale;
+    return mantissas(series, &scale) ? (int)series * DECADES : 0;
+}
+
+double afc_eseries_value(afc_eseries series, int i) {
+    double scale;
+    const short *m = mantissas(series, &scale);
+    return m[i % series] * decade[i / series] / scale;
+}
+
+int afc_eseries_lower_bound(afc_eseries series, double x) {
+    int lo = 0, hi = afc_eseries_size(series);
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (afc_eseries_value(series, mid) < x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+double afc_eseries_nearest(afc_eseries series, double x) {
+    int size = afc_eseries_size(series);
+    int i = afc_eseries_lower_bound(series, x);
+    if (i == 0)
+        return afc_eseries_value(series, 0);
+    if (i == size)
+        return afc_eseries_value(series, size - 1);
+    double below = afc_eseries_value(series, i - 1), above = afc_eseries_value(series, i);
+    return x * x < below * above ? below : above;   // compare on a log scale
+}
+
+/* ---------------------------------------------------------------------- */
+/* Candidates                                                             */
+/* ---------------------------------------------------------------------- */
+
+// Best two-part realizations below (0) and above (1) x
+typedef struct {
+    afc_part pair[2][AFC_MAX_CANDIDATES];
+    int npair[2];
+    double x;
+} option_set;
+
+static double rel_error(double v, double x) {
+    return fabs(log(v / x));
+}
+
+// Keep the best AFC_MAX_CANDIDATES pairs on each side, sorted by error.
+static void add_pair(option_set *o, double a, double b, afc_combo combo) {
+    afc_part p = { combo == AFC_COMBO_SUM ? a + b : a * b / (a + b), a, b, combo };
+    int side = p.value > o->x;
+    afc_part *list = o->pair[side];
+    int *n = &o->npair[side];
+    double err = rel_error(p.value, o->x);
+
+    for (int k = 0; k < *n; k++)
+        if (fabs(list[k].value - p.value) <= 1e-12 * p.value)
+            return;
+    if (*n == AFC_MAX_CANDIDATES && err >= rel_error(list[*n - 1].value, o->x))
+        return;
+    int k = *n < AFC_MAX_CANDIDATES ? (*n)++ : *n - 1;
+    while (k > 0 && rel_error(list[k - 1].value, o->x) > err) {
+        list[k] = list[k - 1];
+        k--;
+    }
+    list[k] = p;
+}
+
+// Both table neighbours of rem as the second part of a pair with a.
+static void add_partners(option_set *o, afc_eseries series, double a, double rem, afc_combo combo) {
+    int size = afc_eseries_size(series);
+    int j = afc_eseries_lower_bound(series, rem);
+    if (j > 0)
+        add_pair(o, a, afc_eseries_value(series, j - 1), combo);
+    if (j < size)
+        add_pair(o, a, afc_eseries_value(series, j), combo);
+}
+
+int afc_eseries_candidates(afc_eseries series, double x, int pairs, afc_part *out, int max) {
+    int size = afc_eseries_size(series);
+    option_set o = { .x = x };
+    int count = 0;
+
+    if (size == 0 || !(x > 0) || max < 1)
+        return 0;
+    if (max > AFC_MAX_CANDIDATES)
+        max = AFC_MAX_CANDIDATES;
+
+    int i = afc_eseries_lower_bound(series, x);
+    if (i < size && afc_eseries_value(series, i) == x) {
+        // an exact standard value needs no alternatives
+        out[0] = (afc_part){ x, x, 0, AFC_COMBO_SINGLE };
+        return 1;
+    }
+
+    if (pairs) {
+        // a + b = x with the larger part a in [x/2, x)
+        for (int k = i - 1; k >= 0 && afc_eseries_value(series, k) >= x / 2; k--) {
+            double a = afc_eseries_value(series, k);
+            add_partners(&o, series, a, x - a, AFC_COMBO_SUM);
+        }
+        // 1/a + 1/b = 1/x with the smaller part a in (x, 2x]
+        for (int k = i; k < size && afc_eseries_value(series, k) <= 2 * x; k++) {
+            double a = afc_eseries_value(series, k);
+            add_partners(&o, series, a, a * x / (a - x), AFC_COMBO_RECIP);
+        }
+    }
+
+    // the single parts either side always come first
+    if (i > 0) {
+        double v = afc_eseries_value(series, i - 1);
+        out[count++] = (afc_part){ v, v, 0, AFC_COMBO_SINGLE };
+    }
+    if (i < size && count < max) {
+        double v = afc_eseries_value(series, i);
+        out[count++] = (afc_part){ v, v, 0, AFC_COMBO_SINGLE };
+    }
+
+    // then the best pairs, alternating sides, if they beat the single there
+    int next[2] = {0, 0};
+    for (int side = 0; count < max && (next[0] < o.npair[0] || next[1] < o.npair[1]); side ^= 1) {
+        if (next[side] >= o.npair[side])
+            continue;
+        afc_part *p = &o.pair[side][next[side]++];
+        int worse = 0;
+        for (int k = 0; k < count; k++)
+            if (out[k].combo == AFC_COMBO_SINGLE && (out[k].value > x) == side &&
+                rel_error(out[k].value, x) <= rel_error(p->value, x))
+                worse = 1;
+        if (!worse)
+            out[count++] = *p;
+    }
+
+    // closest first
+    for (int a = 1; a < count; a++) {
+        afc_part t = out[a];
+        int k = a;
+        while (k > 0 && rel_error(out[k - 1].value, x) > rel_error(t.value, x)) {
+            out[k] = out[k - 1];
+            k--;
+        }
+        out[k] = t;
+    }
+    return count;
+}
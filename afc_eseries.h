@@ -0,0 +1,53 @@
+/*
+ * Analog Filter Calculator - IEC 60063 preferred values
+ * E12/E24/E48/E96 series over 1e-15 .. 1e3 (fF to kH), looked up by binary
+ * search, and the two-part series/parallel combinations that land closer
+ * to an ideal value than a single part.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_ESERIES_H
+#define AFC_ESERIES_H
+
+typedef enum {
+    AFC_E12 = 12,
+    AFC_E24 = 24,
+    AFC_E48 = 48,
+    AFC_E96 = 96
+} afc_eseries;
+
+// How a realized value is built from standard parts
+typedef enum {
+    AFC_COMBO_SINGLE = 0,  // a
+    AFC_COMBO_SUM    = 1,  // a + b: parallel capacitors, series inductors
+    AFC_COMBO_RECIP  = 2   // 1/(1/a + 1/b): series capacitors, parallel inductors
+} afc_combo;
+
+typedef struct {
+    double value;          // realized value
+    double a, b;           // standard parts, b = 0 for a single part
+    afc_combo combo;
+} afc_part;
+
+#define AFC_MAX_CANDIDATES 8
+
+// Number of values in the table of a series (0 if series is not valid).
+int afc_eseries_size(afc_eseries series);
+
+// i-th value of the sorted table, 0 <= i < afc_eseries_size(series).
+double afc_eseries_value(afc_eseries series, int i);
+
+// Index of the first table value >= x (afc_eseries_size() if none).
+int afc_eseries_lower_bound(afc_eseries series, double x);
+
+// Standard value closest to x on a log scale.
+double afc_eseries_nearest(afc_eseries series, double x);
+
+// Realizations of x close to it: the best below and above, singles and,
+// when pairs is set, two-part combinations, up to max (<= AFC_MAX_CANDIDATES)
+// sorted by relative error. Returns the number written.
+int afc_eseries_candidates(afc_eseries series, double x, int pairs, afc_part *out, int max);
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * Analog Filter Calculator - fast Fourier transform
+ * Iterative decimation in time: bit-reversal permutation, then log2 n
+ * passes of butterflies. The twiddle factors of the widest pass are made
+ * once per call with a rotation recurrence refreshed from sin/cos every
+ * 64 steps, and the narrower passes take every second, fourth, ... one.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "afc.h"
+#include "afc_fft.h"
+
+static int power_of_two(long n) {
+    return n >= 2 && (n & (n - 1)) == 0;
+}
+
+// wr[k] + j wi[k] = e^(sign 2 pi j k / n) for k < n/2
+static void twiddles(long n, double sign, double *wr, double *wi) {
+    double step = sign * 2 * AFC_M_PI / n, cs = cos(step), sn = sin(step);
+    for (long k = 0; k < n / 2; k++) {
+        if (k % 64 == 0) {
+            wr[k] = cos(step * k);
+            wi[k] = sin(step * k);
+        } else {
+            wr[k] = wr[k - 1] * cs - wi[k - 1] * sn;
+            wi[k] = wr[k - 1] * sn + wi[k - 1] * cs;
+        }
+    }
+}
+
+static void bit_reverse(double *re, double *im, long n) {
+    for (long i = 1, j = 0; i < n; i++) {
+        long bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j |= bit;
+        if (i < j) {
+            double t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+}
+
+static void butterflies(double *re, double *im, long n, const double *wr, const double *wi) {
+    for (long len = 2; len <= n; len <<= 1) {
+        long half = len / 2, stride = n / len;
+        for (long s = 0; s < n; s += len)
+            for (long k = 0; k < half; k++) {
+                double cr = wr[k * stride], ci = wi[k * stride];
+                long a = s + k, b = a + half;
+                double tr = re[b] * cr - im[b] * ci;
+                double ti = re[b] * ci + im[b] * cr;
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+    }
+}
+
+int afc_fft(double *re, double *im, long n, int inverse) {
+    if (!power_of_two(n))
+        return AFC_ERR_ARGUMENT;
+    double *w = malloc(n * sizeof *w);
+    if (!w)
+        return AFC_ERR_MEMORY;
+    twiddles(n, inverse ? 1 : -1, w, w + n / 2);
+    bit_reverse(re, im, n);
+    butterflies(re, im, n, w, w + n / 2);
+    free(w);
+    if (inverse)
+        for (long i = 0; i < n; i++) {
+            re[i] /= n;
+            im[i] /= n;
+        }
+    return AFC_OK;
+}
+
+/*
+ * With a[m] = x[2m], b[m] = x[2m+1] and W = e^(-2 pi j k / n):
+ *   X[k] = A[k] + W^k B[k],  X[k + n/2] = conj(X[n/2 - k]) = A[k] - W^k B[k]
+ * so z = a + j b is the half-size inverse transform of
+ *   Z[k] = A[k] + j B[k],  A = (X[k] + X'[k]) / 2,  B = (X[k] - X'[k]) / (2 W^k)
+ * where X'[k] = conj(X[n/2 - k]).
+ */
+int afc_real_ifft(double *re, double *im, long n) {
+    if (!power_of_two(n) || n < 4)
+        return AFC_ERR_ARGUMENT;
+    long h = n / 2;
+    double *w = malloc(n * sizeof *w);
+    if (!w)
+        return AFC_ERR_MEMORY;
+    twiddles(n, 1, w, w + h);   // conj(W^k)
+
+    im[0] = im[h] = 0;
+    for (long k = 0; k <= h / 2; k++) {
+        long q = h - k;
+        double xr = re[k], xi = im[k], yr = re[q], yi = -im[q];     // X[k], X'[k]
+        double ar = (xr + yr) / 2, ai = (xi + yi) / 2;
+        double dr = (xr - yr) / 2, di = (xi - yi) / 2;
+        double br = dr * w[k] - di * w[h + k], bi = dr * w[h + k] + di * w[k];
+        // and for q, whose partner is k: X[q], X'[q] = conj X[k]
+        double pr = re[q], pi = im[q], sr = xr, si = -xi;
+        double cr = (pr + sr) / 2, ci = (pi + si) / 2;
+        double er = (pr - sr) / 2, ei = (pi - si) / 2;
+        double wqr = q < h ? w[q] : -1, wqi = q < h ? w[h + q] : 0;
+        double fr = er * wqr - ei * wqi, fi = er * wqi + ei * wqr;
+        re[k] = ar - bi;
+        im[k] = ai + br;
+        if (q != k && q < h) {
+            re[q] = cr - fi;
+            im[q] = ci + fr;
+        }
+    }
+    free(w);
+    return afc_fft(re, im, h, 1);
+}
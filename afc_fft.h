@@ -0,0 +1,23 @@
+/*
+ * Analog Filter Calculator - fast Fourier transform
+ * Radix-2 transforms on split real and imaginary arrays, in place, for the
+ * time-domain analysis. Sizes are powers of two.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_FFT_H
+#define AFC_FFT_H
+
+// Complex transform of n points: X[k] = sum x[m] e^(-+2 pi j k m / n),
+// the minus sign forward (inverse = 0), the plus sign inverse, which also
+// divides by n.
+int afc_fft(double *re, double *im, long n, int inverse);
+
+// Inverse transform of a real signal of n points from its spectrum
+// X[0..n/2] (re, im each n/2 + 1 long, im[0] and im[n/2] ignored). The
+// signal overwrites the spectrum: x[2m] in re[m], x[2m+1] in im[m].
+int afc_real_ifft(double *re, double *im, long n);
+
+#endif
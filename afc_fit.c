@@ -0,0 +1,531 @@
+/*
+ * Analog Filter Calculator - fitting ladder values to a measurement
+ * Each start runs on one worker with its own scratch: the response and the
+ * loss sensitivities over the whole sweep. The normal equations J^T J and
+ * J^T r are summed point by point, so the Jacobian itself is never stored;
+ * a trial step needs only the response. On a long sweep every start first
+ * descends against an evenly thinned copy of it (COARSE_POINTS), and only
+ * the starts that got about as far as the best go on to the full sweep, so
+ * starts that fall into a poor minimum cost little.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "afc_fit.h"
+#include "afc_input.h"
+#include "afc_parallel.h"
+#include "afc_response.h"
+#include "afc_touchstone.h"
+
+#define MAX_PARAMS     (2 * AFC_MAX_ORDER)
+#define MAX_STEP       1.0      // ln units a step may move a value, a factor of e
+#define LAMBDA_START   1e-3
+#define LAMBDA_MAX     1e10
+#define DB_TO_LN       0.23025850929940457   // ln 10 / 10
+#define COARSE_POINTS  500      // points of the first pass on a long sweep
+#define SCREEN         0.1      // starts within this of the best rms after it go on
+#define CONVERGED      1e-6     // relative cost change that ends a fit
+#define AGREE          0.01     // starts within this of the best rms agree,
+#define AGREE_DB       1e-4     // or within this many dB
+
+/* ---------------------------------------------------------------------- */
+/* Measured sweep                                                         */
+/* ---------------------------------------------------------------------- */
+
+void afc_fit_target_free(afc_fit_target *t) {
+    free(t->freq);
+    free(t->il_dB);
+    free(t->rl_dB);
+    memset(t, 0, sizeof *t);
+}
+
+static int load_touchstone(const char *path, afc_fit_target *t) {
+    afc_touchstone ts;
+    int err = afc_touchstone_load(path, &ts);
+    if (err != AFC_OK)
+        return err;
+    if (ts.ports != 2 || ts.count < 2) {
+        afc_touchstone_free(&ts);
+        return AFC_ERR_FORMAT;
+    }
+    t->count = ts.count;
+    t->freq = ts.freq;     // taken over
+    t->il_dB = malloc(t->count * sizeof *t->il_dB);
+    t->rl_dB = malloc(t->count * sizeof *t->rl_dB);
+    t->R[0] = ts.R[0];
+    t->R[1] = ts.R[1];
+    ts.freq = NULL;
+    if (t->il_dB && t->rl_dB)
+        for (long k = 0; k < t->count; k++) {
+            const double *re = ts.re + 4 * k, *im = ts.im + 4 * k;
+            t->il_dB[k] = -10 * log10(re[2] * re[2] + im[2] * im[2]);
+            t->rl_dB[k] = -10 * log10(re[0] * re[0] + im[0] * im[0]);
+        }
+    else
+        err = AFC_ERR_MEMORY;
+    afc_touchstone_free(&ts);
+    if (err != AFC_OK)
+        afc_fit_target_free(t);
+    return err;
+}
+
+int afc_fit_target_load(const char *path, afc_fit_target *t) {
+    const char *dot = strrchr(path, '.');
+    if (dot && (dot[1] == 's' || dot[1] == 'S') && isdigit((unsigned char)dot[2])) {
+        memset(t, 0, sizeof *t);
+        return load_touchstone(path, t);
+    }
+
+    FILE *f = fopen(path, "r");
+    char line[1024];
+    long cap = 0;
+    int columns = 0, err = AFC_OK;
+
+    memset(t, 0, sizeof *t);
+    if (!f)
+        return AFC_ERR_IO;
+    while (err == AFC_OK && fgets(line, sizeof line, f)) {
+        double v[3];
+        const char *p = line, *end;
+        int got = 0;
+        while (got < 3 && !afc_scan_double(p, NULL, &v[got], &end)) {
+            got++;
+            for (p = end; *p == ' ' || *p == '\t' || *p == ','; p++)
+                ;
+        }
+        if (got == 0)
+            continue;   // header or comment
+        if (!columns)
+            columns = got;
+        if (got < 2 || got < columns || !(v[0] > 0) || (t->count && !(v[0] > t->freq[t->count - 1]))) {
+            err = AFC_ERR_FORMAT;
+            break;
+        }
+        if (t->count == cap) {
+            cap = cap ? 2 * cap : 1024;
+            double *pf = realloc(t->freq, cap * sizeof *pf);
+            if (pf)
+                t->freq = pf;
+            double *pi = realloc(t->il_dB, cap * sizeof *pi);
+            if (pi)
+                t->il_dB = pi;
+            double *pr = columns > 2 ? realloc(t->rl_dB, cap * sizeof *pr) : NULL;
+            if (pr)
+                t->rl_dB = pr;
+            if (!pf || !pi || (columns > 2 && !pr)) {
+                err = AFC_ERR_MEMORY;
+                break;
+            }
+        }
+        t->freq[t->count] = v[0];
+        t->il_dB[t->count] = v[1];
+        if (columns > 2)
+            t->rl_dB[t->count] = v[2];
+        t->count++;
+    }
+    if (ferror(f))
+        err = AFC_ERR_IO;
+    fclose(f);
+    if (err == AFC_OK && t->count < 2)
+        err = AFC_ERR_FORMAT;
+    if (err != AFC_OK)
+        afc_fit_target_free(t);
+    return err;
+}
+
+/* ---------------------------------------------------------------------- */
+/* One start                                                              */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    int e;                 // element
+    int inductor;          // its L, else its C
+} param;
+
+typedef struct {
+    double *block;         // everything below
+    double *il, *rl;       // response at the current values
+    double *il_t, *rl_t;   // at a trial step
+    double *il_C, *il_L;   // sensitivities, count * n
+} scratch;
+
+typedef struct {
+    const afc_element *el;
+    int n, p;
+    param params[MAX_PARAMS];
+    double Rs, RL;
+    const afc_fit_target *t;
+    afc_fit_target coarse; // every stride-th point of t, or empty
+    afc_fit_config cfg;
+    scratch *work;         // per worker
+    double *theta;         // per start, p each
+    double *cost;          // per start
+    int *steps;            // per start
+    int *polish;           // starts of the second pass, NULL in the first
+    int err;
+} fit_job;
+
+static void set_values(const fit_job *job, const double *theta, afc_element *out) {
+    memcpy(out, job->el, job->n * sizeof *out);
+    for (int j = 0; j < job->p; j++) {
+        afc_element *e = &out[job->params[j].e];
+        if (job->params[j].inductor)
+            e->L = exp(theta[j]);
+        else
+            e->C = exp(theta[j]);
+    }
+}
+
+static double cap(double v, double limit) {
+    return v < limit ? v : limit;
+}
+
+static double cost_of(const fit_job *job, const afc_fit_target *t, const double *il, const double *rl) {
+    double il_cap = job->cfg.il_cap_dB, rl_cap = job->cfg.rl_cap_dB, w = job->cfg.rl_weight;
+    double sum = 0;
+    for (long k = 0; k < t->count; k++) {
+        double r = cap(il[k], il_cap) - cap(t->il_dB[k], il_cap);
+        sum += r * r;
+        if (w > 0) {
+            r = w * (cap(rl[k], rl_cap) - cap(t->rl_dB[k], rl_cap));
+            sum += r * r;
+        }
+    }
+    return sum;
+}
+
+static int evaluate(const fit_job *job, const afc_fit_target *t, const double *theta,
+                    double *il, double *rl) {
+    afc_element el[AFC_MAX_ORDER];
+    afc_response out = { .il_dB = il, .rl_dB = rl };
+    set_values(job, theta, el);
+    return afc_ladder_response(el, job->n, job->Rs, job->RL, t->freq, t->count, &out);
+}
+
+// J^T J into A and J^T r into g at theta, whose response is in s->il, rl.
+static int normal_equations(const fit_job *job, const afc_fit_target *t, const double *theta,
+                            scratch *s, double A[MAX_PARAMS][MAX_PARAMS], double *g) {
+    afc_element el[AFC_MAX_ORDER];
+    afc_sensitivity sens = { .il_C = s->il_C, .il_L = s->il_L };
+    double il_cap = job->cfg.il_cap_dB, rl_cap = job->cfg.rl_cap_dB, w = job->cfg.rl_weight;
+    double d[MAX_PARAMS];
+    int n = job->n, p = job->p, err;
+
+    set_values(job, theta, el);
+    if ((err = afc_ladder_sensitivity(el, n, job->Rs, job->RL, t->freq, t->count, &sens, 1)) != AFC_OK)
+        return err;
+    for (int i = 0; i < p; i++) {
+        g[i] = 0;
+        for (int j = 0; j <= i; j++)
+            A[i][j] = 0;
+    }
+    for (long k = 0; k < t->count; k++) {
+        const double *dC = s->il_C + k * n, *dL = s->il_L + k * n;
+        for (int j = 0; j < p; j++)
+            d[j] = job->params[j].inductor ? dL[job->params[j].e] : dC[job->params[j].e];
+
+        // insertion loss row, and the return loss row: with |S11|^2 =
+        // 1 - |S21|^2, d RL = -10^((RL - IL) / 10) d IL
+        double rows[2][2] = { { s->il[k] < il_cap, cap(s->il[k], il_cap) - cap(t->il_dB[k], il_cap) },
+                              { 0, 0 } };
+        if (w > 0) {
+            rows[1][0] = s->rl[k] < rl_cap ? -w * exp(DB_TO_LN * (s->rl[k] - s->il[k])) : 0;
+            rows[1][1] = w * (cap(s->rl[k], rl_cap) - cap(t->rl_dB[k], rl_cap));
+        }
+        for (int r = 0; r < 2; r++) {
+            double f = rows[r][0];
+            if (f == 0)
+                continue;
+            for (int i = 0; i < p; i++) {
+                double ji = f * d[i];
+                g[i] += ji * rows[r][1];
+                for (int j = 0; j <= i; j++)
+                    A[i][j] += ji * f * d[j];
+            }
+        }
+    }
+    return AFC_OK;
+}
+
+// Solve (A + lambda diag A) x = -g by Cholesky; 0 if not positive definite.
+static int solve(double A[MAX_PARAMS][MAX_PARAMS], const double *g, int p, double lambda, double *x) {
+    double L[MAX_PARAMS][MAX_PARAMS], peak = 0;
+    for (int i = 0; i < p; i++)
+        peak = fmax(peak, A[i][i]);
+    for (int i = 0; i < p; i++)
+        for (int j = 0; j <= i; j++) {
+            double s = A[i][j];
+            if (i == j)
+                s += lambda * A[i][i] + 1e-12 * peak;
+            for (int k = 0; k < j; k++)
+                s -= L[i][k] * L[j][k];
+            if (i == j) {
+                if (!(s > 0))
+                    return 0;
+                L[i][i] = sqrt(s);
+            } else {
+                L[i][j] = s / L[j][j];
+            }
+        }
+    for (int i = 0; i < p; i++) {
+        double s = -g[i];
+        for (int k = 0; k < i; k++)
+            s -= L[i][k] * x[k];
+        x[i] = s / L[i][i];
+    }
+    for (int i = p - 1; i >= 0; i--) {
+        double s = x[i];
+        for (int k = i + 1; k < p; k++)
+            s -= L[k][i] * x[k];
+        x[i] = s / L[i][i];
+    }
+    return 1;
+}
+
+static uint64_t next_random(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+static double normal_random(uint64_t *state) {
+    double u = ((next_random(state) >> 11) + 0.5) / 9007199254740992.0;
+    double v = (next_random(state) >> 11) / 9007199254740992.0;
+    return sqrt(-2 * log(u)) * cos(2 * AFC_M_PI * v);
+}
+
+// Levenberg-Marquardt from theta against t; returns the steps taken.
+static int descend(const fit_job *job, const afc_fit_target *t, double *theta, scratch *s,
+                   double *cost, int *err) {
+    double A[MAX_PARAMS][MAX_PARAMS], g[MAX_PARAMS], step[MAX_PARAMS], trial[MAX_PARAMS];
+    double lambda = LAMBDA_START;
+    int it;
+
+    if ((*err = evaluate(job, t, theta, s->il, s->rl)) != AFC_OK)
+        return 0;
+    *cost = cost_of(job, t, s->il, s->rl);
+    for (it = 0; it < job->cfg.iterations && lambda < LAMBDA_MAX; it++) {
+        if ((*err = normal_equations(job, t, theta, s, A, g)) != AFC_OK)
+            return it;
+        int accepted = 0;
+        double before = *cost;
+        while (!accepted && lambda < LAMBDA_MAX) {
+            if (!solve(A, g, job->p, lambda, step)) {
+                lambda *= 10;
+                continue;
+            }
+            for (int j = 0; j < job->p; j++)
+                trial[j] = theta[j] + fmax(-MAX_STEP, fmin(MAX_STEP, step[j]));
+            if ((*err = evaluate(job, t, trial, s->il_t, s->rl_t)) != AFC_OK)
+                return it;
+            double c = cost_of(job, t, s->il_t, s->rl_t);
+            if (c < *cost) {
+                memcpy(theta, trial, job->p * sizeof *theta);
+                double *swap = s->il; s->il = s->il_t; s->il_t = swap;
+                swap = s->rl; s->rl = s->rl_t; s->rl_t = swap;
+                *cost = c;
+                lambda = fmax(lambda / 3, 1e-12);
+                accepted = 1;
+            } else {
+                lambda *= 4;
+            }
+        }
+        if (!accepted || before - *cost <= CONVERGED * before)
+            break;
+    }
+    return it;
+}
+
+// First pass of a start: from its starting point against the coarse
+// sweep, or all of t if the sweep is short.
+static int fit_start(fit_job *job, int start, scratch *s) {
+    double *theta = job->theta + (size_t)start * job->p;
+    uint64_t state = 0x9E3779B97F4A7C15ULL * (job->cfg.seed + 1) + (uint64_t)start * 0xD1B54A32D192ED03ULL;
+    int err = AFC_OK;
+
+    for (int j = 0; j < job->p; j++) {
+        const afc_element *e = &job->el[job->params[j].e];
+        theta[j] = log(job->params[j].inductor ? e->L : e->C);
+        if (start > 0)
+            theta[j] += job->cfg.spread * normal_random(&state);
+    }
+    job->steps[start] = descend(job, job->coarse.count ? &job->coarse : job->t, theta, s,
+                                &job->cost[start], &err);
+    return err;
+}
+
+// Second pass: on to the minimum of all of t.
+static int polish_start(fit_job *job, int start, scratch *s) {
+    int err = AFC_OK;
+    job->steps[start] += descend(job, job->t, job->theta + (size_t)start * job->p, s,
+                                 &job->cost[start], &err);
+    return err;
+}
+
+static void fit_chunk(void *ctx, long begin, long end, int tid) {
+    fit_job *job = ctx;
+    for (long i = begin; i < end; i++) {
+        int start = job->polish ? job->polish[i] : (int)i;
+        int err = job->polish ? polish_start(job, start, &job->work[tid])
+                              : fit_start(job, start, &job->work[tid]);
+        if (err != AFC_OK) {
+            job->cost[start] = INFINITY;
+            job->err = err;
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* Multi-start driver                                                     */
+/* ---------------------------------------------------------------------- */
+
+static void defaults(afc_fit_config *c) {
+    if (c->starts <= 0)        c->starts = AFC_FIT_STARTS;
+    if (!(c->spread > 0))      c->spread = AFC_FIT_SPREAD;
+    if (c->iterations <= 0)    c->iterations = AFC_FIT_ITERATIONS;
+    if (!(c->il_cap_dB > 0))   c->il_cap_dB = AFC_FIT_IL_CAP;
+    if (!(c->rl_cap_dB > 0))   c->rl_cap_dB = AFC_FIT_RL_CAP;
+    if (c->rl_weight == 0)     c->rl_weight = 1;
+}
+
+int afc_fit(const afc_element *el, int n, double Rs, double RL, const afc_fit_target *t,
+            const afc_fit_config *cfg, afc_fit_result *out) {
+    fit_job job = { .el = el, .n = n, .Rs = Rs, .RL = RL, .t = t, .cfg = *cfg };
+    int err = AFC_OK, workers;
+
+    defaults(&job.cfg);
+    if (!t->rl_dB)
+        job.cfg.rl_weight = -1;
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    if (t->count < 2)
+        return AFC_ERR_ARGUMENT;
+    for (int e = 0; e < n; e++) {
+        if (el[e].form != AFC_FORM_L)
+            job.params[job.p++] = (param){ e, 0 };
+        if (el[e].form != AFC_FORM_C)
+            job.params[job.p++] = (param){ e, 1 };
+    }
+
+    workers = afc_thread_count(job.cfg.threads);
+    if (workers > job.cfg.starts)
+        workers = job.cfg.starts;
+    size_t count = (size_t)t->count;
+    job.work = calloc(workers, sizeof *job.work);
+    job.theta = malloc((size_t)job.cfg.starts * job.p * sizeof *job.theta);
+    job.cost = malloc(job.cfg.starts * sizeof *job.cost);
+    job.steps = malloc(job.cfg.starts * sizeof *job.steps);
+    int *list = malloc(job.cfg.starts * sizeof *list);
+    int ok = job.work && job.theta && job.cost && job.steps && list;
+    for (int w = 0; ok && w < workers; w++) {
+        scratch *s = &job.work[w];
+        s->il = s->block = malloc((4 + 2 * (size_t)n) * count * sizeof *s->block);
+        ok = s->block != NULL;
+        if (ok) {
+            s->rl = s->il + count;
+            s->il_t = s->rl + count;
+            s->rl_t = s->il_t + count;
+            s->il_C = s->rl_t + count;
+            s->il_L = s->il_C + (size_t)n * count;
+        }
+    }
+    if (ok && t->count >= 4 * COARSE_POINTS) {
+        long stride = t->count / COARSE_POINTS;
+        afc_fit_target *c = &job.coarse;
+        c->count = (t->count + stride - 1) / stride;
+        c->freq = malloc(3 * c->count * sizeof *c->freq);
+        ok = c->freq != NULL;
+        if (ok) {
+            c->il_dB = c->freq + c->count;
+            c->rl_dB = t->rl_dB ? c->il_dB + c->count : NULL;
+            for (long k = 0; k < c->count; k++) {
+                c->freq[k] = t->freq[k * stride];
+                c->il_dB[k] = t->il_dB[k * stride];
+                if (c->rl_dB)
+                    c->rl_dB[k] = t->rl_dB[k * stride];
+            }
+        }
+    }
+    if (!ok) {
+        err = AFC_ERR_MEMORY;
+        goto done;
+    }
+
+    // the nominal residual, on the first worker's scratch
+    double theta0[MAX_PARAMS];
+    for (int j = 0; j < job.p; j++)
+        theta0[j] = log(job.params[j].inductor ? el[job.params[j].e].L : el[job.params[j].e].C);
+    if ((err = evaluate(&job, t, theta0, job.work[0].il, job.work[0].rl)) != AFC_OK)
+        goto done;
+    double points = (double)t->count * (job.cfg.rl_weight > 0 ? 2 : 1);
+    out->nominal_rms_dB = sqrt(cost_of(&job, t, job.work[0].il, job.work[0].rl) / points);
+
+    // every start on the coarse sweep, then only those that got about as
+    // far as the best on the full one
+    afc_parallel_for(job.cfg.starts, 1, workers, fit_chunk, &job);
+    int best = 0;
+    for (int i = 1; i < job.cfg.starts; i++)
+        if (job.cost[i] < job.cost[best])
+            best = i;
+    if (job.coarse.count && isfinite(job.cost[best])) {
+        int survivors = 0;
+        double limit = job.cost[best] * (1 + SCREEN) * (1 + SCREEN) + job.coarse.count * AGREE_DB * AGREE_DB;
+        for (int i = 0; i < job.cfg.starts; i++)
+            if (job.cost[i] <= limit)
+                list[survivors++] = i;
+            else
+                job.cost[i] = INFINITY;
+        job.polish = list;
+        afc_parallel_for(survivors, 1, workers < survivors ? workers : survivors, fit_chunk, &job);
+        job.polish = NULL;
+        for (int i = 0; i < job.cfg.starts; i++)
+            if (job.cost[i] < job.cost[best])
+                best = i;
+    }
+    if (!isfinite(job.cost[best])) {
+        err = job.err ? job.err : AFC_ERR_PRECISION;
+        goto done;
+    }
+    // of the starts that fit as well, the one nearest the nominal values
+    double rms = sqrt(job.cost[best] / points), nearest = INFINITY;
+    out->agree = 0;
+    for (int i = 0; i < job.cfg.starts; i++) {
+        if (!(sqrt(job.cost[i] / points) <= rms * (1 + AGREE) + AGREE_DB))
+            continue;
+        double d = 0;
+        for (int j = 0; j < job.p; j++) {
+            double x = job.theta[(size_t)i * job.p + j] - theta0[j];
+            d += x * x;
+        }
+        if (d < nearest) {
+            nearest = d;
+            best = i;
+        }
+        out->agree++;
+    }
+    out->n = n;
+    set_values(&job, job.theta + (size_t)best * job.p, out->el);
+    out->rms_dB = sqrt(job.cost[best] / points);
+    out->start = best;
+    out->iterations = job.steps[best];
+
+done:
+    for (int w = 0; job.work && w < workers; w++)
+        free(job.work[w].block);
+    free(job.work);
+    free(job.theta);
+    free(job.cost);
+    free(job.steps);
+    free(list);
+    free(job.coarse.freq);
+    return err;
+}
@@ -0,0 +1,77 @@
+/*
+ * Analog Filter Calculator - fitting ladder values to a measurement
+ * Finds the element values of a PI/Tee ladder whose response best matches
+ * a measured sweep, to tell which part of a built filter is off. The
+ * unknowns are the logarithms of every L and C of the nominal design (so
+ * values stay positive and a step is a relative change); the residuals are
+ * the insertion loss and, when measured, the return loss in dB at every
+ * point. Levenberg-Marquardt steps use the analytic Jacobian of the loss
+ * (afc_ladder_sensitivity()); the return-loss rows follow from it, since
+ * |S11|^2 = 1 - |S21|^2 for the lossless ladder.
+ *
+ * Losses beyond the caps are treated as equal: a network analyzer's noise
+ * floor in the stop band and the depth of the return-loss nulls carry no
+ * information about the values. A fit is run from many starting points,
+ * the nominal values and random spreads around them, in parallel. Loss
+ * alone does not always pin the values down (a ladder with its reflection
+ * zeros mirrored has the same |S21|), so of the starts that fit about as
+ * well as the best, the one nearest the nominal values is taken.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_FIT_H
+#define AFC_FIT_H
+
+#include "afc.h"
+
+#define AFC_FIT_STARTS      32
+#define AFC_FIT_SPREAD      0.2     // relative spread of the random starts
+#define AFC_FIT_ITERATIONS  100
+#define AFC_FIT_IL_CAP      60.0    // dB
+#define AFC_FIT_RL_CAP      30.0    // dB
+
+// Measured sweep, frequencies ascending
+typedef struct {
+    long count;
+    double *freq;          // Hz
+    double *il_dB;         // insertion loss, -20 log10 |S21|
+    double *rl_dB;         // return loss, -20 log10 |S11|; NULL if not measured
+    double R[2];           // port impedances of the measurement, 0 if not known
+} afc_fit_target;
+
+// Read a measured sweep: a Touchstone two-port (.s2p; see
+// afc_touchstone.h), or a CSV of frequency in Hz, insertion loss and
+// optionally return loss in dB (positive), one point per line, as
+// filter_response writes it; lines that do not start with a number are
+// skipped. Free it with afc_fit_target_free().
+int afc_fit_target_load(const char *path, afc_fit_target *t);
+void afc_fit_target_free(afc_fit_target *t);
+
+// Zeroed fields take the defaults above.
+typedef struct {
+    int starts;
+    double spread;
+    int iterations;        // LM steps per start at most
+    double il_cap_dB, rl_cap_dB;
+    double rl_weight;      // of the return-loss residuals; < 0 leaves them out
+    unsigned seed;
+    int threads;           // 0 = all cores
+} afc_fit_config;
+
+typedef struct {
+    int n;
+    afc_element el[AFC_MAX_ORDER];   // fitted ladder
+    double rms_dB;         // residual of the fit
+    double nominal_rms_dB; // the same for the nominal values
+    int start;             // start the fit came from (0 = nominal values)
+    int iterations;        // its LM steps
+    int agree;             // starts that ended within 1 % of the best rms
+} afc_fit_result;
+
+// Fit the n-element ladder el between Rs and RL to t.
+int afc_fit(const afc_element *el, int n, double Rs, double RL, const afc_fit_target *t,
+            const afc_fit_config *cfg, afc_fit_result *out);
+
+#endif
@@ -0,0 +1,321 @@
+/*
+ * Analog Filter Calculator - numeric input
+ * One pass over the text collects the significant digits into a 64-bit
+ * mantissa and the power of ten, which the suffix adds to; the conversion
+ * comes after. The slow path walks the digits again from the first
+ * significant one.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <ctype.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "afc_input.h"
+
+#define MANT_DIGITS  19     // always fit a uint64_t
+#define SLOW_DIGITS  40     // kept for strtod()
+#define EXACT_POW10  22     // largest power of ten a double holds exactly
+#define EXP_LIMIT    100000 // exponents beyond this are clamped
+#define WORD_SIZE    256
+
+static const double pow10_exact[EXACT_POW10 + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const uint64_t pow10_int[MANT_DIGITS + 1] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+    10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+    100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+};
+
+// value = digits * 10^exp10, digits being the count significant digits
+typedef struct {
+    int negative;
+    uint64_t mant;              // the first MANT_DIGITS of them
+    const char *first;          // where they start in the text
+    long count;
+    long exp10;
+    int dropped;                // a non-zero digit beyond MANT_DIGITS
+} decimal;
+
+static int blank(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+static int suffix_exp(char c) {
+    switch (c) {
+    case 'f': return -15;
+    case 'p': return -12;
+    case 'n': return -9;
+    case 'u': return -6;
+    case 'm': return -3;
+    case 'k': case 'K': return 3;
+    case 'M': return 6;
+    case 'G': return 9;
+    case 'T': return 12;
+    default:  return 0;
+    }
+}
+
+// Length of unit at p, or 0; the unit must not run on into more letters.
+static size_t unit_at(const char *p, const char *unit) {
+    size_t n = unit ? strlen(unit) : 0;
+    if (n == 0 || strncasecmp(p, unit, n) || isalnum((unsigned char)p[n]))
+        return 0;
+    return n;
+}
+
+// Scan sign, digits, fraction, exponent, suffix and unit into d.
+static const char *scan(const char *s, const char *unit, decimal *d, const char **end) {
+    const char *p = s;
+    int fraction = 0, any = 0;
+
+    d->negative = 0;
+    d->mant = 0;
+    d->first = NULL;
+    d->count = d->exp10 = 0;
+    d->dropped = 0;
+    while (blank(*p))
+        p++;
+    if (*p == '+' || *p == '-')
+        d->negative = *p++ == '-';
+    for (;; p++) {
+        if (*p == '.' && !fraction) {
+            fraction = 1;
+            continue;
+        }
+        if (*p < '0' || *p > '9')
+            break;
+        int digit = *p - '0';
+        any = 1;
+        if (fraction)
+            d->exp10--;
+        if (d->count == 0) {
+            if (digit == 0)
+                continue;       // leading zero
+            d->first = p;
+        }
+        if (d->count < MANT_DIGITS)
+            d->mant = d->mant * 10 + (uint64_t)digit;
+        else if (digit)
+            d->dropped = 1;
+        d->count++;
+    }
+    if (!any) {
+        *end = p;
+        return "expected a number";
+    }
+
+    if ((*p == 'e' || *p == 'E') && !unit_at(p, unit)) {
+        const char *q = p + 1;
+        int neg = 0;
+        long e = 0;
+        if (*q == '+' || *q == '-')
+            neg = *q++ == '-';
+        if (*q < '0' || *q > '9') {
+            *end = q;
+            return "exponent without digits";
+        }
+        for (; *q >= '0' && *q <= '9'; q++)
+            if (e < EXP_LIMIT)
+                e = e * 10 + (*q - '0');
+        d->exp10 += neg ? -e : e;
+        p = q;
+    }
+
+    // suffix and unit, optionally after blanks
+    const char *q = p;
+    while (*q == ' ' || *q == '\t')
+        q++;
+    size_t n = unit_at(q, unit);
+    int e = n ? 0 : suffix_exp(*q);
+    if (e) {
+        d->exp10 += e;
+        q++;
+        n = unit_at(q, unit);
+    }
+    if (n || e)
+        p = q + n;
+    if (isalpha((unsigned char)*p)) {
+        *end = p;
+        return unit ? "unknown suffix or unit" : "unknown suffix";
+    }
+    *end = p;
+    return NULL;
+}
+
+static const char *to_double(const decimal *d, double *out) {
+    double v;
+    if (d->count == 0) {
+        v = 0;
+    } else {
+        long kept = d->count < MANT_DIGITS ? d->count : MANT_DIGITS;
+        long e = d->exp10 + d->count - kept;
+        if (d->count <= MANT_DIGITS && d->mant <= (1ull << 53) && labs(e) <= EXACT_POW10) {
+            // both operands exact, so the one rounding is the correct one
+            v = e >= 0 ? (double)d->mant * pow10_exact[e] : (double)d->mant / pow10_exact[-e];
+        } else {
+            char buf[SLOW_DIGITS + 16];
+            long slow = 0;
+            for (const char *p = d->first; slow < d->count && slow < SLOW_DIGITS; p++)
+                if (*p != '.')
+                    buf[slow++] = *p;
+            snprintf(buf + slow, sizeof buf - (size_t)slow, "e%ld", d->exp10 + d->count - slow);
+            v = strtod(buf, NULL);
+        }
+        if (isinf(v) || v == 0)
+            return "value out of range";
+    }
+    *out = d->negative ? -v : v;
+    return NULL;
+}
+
+static const char *to_int64(const decimal *d, int64_t *out) {
+    if (d->count == 0) {
+        *out = 0;
+        return NULL;
+    }
+    long whole = d->count + d->exp10;   // digits before the point
+    if (whole > MANT_DIGITS)
+        return "value out of range";
+    if (whole <= 0 || d->dropped)
+        return "not a whole number";
+    long kept = d->count < MANT_DIGITS ? d->count : MANT_DIGITS;
+    long e = d->exp10 + d->count - kept;
+    uint64_t v = d->mant;
+    if (e >= 0) {
+        if (__builtin_mul_overflow(v, pow10_int[e], &v))
+            return "value out of range";
+    } else {
+        if (v % pow10_int[-e])
+            return "not a whole number";
+        v /= pow10_int[-e];
+    }
+    if (v > (uint64_t)INT64_MAX + d->negative)
+        return "value out of range";
+    *out = d->negative ? (int64_t)(0 - v) : (int64_t)v;
+    return NULL;
+}
+
+// A value that does not fit is reported at the start of the number.
+static const char *number_start(const char *s) {
+    while (blank(*s))
+        s++;
+    return s;
+}
+
+const char *afc_scan_double(const char *s, const char *unit, double *out, const char **end) {
+    decimal d;
+    const char *stop;
+    const char *err = scan(s, unit, &d, &stop);
+    if (!err && (err = to_double(&d, out)))
+        stop = number_start(s);
+    if (end)
+        *end = stop;
+    return err;
+}
+
+// Only blanks may follow the number.
+static const char *at_end(const char *p, const char **end) {
+    while (blank(*p))
+        p++;
+    if (end)
+        *end = p;
+    return *p ? "unexpected character" : NULL;
+}
+
+const char *afc_parse_double(const char *s, const char *unit, double *out, const char **end) {
+    decimal d;
+    const char *stop, *err;
+    double v;
+    if ((err = scan(s, unit, &d, &stop)) || (err = at_end(stop, &stop)) ||
+        ((err = to_double(&d, &v)) && (stop = number_start(s)))) {
+        if (end)
+            *end = stop;
+        return err;
+    }
+    if (end)
+        *end = stop;
+    *out = v;
+    return NULL;
+}
+
+const char *afc_parse_int64(const char *s, const char *unit, int64_t *out, const char **end) {
+    decimal d;
+    const char *stop, *err;
+    int64_t v;
+    if ((err = scan(s, unit, &d, &stop)) || (err = at_end(stop, &stop)) ||
+        ((err = to_int64(&d, &v)) && (stop = number_start(s)))) {
+        if (end)
+            *end = stop;
+        return err;
+    }
+    if (end)
+        *end = stop;
+    *out = v;
+    return NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Interactive input                                                      */
+/* ---------------------------------------------------------------------- */
+
+// Next blank-separated word; 0 at the end of the input.
+static int read_word(FILE *in, char *buf, size_t size) {
+    size_t n = 0;
+    int c;
+    while ((c = getc(in)) != EOF && blank((char)c))
+        ;
+    for (; c != EOF && !blank((char)c); c = getc(in))
+        if (n + 1 < size)
+            buf[n++] = (char)c;
+    if (c != EOF)
+        ungetc(c, in);
+    buf[n] = '\0';
+    return n > 0;
+}
+
+static int report(const char *what, const char *word, const char *err, const char *at) {
+    if (!err)
+        return 1;
+    fprintf(stderr, "\nInvalid %s \"%s\": %s at column %ld\n", what, word, err, (long)(at - word) + 1);
+    return 0;
+}
+
+int afc_read_double(FILE *in, const char *what, const char *unit, double *out) {
+    char word[WORD_SIZE];
+    const char *at;
+    if (!read_word(in, word, sizeof word)) {
+        fprintf(stderr, "\nMissing %s\n", what);
+        return 0;
+    }
+    const char *err = afc_parse_double(word, unit, out, &at);
+    return report(what, word, err, at);
+}
+
+int afc_read_int(FILE *in, const char *what, int *out) {
+    char word[WORD_SIZE];
+    const char *at, *err;
+    int64_t v = 0;
+    if (!read_word(in, word, sizeof word)) {
+        fprintf(stderr, "\nMissing %s\n", what);
+        return 0;
+    }
+    err = afc_parse_int64(word, NULL, &v, &at);
+    if (!err && (v < INT_MIN || v > INT_MAX)) {
+        err = "value out of range";
+        at = word;
+    }
+    if (!report(what, word, err, at))
+        return 0;
+    *out = (int)v;
+    return 1;
+}
@@ -0,0 +1,48 @@
+/*
+ * Analog Filter Calculator - numeric input
+ * Parses the numbers typed into the interactive calculators and read from
+ * spec records: decimals with an optional exponent, an engineering suffix
+ * and, where the caller names one, a unit, e.g. "2.4G", "4.7e3", "150kHz",
+ * "100n". Suffixes are case-sensitive:
+ *   f 1e-15  p 1e-12  n 1e-9  u 1e-6  m 1e-3  k (or K) 1e3  M 1e6  G 1e9  T 1e12
+ *
+ * The parser does not depend on the locale. A value whose significant
+ * digits form an integer of at most 2^53 (any 15 digits, most 16) and
+ * whose power of ten is within +-22 (after the suffix) is converted
+ * exactly with one multiplication or division, which covers practically
+ * every value in a spec file; larger mantissas and extreme exponents fall
+ * back to strtod() on a rebuilt digit string, which is correctly rounded
+ * as well, only slower. Integers are parsed without going
+ * through a double, so the whole 64-bit range is exact.
+ *
+ * The parsers return NULL on success or a message, and point *end (when
+ * not NULL) at the character that stopped them.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_INPUT_H
+#define AFC_INPUT_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// The number at the start of s, after any blanks, with its suffix and the
+// optional unit (matched case-insensitively, NULL for none). *end is set
+// past it, and need not be the end of s.
+const char *afc_scan_double(const char *s, const char *unit, double *out, const char **end);
+
+// All of s, blanks around it allowed, as a double or a 64-bit integer. An
+// integer may use a suffix and a fraction as long as the value is whole
+// ("2.5k" is 2500).
+const char *afc_parse_double(const char *s, const char *unit, double *out, const char **end);
+const char *afc_parse_int64(const char *s, const char *unit, int64_t *out, const char **end);
+
+// Read the next blank-separated word from in and parse it. A missing or bad
+// value is reported on stderr with what was expected and the column of the
+// error; the functions then return 0.
+int afc_read_double(FILE *in, const char *what, const char *unit, double *out);
+int afc_read_int(FILE *in, const char *what, int *out);
+
+#endif
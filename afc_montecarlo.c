@@ -0,0 +1,284 @@
+/*
+ * Analog Filter Calculator - Monte Carlo tolerance analysis
+ * Trials are spread over the cores with afc_parallel_steal(). Each worker
+ * keeps its own pass count and loss histograms, merged once at the end, so
+ * the trial loop shares nothing but the read-only job.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "afc_montecarlo.h"
+#include "afc_parallel.h"
+#include "afc_response.h"
+
+#define MC_CHUNK      256       // trials claimed at a time
+
+// Loss histogram bins: 0.005 dB up to 10 dB, 0.1 dB up to 210 dB, overflow
+#define FINE_STEP     0.005
+#define FINE_BINS     2000
+#define COARSE_STEP   0.1
+#define COARSE_BINS   2000
+#define HIST_BINS     (FINE_BINS + COARSE_BINS + 1)
+
+/* ---------------------------------------------------------------------- */
+/* Random streams                                                         */
+/* ---------------------------------------------------------------------- */
+
+// xoshiro256** with a splitmix64 seeding of (seed, trial)
+typedef struct {
+    uint64_t s[4];
+    double spare;
+    int has_spare;
+} mc_rng;
+
+static uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static void rng_seed(mc_rng *r, uint64_t seed, uint64_t trial) {
+    uint64_t x = seed ^ (trial * 0xd1342543de82ef95ULL);
+    for (int i = 0; i < 4; i++)
+        r->s[i] = splitmix64(&x);
+    r->has_spare = 0;
+}
+
+static uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t rng_next(mc_rng *r) {
+    uint64_t *s = r->s;
+    uint64_t out = rotl(s[1] * 5, 7) * 9, t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return out;
+}
+
+// uniform in [0, 1)
+static double rng_uniform(mc_rng *r) {
+    return (rng_next(r) >> 11) * 0x1.0p-53;
+}
+
+// standard normal by the Box-Muller transform
+static double rng_normal(mc_rng *r) {
+    if (r->has_spare) {
+        r->has_spare = 0;
+        return r->spare;
+    }
+    double u = 1 - rng_uniform(r), v = rng_uniform(r);
+    double m = sqrt(-2 * log(u));
+    r->spare = m * sin(2 * AFC_M_PI * v);
+    r->has_spare = 1;
+    return m * cos(2 * AFC_M_PI * v);
+}
+
+static double perturb(mc_rng *r, afc_dist dist, double tol) {
+    double d = dist == AFC_DIST_NORMAL ? tol / 3 * rng_normal(r) : tol * (2 * rng_uniform(r) - 1);
+    return d > -0.999 ? 1 + d : 0.001;   // a part never goes to zero or negative
+}
+
+/* ---------------------------------------------------------------------- */
+/* Histograms                                                             */
+/* ---------------------------------------------------------------------- */
+
+static int loss_bin(double il) {
+    if (!(il < FINE_BINS * FINE_STEP))
+        return !(il < FINE_BINS * FINE_STEP + COARSE_BINS * COARSE_STEP) ? HIST_BINS - 1 :
+               FINE_BINS + (int)((il - FINE_BINS * FINE_STEP) / COARSE_STEP);
+    return il > 0 ? (int)(il / FINE_STEP) : 0;
+}
+
+static double bin_lower(int b) {
+    return b < FINE_BINS ? b * FINE_STEP : FINE_BINS * FINE_STEP + (b - FINE_BINS) * COARSE_STEP;
+}
+
+// Loss of the given rank at one point: interpolated within its bin as if
+// the bin's counts were spread evenly, and held to the losses that were
+// seen (lo, hi), so a curve never shows a value no trial came near.
+static double rank_loss(const uint32_t *h, double rank, double lo, double hi) {
+    long seen = 0;
+    int b = 0;
+    // smallest bin whose cumulative count covers the rank
+    while (b < HIST_BINS - 1 && seen + (long)h[b] <= rank)
+        seen += h[b++];
+    double width = b < FINE_BINS ? FINE_STEP : b < HIST_BINS - 1 ? COARSE_STEP : fmax(hi - bin_lower(b), 0);
+    double v = h[b] ? bin_lower(b) + (rank - seen + 0.5) / h[b] * width : bin_lower(b);
+    return lo <= hi ? fmin(fmax(v, lo), hi) : v;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Trials                                                                 */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    uint32_t *hist;        // count * HIST_BINS
+    double *il;
+    double *min, *max;     // per point, over the worker's trials
+    long passed;
+} mc_worker;
+
+typedef struct {
+    const afc_element *el;
+    int n;
+    double Rs, RL;
+    const double *freq;
+    int count;
+    const double *lo, *hi; // loss limits per sweep point
+    const afc_mc_config *cfg;
+    const afc_part_table *parts;   // NULL for ideal parts
+    mc_worker *workers;
+} mc_job;
+
+// The parts of trial k and their factors.
+static void sample(const afc_element *nominal, int n, const afc_mc_config *cfg, long k,
+                   afc_element *el, double *kC, double *kL) {
+    mc_rng rng;
+    rng_seed(&rng, cfg->seed, (uint64_t)k);
+    for (int e = 0; e < n; e++) {
+        el[e] = nominal[e];
+        kC[e] = kL[e] = 1;
+        if (el[e].C > 0)
+            el[e].C *= kC[e] = perturb(&rng, cfg->dist, cfg->tol_C);
+        if (el[e].L > 0)
+            el[e].L *= kL[e] = perturb(&rng, cfg->dist, cfg->tol_L);
+    }
+}
+
+void afc_mc_sample(const afc_element *el, int n, const afc_mc_config *cfg, long trial,
+                   afc_element *out) {
+    double kC[AFC_MAX_ORDER], kL[AFC_MAX_ORDER];
+    sample(el, n, cfg, trial, out, kC, kL);
+}
+
+static void run_trials(void *ctx, long begin, long end, int tid) {
+    const mc_job *job = ctx;
+    mc_worker *w = &job->workers[tid];
+    afc_element el[AFC_MAX_ORDER];
+    double kC[AFC_MAX_ORDER], kL[AFC_MAX_ORDER];
+    afc_response resp = { .il_dB = w->il };
+
+    for (long k = begin; k < end; k++) {
+        sample(job->el, job->n, job->cfg, k, el, kC, kL);
+
+        int ok = job->parts ?
+                 afc_part_table_response(job->parts, job->Rs, job->RL, kC, kL, &resp, 1) == AFC_OK :
+                 afc_ladder_response(el, job->n, job->Rs, job->RL, job->freq, job->count, &resp) == AFC_OK;
+        int pass = ok;
+        for (int i = 0; i < job->count; i++) {
+            double il = ok ? w->il[i] : NAN;
+            // the comparison is false for NaN, so a failed sample never passes
+            if (!(il >= job->lo[i] && il <= job->hi[i]))
+                pass = 0;
+            w->hist[(size_t)i * HIST_BINS + loss_bin(il)]++;
+            w->min[i] = fmin(w->min[i], il);
+            w->max[i] = fmax(w->max[i], il);
+        }
+        w->passed += pass;
+    }
+}
+
+int afc_monte_carlo(const afc_element *el, int n, double Rs, double RL,
+                    const double *freq, int count, const afc_mask *mask, int nmask,
+                    const afc_mc_config *cfg, const double *pct, int npct, afc_mc_result *res) {
+    int threads = afc_thread_count(cfg->threads);
+    double *il = malloc(count > 0 ? count * sizeof *il : 1);
+    int err = il ? AFC_OK : AFC_ERR_MEMORY;
+
+    // the nominal design must evaluate cleanly before any trial runs
+    if (err == AFC_OK && (count < 1 || count > AFC_MC_MAX_POINTS || cfg->trials < 1 ||
+        !(cfg->tol_C >= 0) || !(cfg->tol_L >= 0) ||
+        (cfg->dist != AFC_DIST_UNIFORM && cfg->dist != AFC_DIST_NORMAL)))
+        err = AFC_ERR_ARGUMENT;
+    for (int p = 0; err == AFC_OK && p < npct; p++)
+        if (!(pct[p] >= 0 && pct[p] <= 100))
+            err = AFC_ERR_ARGUMENT;
+    if (err == AFC_OK)
+        err = afc_ladder_response(el, n, Rs, RL, freq, count, &(afc_response){ .il_dB = il });
+    free(il);
+    if (err != AFC_OK)
+        return err;
+
+    // the part models are evaluated once, trials only rescale them
+    afc_part_table parts = { 0 };
+    if (cfg->parasitics && afc_parasitics_active(cfg->parasitics) &&
+        (err = afc_part_table_init(&parts, el, n, cfg->parasitics, freq, count)) != AFC_OK)
+        return err;
+
+    double *lo = malloc(count * sizeof *lo), *hi = malloc(count * sizeof *hi);
+    mc_worker *workers = calloc(threads, sizeof *workers);
+    err = lo && hi && workers ? AFC_OK : AFC_ERR_MEMORY;
+    for (int t = 0; err == AFC_OK && t < threads; t++) {
+        workers[t].hist = calloc((size_t)count * HIST_BINS, sizeof *workers[t].hist);
+        workers[t].il = malloc(3 * count * sizeof *workers[t].il);
+        if (!workers[t].hist || !workers[t].il) {
+            err = AFC_ERR_MEMORY;
+            continue;
+        }
+        workers[t].min = workers[t].il + count;
+        workers[t].max = workers[t].min + count;
+        for (int i = 0; i < count; i++) {
+            workers[t].min[i] = INFINITY;
+            workers[t].max[i] = -INFINITY;
+        }
+    }
+
+    if (err == AFC_OK) {
+        for (int i = 0; i < count; i++) {
+            lo[i] = -INFINITY;
+            hi[i] = INFINITY;
+            for (int m = 0; m < nmask; m++) {
+                if (freq[i] < mask[m].f_lo || freq[i] > mask[m].f_hi)
+                    continue;
+                if (mask[m].kind == AFC_MASK_STOP)
+                    lo[i] = fmax(lo[i], mask[m].limit_dB);
+                else
+                    hi[i] = fmin(hi[i], mask[m].limit_dB);
+            }
+        }
+
+        mc_job job = { el, n, Rs, RL, freq, count, lo, hi, cfg, parts.z ? &parts : NULL, workers };
+        afc_parallel_steal(cfg->trials, MC_CHUNK, threads, run_trials, &job);
+
+        // merge into worker 0 in thread order; integer sums keep it exact
+        for (int t = 1; t < threads; t++) {
+            workers[0].passed += workers[t].passed;
+            for (size_t b = 0; b < (size_t)count * HIST_BINS; b++)
+                workers[0].hist[b] += workers[t].hist[b];
+            for (int i = 0; i < count; i++) {
+                workers[0].min[i] = fmin(workers[0].min[i], workers[t].min[i]);
+                workers[0].max[i] = fmax(workers[0].max[i], workers[t].max[i]);
+            }
+        }
+        res->trials = cfg->trials;
+        res->passed = workers[0].passed;
+
+        for (int i = 0; res->curve && i < count; i++) {
+            const uint32_t *h = workers[0].hist + (size_t)i * HIST_BINS;
+            for (int p = 0; p < npct; p++)
+                res->curve[i * npct + p] = rank_loss(h, pct[p] / 100 * (cfg->trials - 1),
+                                                     workers[0].min[i], workers[0].max[i]);
+        }
+    }
+
+    for (int t = 0; workers && t < threads; t++) {
+        free(workers[t].hist);
+        free(workers[t].il);
+    }
+    free(workers);
+    free(lo);
+    free(hi);
+    afc_part_table_free(&parts);
+    return err;
+}
@@ -0,0 +1,74 @@
+/*
+ * Analog Filter Calculator - Monte Carlo tolerance analysis
+ * Perturbs every L and C of a designed ladder by a random tolerance, checks
+ * the insertion loss of each sample against a pass/fail mask and gathers
+ * the yield and percentile curves of the loss over the sweep.
+ *
+ * With parasitics the part models are evaluated once into a table and
+ * every trial only scales it, so the models cost nothing per sample.
+ *
+ * Trial k always draws from the same random stream (derived from the seed
+ * and k), so results do not depend on the thread count or scheduling.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_MONTECARLO_H
+#define AFC_MONTECARLO_H
+
+#include <stdint.h>
+
+#include "afc.h"
+#include "afc_parasitic.h"
+
+#define AFC_MC_MAX_POINTS 1024
+
+typedef enum {
+    AFC_DIST_UNIFORM = 1,  // value * (1 + tol * U(-1, 1))
+    AFC_DIST_NORMAL  = 2   // value * (1 + tol/3 * N(0, 1)), tol is 3 sigma
+} afc_dist;
+
+typedef enum {
+    AFC_MASK_PASS = 1,     // insertion loss <= limit_dB in [f_lo, f_hi]
+    AFC_MASK_STOP = 2      // insertion loss >= limit_dB in [f_lo, f_hi]
+} afc_mask_kind;
+
+typedef struct {
+    afc_mask_kind kind;
+    double f_lo, f_hi;     // Hz
+    double limit_dB;
+} afc_mask;
+
+typedef struct {
+    double tol_C, tol_L;   // relative tolerances, e.g. 0.05 for 5 %
+    afc_dist dist;
+    uint64_t seed;
+    long trials;
+    int threads;           // 0 = all cores
+    const afc_parasitics *parasitics;   // NULL = ideal parts
+} afc_mc_config;
+
+typedef struct {
+    long trials;
+    long passed;
+    // percentile curves: curve[i * npct + p] is the pct[p] percentile of
+    // the insertion loss at freq[i], interpolated in 0.005 dB bins below
+    // 10 dB and never outside the smallest and largest loss of the trials
+    double *curve;
+} afc_mc_result;
+
+// Run cfg->trials samples of the ladder el between Rs and RL, evaluated at
+// the count frequencies freq. Mask segments are checked at the sweep
+// points that fall inside them. pct[0..npct-1] are percentiles in 0..100;
+// res->curve must hold count * npct values (or be NULL).
+int afc_monte_carlo(const afc_element *el, int n, double Rs, double RL,
+                    const double *freq, int count, const afc_mask *mask, int nmask,
+                    const afc_mc_config *cfg, const double *pct, int npct, afc_mc_result *res);
+
+// The perturbed ladder of trial number trial (0 .. trials - 1) of a run
+// with cfg, the same parts that run evaluates.
+void afc_mc_sample(const afc_element *el, int n, const afc_mc_config *cfg, long trial,
+                   afc_element *out);
+
+#endif
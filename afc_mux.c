@@ -0,0 +1,313 @@
+/*
+ * Analog Filter Calculator - multiplexers and filter banks
+ * A channel is only ever needed as seen from the junction: its input
+ * admittance, and its output voltage for a given junction voltage. Both
+ * come from one backward pass from the load, (V, I) = (1, 1/RL) through
+ * the arms, which gives the input voltage and current per volt at the
+ * output. The junction then is a single node fed by the source.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "afc_mux.h"
+#include "afc_parallel.h"
+#include "afc_stats.h"
+
+#define DESIGN_CHUNK   1      // channels per task when designing and correcting
+#define MUX_CHUNK      64     // frequencies per task of afc_mux_response()
+#define MAX_STEP       0.9    // a correction takes at most this much of a part's reactance
+
+typedef double complex cplx;
+
+// Reactance of a series arm or susceptance of a shunt arm at w.
+static double arm_value(const afc_element *e, double w) {
+    int series = e->branch == AFC_SERIES;
+    double x;
+    switch (e->form) {
+    case AFC_FORM_C:
+        return series ? -1 / (w * e->C) : w * e->C;
+    case AFC_FORM_L:
+        return series ? w * e->L : -1 / (w * e->L);
+    case AFC_FORM_SERIES_LC:      // impedance j(wL - 1/(wC))
+        x = w * e->L - 1 / (w * e->C);
+        return series ? x : -1 / (x + 1e-300);
+    default:                      // admittance j(wC - 1/(wL))
+        x = w * e->C - 1 / (w * e->L);
+        return series ? -1 / (x + 1e-300) : x;
+    }
+}
+
+// Input voltage per volt at the output of a channel (*V) and its input
+// admittance.
+static cplx channel_input(const afc_element *el, int n, double RL, double w, cplx *V) {
+    cplx v = 1, i = 1 / RL;
+    for (int e = n - 1; e >= 0; e--) {
+        double x = arm_value(&el[e], w);
+        if (el[e].branch == AFC_SERIES)
+            v += CMPLX(-cimag(i) * x, creal(i) * x);
+        else
+            i += CMPLX(-cimag(v) * x, creal(v) * x);
+    }
+    *V = v;
+    return i / v;
+}
+
+void afc_mux_free(afc_mux *mux) {
+    free(mux->spec);
+    free(mux->RL);
+    free(mux->n);
+    free(mux->el);
+    memset(mux, 0, sizeof *mux);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Design and junction correction                                         */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    afc_mux *mux;
+    const double *g;           // shared prototype, NULL for elliptic designs
+    int *err;
+    afc_element *first;        // designed first element per channel
+    afc_element *next;         // its correction of this pass
+    double *change;            // relative change of it in this pass
+    int *clamped;              // 1 if that change hit MAX_STEP
+} mux_job;
+
+static void design_chunk(void *ctx, long begin, long end, int tid) {
+    mux_job *job = ctx;
+    afc_mux *mux = job->mux;
+    (void)tid;
+
+    for (long c = begin; c < end; c++) {
+        const afc_spec *s = &mux->spec[c];
+        int n = job->g ? afc_denormalize(s, job->g, mux->el[c], AFC_MAX_ORDER)
+                       : afc_design(s, mux->el[c], AFC_MAX_ORDER);
+        mux->n[c] = n;
+        job->err[c] = n < 0 ? n : AFC_OK;
+        if (n > 0) {
+            mux->RL[c] = afc_load_impedance(s);
+            job->first[c] = mux->el[c][0];
+        }
+    }
+}
+
+static double relative(double a, double b) {
+    return fabs(a - b) / b;
+}
+
+// New first element of channel c against the others as they are now.
+static void correct_chunk(void *ctx, long begin, long end, int tid) {
+    mux_job *job = ctx;
+    const afc_mux *mux = job->mux;
+    (void)tid;
+
+    for (long c = begin; c < end; c++) {
+        const afc_element *e0 = &job->first[c];
+        afc_element *e = &job->next[c];
+        double w = 2 * AFC_M_PI * mux->spec[c].freq;
+        cplx Y = 0, V;
+
+        *e = mux->el[c][0];
+        job->change[c] = 0;
+        job->clamped[c] = 0;
+        for (int j = 0; j < mux->channels; j++)
+            if (j != c)
+                Y += channel_input(mux->el[j], mux->n[j], mux->RL[j], w, &V);
+
+        if (e0->branch == AFC_SHUNT && e0->form == AFC_FORM_PARALLEL_LC) {
+            // take B out of w C - 1/(w L), keeping w C + 1/(w L)
+            double want = -cimag(Y) / 2, bc = w * e0->C, bl = 1 / (w * e0->L);
+            double half = fmax(-MAX_STEP * bc, fmin(MAX_STEP * bl, want));
+            job->clamped[c] = half != want;
+            e->C = (bc + half) / w;
+            e->L = 1 / (w * (bl - half));
+        } else if (e0->branch == AFC_SERIES && e0->form == AFC_FORM_SERIES_LC) {
+            // the same for the reactance of the source beside the others
+            double want = -cimag(1 / (1 / mux->R + Y)) / 2, xl = w * e0->L, xc = 1 / (w * e0->C);
+            double half = fmax(-MAX_STEP * xl, fmin(MAX_STEP * xc, want));
+            job->clamped[c] = half != want;
+            e->L = (xl + half) / w;
+            e->C = 1 / (w * (xc - half));
+        } else {
+            continue;
+        }
+        const afc_element *p = &mux->el[c][0];
+        job->change[c] = fmax(relative(e->C, p->C), relative(e->L, p->L));
+    }
+}
+
+// Return loss at the common port of a channel alone at w, designed first
+// element and all.
+static double alone_rl(const afc_mux *mux, const afc_element *first, int c, double w) {
+    afc_element el[AFC_MAX_ORDER];
+    cplx V;
+    memcpy(el, mux->el[c], mux->n[c] * sizeof *el);
+    el[0] = *first;
+    cplx y = mux->R * channel_input(el, mux->n[c], mux->RL[c], w, &V);
+    cplx r = (1 - y) / (1 + y);
+    return -10 * log10(creal(r) * creal(r) + cimag(r) * cimag(r));
+}
+
+// Whether the corrected bank is matched at every channel centre.
+static int check_match(afc_mux *mux, const afc_element *first, int *err) {
+    int m = mux->channels, ok = 1;
+    double *freq = malloc(2 * (size_t)m * sizeof *freq);
+    if (!freq) {
+        *err = AFC_ERR_MEMORY;
+        return 0;
+    }
+    double *rl = freq + m;
+    for (int c = 0; c < m; c++)
+        freq[c] = mux->spec[c].freq;
+    if ((*err = afc_mux_response(mux, freq, m, rl, NULL)) == AFC_OK) {
+        mux->centre_rl_dB = INFINITY;
+        for (int c = 0; c < m; c++) {
+            double need = fmin(AFC_MUX_MATCH_DB, alone_rl(mux, &first[c], c, 2 * AFC_M_PI * freq[c]) - 1);
+            mux->centre_rl_dB = fmin(mux->centre_rl_dB, rl[c]);
+            if (!(rl[c] >= need))
+                ok = 0;
+        }
+    }
+    free(freq);
+    return ok && *err == AFC_OK;
+}
+
+int afc_mux_init(afc_mux *mux, const afc_mux_config *cfg) {
+    double g[AFC_MAX_ORDER + 1];
+    int m = cfg->channels, err = AFC_OK;
+
+    memset(mux, 0, sizeof *mux);
+    if (m < 1 || m > AFC_MUX_MAX_CHANNELS || !cfg->plan)
+        return AFC_ERR_ARGUMENT;
+    if (cfg->base.order < 1 || cfg->base.order > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+
+    mux->channels = m;
+    mux->R = cfg->base.R;
+    mux->threads = cfg->threads;
+    mux->spec = malloc((size_t)m * sizeof *mux->spec);
+    mux->RL = calloc((size_t)m, sizeof *mux->RL);
+    mux->n = calloc((size_t)m, sizeof *mux->n);
+    mux->el = malloc((size_t)m * sizeof *mux->el);
+    int *errs = malloc((size_t)m * sizeof *errs);
+    afc_element *first = malloc(2 * (size_t)m * sizeof *first);
+    double *change = malloc((size_t)m * sizeof *change);
+    int *clamped = malloc((size_t)m * sizeof *clamped);
+    if (!mux->spec || !mux->RL || !mux->n || !mux->el || !errs || !first || !change || !clamped) {
+        err = AFC_ERR_MEMORY;
+        goto done;
+    }
+
+    for (int c = 0; c < m; c++) {
+        mux->spec[c] = cfg->base;
+        mux->spec[c].type = AFC_BANDPASS;
+        mux->spec[c].freq = cfg->plan[c].freq;
+        mux->spec[c].bw = cfg->plan[c].bw;
+    }
+
+    // every channel scales the same prototype; elliptic designs depend on
+    // the fractional bandwidth and go through afc_design()'s cache instead
+    mux_job job = { mux, NULL, errs, first, first + m, change, clamped };
+    if (cfg->base.family != AFC_ELLIPTIC) {
+        long t0 = afc_stats_begin();
+        err = afc_prototype(cfg->base.family, cfg->base.order, cfg->base.ripple_dB, cfg->base.norm, g);
+        afc_stats_end(AFC_STAGE_PROTOTYPE, t0);
+        if (err != AFC_OK)
+            goto done;
+        job.g = g;
+    }
+    afc_parallel_for(m, DESIGN_CHUNK, cfg->threads, design_chunk, &job);
+    for (int c = 0; c < m && err == AFC_OK; c++)
+        err = errs[c];
+    if (err != AFC_OK || cfg->raw)
+        goto done;
+
+    // all channels from the previous pass at once, so the passes do not
+    // depend on the channel order or the thread count
+    for (mux->iterations = 0; mux->iterations < AFC_MUX_ITERATIONS; ) {
+        afc_parallel_for(m, DESIGN_CHUNK, cfg->threads, correct_chunk, &job);
+        mux->residual = 0;
+        mux->clamped = 0;
+        for (int c = 0; c < m; c++) {
+            mux->el[c][0] = job.next[c];
+            mux->residual = fmax(mux->residual, change[c]);
+            mux->clamped += clamped[c];
+        }
+        mux->iterations++;
+        if (mux->residual < AFC_MUX_TOLERANCE)
+            break;
+    }
+    // a clamped element stops moving, so a zero change alone proves nothing
+    mux->converged = check_match(mux, first, &err) && !mux->clamped &&
+                     mux->residual < AFC_MUX_TOLERANCE;
+
+done:
+    free(errs);
+    free(first);
+    free(change);
+    free(clamped);
+    return err;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Combined response                                                      */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    const afc_mux *mux;
+    const double *freq;
+    long count;
+    double *rl_dB, *il_dB;
+} response_job;
+
+static double power(cplx z) {
+    return creal(z) * creal(z) + cimag(z) * cimag(z);
+}
+
+// The junction voltage is Vs / (1 + Rs Y) for the sum Y of the channel
+// admittances; a channel's output is that divided by its V.
+static void response_chunk(void *ctx, long begin, long end, int tid) {
+    const response_job *job = ctx;
+    const afc_mux *mux = job->mux;
+    cplx V[AFC_MUX_MAX_CHANNELS];
+    (void)tid;
+
+    for (long k = begin; k < end; k++) {
+        double w = 2 * AFC_M_PI * job->freq[k];
+        cplx Y = 0;
+        for (int c = 0; c < mux->channels; c++)
+            Y += channel_input(mux->el[c], mux->n[c], mux->RL[c], w, &V[c]);
+
+        cplx d = 1 + mux->R * Y;
+        if (job->rl_dB)
+            job->rl_dB[k] = -10 * log10(power((1 - mux->R * Y) / d));
+        if (job->il_dB)
+            for (int c = 0; c < mux->channels; c++) {
+                // S = 2 (V2 / Vs) sqrt(Rs / RL)
+                double s = 4 * mux->R / mux->RL[c] / power(d * V[c]);
+                job->il_dB[(size_t)c * job->count + k] = -10 * log10(s);
+            }
+    }
+}
+
+int afc_mux_response(const afc_mux *mux, const double *freq, long count,
+                     double *rl_dB, double *il_dB) {
+    if (mux->channels < 1 || !(mux->R > 0))
+        return AFC_ERR_ARGUMENT;
+    for (long k = 0; k < count; k++)
+        if (!(freq[k] > 0) || !isfinite(freq[k]))
+            return AFC_ERR_FREQ;
+
+    response_job job = { mux, freq, count, rl_dB, il_dB };
+    long t0 = afc_stats_begin();
+    afc_parallel_for(count, MUX_CHUNK, mux->threads, response_chunk, &job);
+    afc_stats_end(AFC_STAGE_RESPONSE, t0);
+    return AFC_OK;
+}
@@ -0,0 +1,85 @@
+/*
+ * Analog Filter Calculator - multiplexers and filter banks
+ * Designs a bank of band-pass channels that share one common port (a star
+ * junction): a diplexer, a contiguous or channelized multiplexer. Every
+ * channel is a ladder of the same family, order and topology, scaled to
+ * its own centre frequency and bandwidth from one prototype.
+ *
+ * Connected in parallel, each channel is loaded by the admittance of all
+ * the others. Inside a channel's pass band the others are out of band and
+ * nearly reactive, so the loading mostly detunes the channel's first
+ * resonator. afc_mux_init() annuls it: at the channel centre frequency,
+ *   PI  (shunt first)   the susceptance B of the other channels is taken
+ *                       out of the first parallel resonator,
+ *   Tee (series first)  the reactance X of the source in parallel with the
+ *                       other channels is taken out of the first series
+ *                       resonator,
+ * in both cases keeping the resonator's slope at the centre. Since every
+ * correction changes what the other channels see, the corrections are
+ * repeated (all channels at once, from the previous pass) until they
+ * settle. Series-first (Tee) channels look like open circuits out of band,
+ * which is what a star junction wants; shunt-first channels are near
+ * shorts out of band at any spacing, which the first resonator cannot
+ * take out: their correction runs into its limit and the bank comes back
+ * unconverged.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_MUX_H
+#define AFC_MUX_H
+
+#include "afc.h"
+
+#define AFC_MUX_MAX_CHANNELS 1024
+#define AFC_MUX_ITERATIONS   16      // correction passes at most
+#define AFC_MUX_TOLERANCE    1e-9    // ... until no correction moves by more (relative)
+#define AFC_MUX_MATCH_DB     10.0    // return loss a corrected bank needs at each channel
+                                     // centre (less if the channel alone has less)
+
+typedef struct {
+    double freq, bw;       // centre frequency and bandwidth in Hz
+} afc_mux_channel;
+
+typedef struct {
+    afc_spec base;         // family, order, ripple, topology, impedance,
+                           // norm and stop; type, freq and bw are per channel
+    int channels;
+    const afc_mux_channel *plan;
+    int raw;               // 1 = leave the junction loading uncorrected
+    int threads;           // 0 = all cores
+} afc_mux_config;
+
+typedef struct {
+    int channels;
+    double R;              // common port impedance
+    afc_spec *spec;        // per channel
+    double *RL;            // channel load impedance
+    int *n;                // elements per channel
+    afc_element (*el)[AFC_MAX_ORDER];
+    int iterations;        // correction passes made
+    double residual;       // last relative change of a corrected element
+    int clamped;           // channels whose correction hit its limit in the last pass
+    double centre_rl_dB;   // lowest common-port return loss at a channel centre
+    int converged;         // 1 if the correction settled, unclamped, with every
+                           // centre matched; 0 also for a raw bank
+    int threads;
+} afc_mux;
+
+// Design the channels of cfg and correct them for the junction. Free with
+// afc_mux_free(), also after an error. A correction that cannot settle
+// (typically shunt-first channels too close together, where the first
+// resonator is driven to its limit) is not an error: the bank is returned
+// with converged 0 and is then likely worse than the raw one.
+int afc_mux_init(afc_mux *mux, const afc_mux_config *cfg);
+void afc_mux_free(afc_mux *mux);
+
+// Response of the whole bank at count frequencies: the return loss at the
+// common port (rl_dB, count entries) and the insertion loss from it to
+// each channel output (il_dB, channels * count entries indexed
+// [c * count + k]). Either may be NULL.
+int afc_mux_response(const afc_mux *mux, const double *freq, long count,
+                     double *rl_dB, double *il_dB);
+
+#endif
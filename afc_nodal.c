@@ -0,0 +1,401 @@
+/*
+ * Analog Filter Calculator - nodal ladder simulator
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <complex.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "afc_nodal.h"
+
+#define MAX_PARTS   (4 * AFC_MAX_ORDER + 16)
+#define MAX_NAMES   (2 * MAX_PARTS + 2)
+#define NAME_LEN    24
+#define LINE_LEN    512
+
+typedef double complex cplx;
+
+typedef struct {
+    int a, b;              // node ids, 0 is ground
+    int live;
+    afc_net_branch br;
+} net_edge;
+
+typedef struct {
+    char names[MAX_NAMES][NAME_LEN];
+    int count;
+    net_edge edges[MAX_PARTS];
+    int nedges;
+} net_graph;
+
+/* ---------------------------------------------------------------------- */
+/* Netlist text                                                           */
+/* ---------------------------------------------------------------------- */
+
+static int node_id(net_graph *g, const char *name) {
+    if (!strcmp(name, "0") || !strcasecmp(name, "gnd"))
+        return 0;
+    for (int i = 1; i < g->count; i++)
+        if (!strcasecmp(g->names[i], name))
+            return i;
+    if (g->count >= MAX_NAMES || strlen(name) >= NAME_LEN)
+        return -1;
+    strcpy(g->names[g->count], name);
+    return g->count++;
+}
+
+// SPICE number: mantissa, optional scale suffix, anything after it (units)
+// ignored. Returns 0 if there is no number.
+static int parse_value(const char *s, double *out) {
+    static const struct { const char *suffix; double scale; } scales[] = {
+        { "meg", 1e6 }, { "f", 1e-15 }, { "p", 1e-12 }, { "n", 1e-9 }, { "u", 1e-6 },
+        { "m", 1e-3 }, { "k", 1e3 }, { "g", 1e9 }, { "t", 1e12 }
+    };
+    char *end;
+    double v = strtod(s, &end);
+    if (end == s)
+        return 0;
+    for (size_t i = 0; i < sizeof scales / sizeof scales[0]; i++)
+        if (!strncasecmp(end, scales[i].suffix, strlen(scales[i].suffix))) {
+            v *= scales[i].scale;
+            break;
+        }
+    *out = v;
+    return 1;
+}
+
+// Terminations from an exported header "* ..., source 50.0000 ohm, load 50.0000 ohm"
+static void parse_terminations(const char *line, double *Rs, double *RL) {
+    const char *s = strstr(line, "source ");
+    const char *l = strstr(line, "load ");
+    double rs, rl;
+    if (s && l && sscanf(s + 7, "%lf", &rs) == 1 && sscanf(l + 5, "%lf", &rl) == 1 && rs > 0 && rl > 0) {
+        *Rs = rs;
+        *RL = rl;
+    }
+}
+
+static int split(char *line, char **tok, int max) {
+    int n = 0;
+    for (char *p = strtok(line, " \t\r\n"); p && n < max; p = strtok(NULL, " \t\r\n"))
+        tok[n++] = p;
+    return n;
+}
+
+// Read the subcircuit into g; ports go to *in and *out.
+static int read_subckt(const char *text, const char *name, net_graph *g, int *in, int *out,
+                       afc_ladder_net *net) {
+    char line[LINE_LEN], *tok[8];
+    int inside = 0, found = 0;
+    double Rs = 0, RL = 0;
+
+    while (*text) {
+        size_t len = strcspn(text, "\n");
+        if (len >= sizeof line)
+            return AFC_ERR_NETLIST;
+        memcpy(line, text, len);
+        line[len] = '\0';
+        text += len + (text[len] == '\n');
+
+        char *p = line;
+        while (isspace((unsigned char)*p))
+            p++;
+        if (*p == '*') {
+            if (!inside)
+                parse_terminations(p, &Rs, &RL);
+            continue;
+        }
+        p[strcspn(p, ";$")] = '\0';
+        int n = split(p, tok, 8);
+        if (n == 0)
+            continue;
+
+        if (!strcasecmp(tok[0], ".subckt")) {
+            if (inside)
+                return AFC_ERR_NETLIST;
+            if (n < 2 || (name && strcasecmp(tok[1], name))) {
+                Rs = RL = 0;
+                continue;
+            }
+            int ports = 0;
+            while (ports + 2 < n && !strchr(tok[ports + 2], '='))
+                ports++;
+            if (ports != 2 || strlen(tok[1]) >= sizeof net->name)
+                return AFC_ERR_NETLIST;
+            strcpy(net->name, tok[1]);
+            net->Rs = Rs;
+            net->RL = RL;
+            *in = node_id(g, tok[2]);
+            *out = node_id(g, tok[3]);
+            if (*in <= 0 || *out <= 0)
+                return AFC_ERR_NETLIST;
+            inside = found = 1;
+        } else if (!strcasecmp(tok[0], ".ends")) {
+            if (inside)
+                break;
+        } else if (!inside || tok[0][0] == '.') {
+            continue;
+        } else {
+            char kind = (char)toupper((unsigned char)tok[0][0]);
+            double v;
+            if ((kind != 'R' && kind != 'L' && kind != 'C') || n < 4 || !parse_value(tok[3], &v))
+                return AFC_ERR_NETLIST;
+            if (!(v > 0) || !isfinite(v))
+                return AFC_ERR_ELEMENT;
+            int a = node_id(g, tok[1]), b = node_id(g, tok[2]);
+            if (a < 0 || b < 0 || g->nedges >= MAX_PARTS)
+                return AFC_ERR_NETLIST;
+            if (a == b)
+                continue;       // shorted part, carries no current
+            net_edge *e = &g->edges[g->nedges++];
+            memset(e, 0, sizeof *e);
+            e->a = a;
+            e->b = b;
+            e->live = 1;
+            e->br.nchains = 1;
+            if (kind == 'R') e->br.chain[0].R = v;
+            if (kind == 'L') e->br.chain[0].L = v;
+            if (kind == 'C') e->br.chain[0].S = 1 / v;
+        }
+    }
+    return found ? AFC_OK : AFC_ERR_NETLIST;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Reduction to a ladder                                                  */
+/* ---------------------------------------------------------------------- */
+
+static int same_pair(const net_edge *x, const net_edge *y) {
+    return (x->a == y->a && x->b == y->b) || (x->a == y->b && x->b == y->a);
+}
+
+// Merge parallel edges and eliminate inner nodes joining two single-chain
+// edges (or dangling from one) until nothing changes.
+static int reduce(net_graph *g, int in, int out) {
+    for (int changed = 1; changed;) {
+        changed = 0;
+        for (int i = 0; i < g->nedges; i++)
+            for (int j = i + 1; g->edges[i].live && j < g->nedges; j++) {
+                net_edge *x = &g->edges[i], *y = &g->edges[j];
+                if (!y->live || !same_pair(x, y))
+                    continue;
+                if (x->br.nchains + y->br.nchains > AFC_NET_MAX_CHAINS)
+                    return AFC_ERR_NETLIST;
+                memcpy(&x->br.chain[x->br.nchains], y->br.chain, y->br.nchains * sizeof *y->br.chain);
+                x->br.nchains += y->br.nchains;
+                y->live = 0;
+                changed = 1;
+            }
+
+        for (int v = 1; v < g->count; v++) {
+            int hit[3], deg = 0;
+            if (v == in || v == out)
+                continue;
+            for (int i = 0; i < g->nedges && deg < 3; i++)
+                if (g->edges[i].live && (g->edges[i].a == v || g->edges[i].b == v))
+                    hit[deg++] = i;
+            if (deg == 1) {
+                g->edges[hit[0]].live = 0;
+                changed = 1;
+            } else if (deg == 2) {
+                net_edge *x = &g->edges[hit[0]], *y = &g->edges[hit[1]];
+                if (x->br.nchains != 1 || y->br.nchains != 1)
+                    continue;
+                int u = x->a == v ? x->b : x->a, w = y->a == v ? y->b : y->a;
+                y->live = 0;
+                changed = 1;
+                if (u == w) {
+                    x->live = 0;   // closed loop through v
+                    continue;
+                }
+                x->a = u;
+                x->b = w;
+                x->br.chain[0].R += y->br.chain[0].R;
+                x->br.chain[0].L += y->br.chain[0].L;
+                x->br.chain[0].S += y->br.chain[0].S;
+            }
+        }
+    }
+    return AFC_OK;
+}
+
+// Walk from the input port along the series edges; every node may have one
+// shunt edge to ground and the walk has to end on the output port.
+static int to_ladder(const net_graph *g, int in, int out, afc_ladder_net *net) {
+    int used = 0, live = 0, cur = in, from = -1;
+    char seen[MAX_NAMES] = {0};
+
+    for (int i = 0; i < g->nedges; i++)
+        live += g->edges[i].live;
+    net->nodes = 0;
+    for (;;) {
+        int k = net->nodes, next = -1;
+        if (seen[cur] || k >= AFC_NET_MAX_NODES)
+            return AFC_ERR_NETLIST;
+        seen[cur] = 1;
+        memset(&net->shunt[k], 0, sizeof net->shunt[k]);
+        memset(&net->series[k], 0, sizeof net->series[k]);
+        for (int i = 0; i < g->nedges; i++) {
+            const net_edge *e = &g->edges[i];
+            if (!e->live || i == from || (e->a != cur && e->b != cur))
+                continue;
+            if (e->a == 0 || e->b == 0) {
+                net->shunt[k] = e->br;
+                used++;
+            } else if (next >= 0) {
+                return AFC_ERR_NETLIST;    // a branch, not a ladder
+            } else {
+                next = i;
+            }
+        }
+        net->nodes++;
+        if (next < 0)
+            break;
+        net->series[k] = g->edges[next].br;
+        used++;
+        from = next;
+        cur = g->edges[next].a == cur ? g->edges[next].b : g->edges[next].a;
+    }
+    return cur == out && used == live ? AFC_OK : AFC_ERR_NETLIST;
+}
+
+int afc_netlist_parse(const char *text, const char *name, afc_ladder_net *net) {
+    net_graph *g = malloc(sizeof *g);
+    int in = 0, out = 0, err;
+    if (!g)
+        return AFC_ERR_MEMORY;
+    memset(net, 0, sizeof *net);
+    g->count = 1;
+    g->nedges = 0;
+    if ((err = read_subckt(text, name, g, &in, &out, net)) == AFC_OK &&
+        (err = reduce(g, in, out)) == AFC_OK)
+        err = to_ladder(g, in, out, net);
+    free(g);
+    return err;
+}
+
+int afc_ladder_net_from_elements(const afc_element *el, int n, afc_ladder_net *net) {
+    int k = 0;
+    memset(net, 0, sizeof *net);
+    for (int i = 0; i < n; i++) {
+        const afc_element *e = &el[i];
+        afc_net_branch *br = e->branch == AFC_SERIES ? &net->series[k] : &net->shunt[k];
+        if (br->nchains || k >= AFC_NET_MAX_NODES - 1)
+            return AFC_ERR_ELEMENT;
+        switch (e->form) {
+        case AFC_FORM_C:
+            br->chain[br->nchains++].S = 1 / e->C;
+            break;
+        case AFC_FORM_L:
+            br->chain[br->nchains++].L = e->L;
+            break;
+        case AFC_FORM_SERIES_LC:
+            br->chain[0].L = e->L;
+            br->chain[0].S = 1 / e->C;
+            br->nchains = 1;
+            break;
+        case AFC_FORM_PARALLEL_LC:
+            br->chain[0].L = e->L;
+            br->chain[1].S = 1 / e->C;
+            br->nchains = 2;
+            break;
+        }
+        if (e->branch == AFC_SERIES)
+            k++;
+    }
+    net->nodes = k + 1;
+    return AFC_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* AC solve                                                               */
+/* ---------------------------------------------------------------------- */
+
+// Admittance of a branch and its derivative with respect to w.
+static cplx branch_admittance(const afc_net_branch *br, double w, cplx *dY) {
+    cplx Y = 0;
+    *dY = 0;
+    for (int c = 0; c < br->nchains; c++) {
+        const afc_net_chain *ch = &br->chain[c];
+        cplx y = 1 / (ch->R + I * (w * ch->L - ch->S / w) + 1e-300);
+        Y += y;
+        *dY -= y * y * I * (ch->L + ch->S / (w * w));
+    }
+    return Y;
+}
+
+int afc_nodal_response(const afc_ladder_net *net, double Rs, double RL,
+                       const double *freq, long count, const afc_response *out) {
+    int N = net->nodes;
+    if (N < 1 || N > AFC_NET_MAX_NODES)
+        return AFC_ERR_NETLIST;
+    if (!(Rs > 0) || !(RL > 0))
+        return AFC_ERR_IMPEDANCE;
+
+    for (long f = 0; f < count; f++) {
+        double w = 2 * AFC_M_PI * freq[f];
+        cplx d[AFC_NET_MAX_NODES], dd[AFC_NET_MAX_NODES];     // diagonal, d/dw
+        cplx o[AFC_NET_MAX_NODES], od[AFC_NET_MAX_NODES];     // off-diagonal, d/dw
+        cplx m[AFC_NET_MAX_NODES], c[AFC_NET_MAX_NODES];      // factorization
+        cplx v[AFC_NET_MAX_NODES], vd[AFC_NET_MAX_NODES];     // node voltages, d/dw
+        if (!(w > 0))
+            return AFC_ERR_FREQ;
+
+        // nodal admittance matrix, source as a 1 V Norton equivalent
+        for (int k = 0; k < N; k++) {
+            d[k] = branch_admittance(&net->shunt[k], w, &dd[k]);
+            o[k] = 0;
+            od[k] = 0;
+        }
+        for (int k = 0; k + 1 < N; k++) {
+            cplx ys = branch_admittance(&net->series[k], w, &od[k]);
+            d[k] += ys;
+            d[k + 1] += ys;
+            dd[k] += od[k];
+            dd[k + 1] += od[k];
+            o[k] = -ys;
+            od[k] = -od[k];
+        }
+        d[0] += 1 / Rs;
+        d[N - 1] += 1 / RL;
+
+        // Thomas elimination: A = L U with unit upper bidiagonal U
+        m[0] = d[0];
+        v[0] = 1 / Rs / m[0];
+        for (int k = 1; k < N; k++) {
+            c[k - 1] = o[k - 1] / m[k - 1];
+            m[k] = d[k] - o[k - 1] * c[k - 1];
+            v[k] = -o[k - 1] * v[k - 1] / m[k];
+        }
+        for (int k = N - 2; k >= 0; k--)
+            v[k] -= c[k] * v[k + 1];
+
+        // A v' = -A' v with the same factors
+        for (int k = 0; k < N; k++) {
+            cplx r = -dd[k] * v[k];
+            if (k > 0)     r -= od[k - 1] * v[k - 1];
+            if (k + 1 < N) r -= od[k] * v[k + 1];
+            vd[k] = (k > 0 ? r - o[k - 1] * vd[k - 1] : r) / m[k];
+        }
+        for (int k = N - 2; k >= 0; k--)
+            vd[k] -= c[k] * vd[k + 1];
+
+        cplx s21 = 2 * v[N - 1] * sqrt(Rs / RL);
+        cplx s11 = 2 * v[0] - 1;
+        if (out->s21_re) out->s21_re[f] = creal(s21);
+        if (out->s21_im) out->s21_im[f] = cimag(s21);
+        if (out->s11_re) out->s11_re[f] = creal(s11);
+        if (out->s11_im) out->s11_im[f] = cimag(s11);
+        if (out->il_dB)  out->il_dB[f] = -20 * log10(cabs(s21));
+        if (out->rl_dB)  out->rl_dB[f] = -20 * log10(cabs(s11));
+        if (out->gd)     out->gd[f] = -cimag(vd[N - 1] / v[N - 1]);
+    }
+    return AFC_OK;
+}
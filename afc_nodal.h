@@ -0,0 +1,59 @@
+/*
+ * Analog Filter Calculator - nodal ladder simulator
+ * AC analysis of a ladder read back from a SPICE netlist, e.g. one exported
+ * with filter_batch -o spice. The netlist is reduced to a chain of nodes
+ * from the input to the output port, joined by series branches and loaded
+ * by shunt branches to ground. Its nodal admittance matrix is then
+ * tridiagonal and each frequency is solved in O(n) by Thomas elimination;
+ * a second sweep of the same factorization gives the group delay.
+ *
+ * Accepted input: one .SUBCKT with two ports (the first one in the file, or
+ * the one named), R/L/C lines with SPICE scale suffixes (f p n u m k meg
+ * g t), '*' comment lines and ';' / '$' trailing comments. Components in
+ * series through an inner node and components in parallel are merged into
+ * branches, so series and parallel LC arms of BP/BR ladders are handled.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_NODAL_H
+#define AFC_NODAL_H
+
+#include "afc.h"
+#include "afc_response.h"
+
+#define AFC_NET_MAX_NODES   (2 * AFC_MAX_ORDER + 2)
+#define AFC_NET_MAX_CHAINS  4        // parallel paths per branch
+
+// Series connection of resistance, inductance and capacitance:
+// Z = R + j (w L - S / w) with S the sum of 1/C.
+typedef struct {
+    double R, L, S;
+} afc_net_chain;
+
+// Parallel connection of chains; nchains = 0 is an open circuit.
+typedef struct {
+    int nchains;
+    afc_net_chain chain[AFC_NET_MAX_CHAINS];
+} afc_net_branch;
+
+typedef struct {
+    char name[32];
+    int nodes;                               // ladder nodes, input first
+    afc_net_branch shunt[AFC_NET_MAX_NODES];  // node k to ground
+    afc_net_branch series[AFC_NET_MAX_NODES]; // node k to node k + 1
+    double Rs, RL;   // terminations from the exported header comment, else 0
+} afc_ladder_net;
+
+// Reduce the subcircuit name (NULL: the first one) in the netlist text.
+int afc_netlist_parse(const char *text, const char *name, afc_ladder_net *net);
+
+// The same ladder built directly from designed elements.
+int afc_ladder_net_from_elements(const afc_element *el, int n, afc_ladder_net *net);
+
+// Response between a source Rs and a load RL, as afc_ladder_response().
+int afc_nodal_response(const afc_ladder_net *net, double Rs, double RL,
+                       const double *freq, long count, const afc_response *out);
+
+#endif
@@ -0,0 +1,329 @@
+/*
+ * Analog Filter Calculator - order selection
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "afc_order.h"
+#include "afc_parallel.h"
+
+#define LANES        4
+#define BATCH_CHUNK  1024
+
+typedef double vdouble __attribute__((vector_size(LANES * sizeof(double))));
+typedef long vlong __attribute__((vector_size(LANES * sizeof(long))));
+
+/* ---------------------------------------------------------------------- */
+/* Masks                                                                  */
+/* ---------------------------------------------------------------------- */
+
+// f mapped onto the low-pass prototype axis (1 = cutoff), or -1 if invalid.
+static double prototype_freq(const afc_order_spec *s, double f) {
+    double F = s->freq, BW = s->bw;
+    if (!(f > 0) || !isfinite(f))
+        return -1;
+    switch (s->type) {
+    case AFC_LOWPASS:    return f / F;
+    case AFC_HIGHPASS:   return F / f;
+    case AFC_BANDPASS:   return fabs(f * f - F * F) / (f * BW);
+    case AFC_BANDREJECT: return f == F ? INFINITY : f * BW / fabs(F * F - f * f);
+    }
+    return -1;
+}
+
+// Validate the parts of a mask that do not depend on the order.
+static int check_spec(const afc_order_spec *s) {
+    if (s->family < AFC_BUTTERWORTH || s->family > AFC_ELLIPTIC)
+        return AFC_ERR_FAMILY;
+    if (s->type < AFC_LOWPASS || s->type > AFC_BANDREJECT)
+        return AFC_ERR_TYPE;
+    if (!(s->freq > 0) || ((s->type == AFC_BANDPASS || s->type == AFC_BANDREJECT) && !(s->bw > 0)))
+        return AFC_ERR_FREQ;
+    if ((s->family == AFC_CHEBYSHEV || s->family == AFC_ELLIPTIC)
+            && (!(s->ripple_dB > 0) || s->ripple_dB > 20))
+        return AFC_ERR_RIPPLE;
+    // the elliptic design is for a stop-band loss of atten_dB
+    if (s->family == AFC_ELLIPTIC && (!(s->atten_dB > s->ripple_dB) || s->atten_dB > 300))
+        return AFC_ERR_STOPBAND;
+    if (!(s->atten_dB >= 0) || !(s->delay_tol >= 0) || s->delay_tol >= 1)
+        return AFC_ERR_ARGUMENT;
+    if (s->delay_tol > 0 && s->family != AFC_BESSEL)
+        return AFC_ERR_ARGUMENT;
+    if (s->delay_tol > 0 && !(prototype_freq(s, s->delay_freq) >= 0))
+        return AFC_ERR_FREQ;
+    return AFC_OK;
+}
+
+// 10 log10(1 + 10^l) without overflow for large l
+static double db_1p(double l) {
+    return l > 0 ? 10 * (l + log10(1 + pow(10, -l))) : 10 * log10(1 + pow(10, l));
+}
+
+// log10 |T_n(w)| of the Chebyshev polynomial
+static double log10_chebyshev(int n, double w) {
+    if (w <= 1)
+        return log10(fabs(cos(n * acos(w))));
+    double y = n * acosh(w);
+    return (y - log(2.0) + log1p(exp(-2 * y))) / log(10.0);
+}
+
+// Ripple-edge frequency per unit of cutoff frequency for the spec's norm
+static double chebyshev_scale(const afc_order_spec *s, int n, double eps2) {
+    if (s->norm == AFC_NORM_RIPPLE || eps2 >= 1)
+        return 1;
+    return cosh(acosh(1 / sqrt(eps2)) / n);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Bessel                                                                 */
+/* ---------------------------------------------------------------------- */
+
+/*
+ * With b_n(s) = B_n(s) / B_n(0) the reverse Bessel recurrence
+ * B_n = (2n-1) B_n-1 + s^2 B_n-2 becomes
+ *   b_n = b_n-1 + s^2 b_n-2 / ((2n-1)(2n-3)),  b_0 = 1, b_1 = 1 + s
+ * which stays in range for any order. At s = jw, |b_n|^2 is the loss as a
+ * power ratio and Re(b_n' / b_n) the group delay relative to DC.
+ */
+static double recurrence_coef(int m) {
+    return 1.0 / ((2 * m - 1) * (2 * m - 3));
+}
+
+// Smallest orders of up to LANES checked Bessel masks, all lanes at once.
+static void bessel_orders(const afc_order_spec *const *s, int count, int *order) {
+    vdouble wa = {0}, wd = {0}, target = {0}, keep = {0}, cut = {0};
+    vlong needA = {0}, needD = {0}, found = {0};
+    double coef[AFC_MAX_ORDER + 1];
+    int err = AFC_ERR_ORDER;
+
+    for (int l = 0; l < LANES; l++) {
+        if (l >= count) {
+            found[l] = -1;
+            continue;
+        }
+        wa[l] = s[l]->atten_dB > 0 ? prototype_freq(s[l], s[l]->offset) : 0;
+        wd[l] = s[l]->delay_tol > 0 ? prototype_freq(s[l], s[l]->delay_freq) : 0;
+        target[l] = pow(10, s[l]->atten_dB / 10);
+        keep[l] = 1 - s[l]->delay_tol;
+        cut[l] = s[l]->norm != AFC_NORM_DELAY;
+        needA[l] = s[l]->atten_dB > 0 ? -1 : 0;
+        needD[l] = s[l]->delay_tol > 0 ? -1 : 0;
+    }
+    for (int m = 2; m <= AFC_MAX_ORDER; m++)
+        coef[m] = recurrence_coef(m);
+
+    for (int n = 1; n <= AFC_MAX_ORDER; n++) {
+        double w3db;
+        if ((err = afc_bessel_cutoff(n, &w3db)) != AFC_OK)
+            break;
+        err = AFC_ERR_ORDER;
+
+        // prototype frequencies in the unit-delay scale of this order
+        vdouble k = cut * w3db + (1 - cut);
+        vdouble xa = wa * k, xd = wd * k;
+        vdouble sa = -xa * xa, sd = -xd * xd;
+
+        vdouble ar0 = 1 + 0 * xa, ai0 = 0 * xa, ar1 = ar0, ai1 = xa;
+        vdouble dr0 = ar0, di0 = ai0, dr1 = dr0, di1 = xd;     // b at jxd
+        vdouble pr0 = ai0, pi0 = ai0, pr1 = ar0, pi1 = ai0;    // b' at jxd
+        for (int m = 2; m <= n; m++) {
+            vdouble c = coef[m] + 0 * xa;
+            vdouble ar = ar1 + c * sa * ar0, ai = ai1 + c * sa * ai0;
+            // (2s b + s^2 b') with 2s = 2j xd
+            vdouble pr = pr1 + c * (-2 * xd * di0 + sd * pr0);
+            vdouble pi = pi1 + c * (2 * xd * dr0 + sd * pi0);
+            vdouble dr = dr1 + c * sd * dr0, di = di1 + c * sd * di0;
+            ar0 = ar1; ai0 = ai1; ar1 = ar; ai1 = ai;
+            dr0 = dr1; di0 = di1; dr1 = dr; di1 = di;
+            pr0 = pr1; pi0 = pi1; pr1 = pr; pi1 = pi;
+        }
+
+        vdouble magA = ar1 * ar1 + ai1 * ai1, magD = dr1 * dr1 + di1 * di1;
+        vlong okA = (magA >= target) | ~needA;
+        vlong okD = (pr1 * dr1 + pi1 * di1 >= keep * magD) | ~needD;
+        vlong newly = okA & okD & (found == 0);
+        found = (found & ~newly) | ((vlong){n, n, n, n} & newly);
+
+        int done = 1;
+        for (int l = 0; l < LANES; l++)
+            done &= found[l] != 0;
+        if (done)
+            break;
+    }
+    for (int l = 0; l < count; l++)
+        order[l] = found[l] > 0 ? (int)found[l] : err;
+}
+
+// |b_n(jw)|^2 for a single order
+static double bessel_loss_ratio(int n, double w) {
+    double r0 = 1, i0 = 0, r1 = 1, i1 = w, s2 = -w * w;
+    for (int m = 2; m <= n; m++) {
+        double c = recurrence_coef(m);
+        double r = r1 + c * s2 * r0, i = i1 + c * s2 * i0;
+        r0 = r1; i0 = i1; r1 = r; i1 = i;
+    }
+    return r1 * r1 + i1 * i1;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Single masks                                                           */
+/* ---------------------------------------------------------------------- */
+
+/*
+ * Elliptic order from the degree equation at the ripple edge (the mask's
+ * offset is then the stop-band edge), walked down while the -3 dB
+ * normalization, which moves the ripple edge below the cutoff, allows it
+ * and the lower order has a ladder.
+ */
+static int elliptic_order(const afc_order_spec *s, double w) {
+    int n = afc_elliptic_order(s->ripple_dB, s->atten_dB, w);
+    double a, g[AFC_MAX_ORDER + 1], gz[AFC_MAX_ORDER + 1], f3dB, ws;
+    while (n > 1 && s->norm != AFC_NORM_RIPPLE
+           && afc_elliptic_loss(n - 1, s->ripple_dB, s->atten_dB, s->norm, w, &a) == AFC_OK
+           && a >= s->atten_dB - 1e-9
+           && afc_elliptic_synthesize(n - 1, s->ripple_dB, s->atten_dB, g, gz, &f3dB, &ws) != AFC_ERR_ELLIPTIC)
+        n--;
+    return n;
+}
+
+// Order for a checked Butterworth, Chebyshev or elliptic mask
+static int closed_form_order(const afc_order_spec *s) {
+    double w = prototype_freq(s, s->offset);
+    double need = pow(10, s->atten_dB / 10) - 1;
+    int n;
+
+    if (!(s->atten_dB > 0))
+        return 1;
+    if (!(w > 1))
+        return AFC_ERR_FREQ;
+    if (s->family == AFC_BUTTERWORTH) {
+        n = (int)fmax(1, ceil(log10(need) / (2 * log10(w)) - 1e-9));
+        return n <= AFC_MAX_ORDER ? n : AFC_ERR_ORDER;
+    }
+    if (s->family == AFC_ELLIPTIC)
+        return elliptic_order(s, w);
+
+    // arccosh formula at the ripple edge, then walk down while the -3 dB
+    // normalization (which moves the ripple edge below the cutoff) allows it
+    double eps2 = pow(10, s->ripple_dB / 10) - 1;
+    double x = sqrt(need / eps2);
+    n = x <= 1 ? 1 : (int)fmin(AFC_MAX_ORDER + 1, fmax(1, ceil(acosh(x) / acosh(w) - 1e-9)));
+    while (n > 1 && db_1p(log10(eps2) + 2 * log10_chebyshev(n - 1, w * chebyshev_scale(s, n - 1, eps2)))
+                    >= s->atten_dB - 1e-9)
+        n--;
+    return n <= AFC_MAX_ORDER ? n : AFC_ERR_ORDER;
+}
+
+int afc_min_order(const afc_order_spec *spec) {
+    int err = check_spec(spec), order;
+    if (err != AFC_OK)
+        return err;
+    if (spec->atten_dB > 0 && !(prototype_freq(spec, spec->offset) > 1))
+        return AFC_ERR_FREQ;
+    if (spec->family != AFC_BESSEL)
+        return closed_form_order(spec);
+    bessel_orders(&spec, 1, &order);
+    return order;
+}
+
+int afc_rejection(const afc_order_spec *spec, int order, double *atten_dB) {
+    int err = check_spec(spec);
+    double w = prototype_freq(spec, spec->offset);
+    if (err != AFC_OK)
+        return err;
+    if (order < 1 || order > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    if (!(w >= 0))
+        return AFC_ERR_FREQ;
+    if (isinf(w)) {
+        *atten_dB = INFINITY;
+        return AFC_OK;
+    }
+
+    switch (spec->family) {
+    case AFC_BUTTERWORTH:
+        *atten_dB = db_1p(2 * order * log10(w));
+        break;
+    case AFC_CHEBYSHEV: {
+        double eps2 = pow(10, spec->ripple_dB / 10) - 1;
+        *atten_dB = db_1p(log10(eps2) + 2 * log10_chebyshev(order, w * chebyshev_scale(spec, order, eps2)));
+        break;
+    }
+    case AFC_BESSEL: {
+        double w3db = 1;
+        if (spec->norm != AFC_NORM_DELAY && (err = afc_bessel_cutoff(order, &w3db)) != AFC_OK)
+            return err;
+        *atten_dB = 10 * log10(bessel_loss_ratio(order, w * w3db));
+        break;
+    }
+    case AFC_ELLIPTIC:
+        return afc_elliptic_loss(order, spec->ripple_dB, spec->atten_dB, spec->norm, w, atten_dB);
+    }
+    return AFC_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Batches                                                                */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    const afc_order_spec *spec;
+    const int *order;
+    int *order_out;
+    double *atten_out;
+} batch_job;
+
+static void order_chunk(void *ctx, long begin, long end, int tid) {
+    batch_job *job = ctx;
+    const afc_order_spec *lane[LANES];
+    long at[LANES];
+    int nlane = 0, res[LANES];
+    (void)tid;
+
+    for (long i = begin; i < end; i++) {
+        const afc_order_spec *s = &job->spec[i];
+        int err = check_spec(s);
+        if (err == AFC_OK && s->atten_dB > 0 && !(prototype_freq(s, s->offset) > 1))
+            err = AFC_ERR_FREQ;
+        if (err != AFC_OK || s->family != AFC_BESSEL) {
+            job->order_out[i] = err != AFC_OK ? err : closed_form_order(s);
+            continue;
+        }
+        lane[nlane] = s;
+        at[nlane++] = i;
+        if (nlane == LANES) {
+            bessel_orders(lane, nlane, res);
+            for (int l = 0; l < nlane; l++)
+                job->order_out[at[l]] = res[l];
+            nlane = 0;
+        }
+    }
+    if (nlane) {
+        bessel_orders(lane, nlane, res);
+        for (int l = 0; l < nlane; l++)
+            job->order_out[at[l]] = res[l];
+    }
+}
+
+static void rejection_chunk(void *ctx, long begin, long end, int tid) {
+    batch_job *job = ctx;
+    (void)tid;
+    for (long i = begin; i < end; i++)
+        if (afc_rejection(&job->spec[i], job->order[i], &job->atten_out[i]) != AFC_OK)
+            job->atten_out[i] = NAN;
+}
+
+void afc_min_order_batch(const afc_order_spec *spec, long count, int *order, int threads) {
+    batch_job job = { .spec = spec, .order_out = order };
+    afc_parallel_for(count, BATCH_CHUNK, afc_thread_count(threads), order_chunk, &job);
+}
+
+void afc_rejection_batch(const afc_order_spec *spec, const int *order, long count,
+                         double *atten_dB, int threads) {
+    batch_job job = { .spec = spec, .order = order, .atten_out = atten_dB };
+    afc_parallel_for(count, BATCH_CHUNK, afc_thread_count(threads), rejection_chunk, &job);
+}
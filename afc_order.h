@@ -0,0 +1,60 @@
+/*
+ * Analog Filter Calculator - order selection
+ * Smallest order of any family that meets a loss requirement at an offset
+ * frequency, and the inverse: the loss a given order reaches there.
+ *
+ *   Butterworth  A = 10 log10(1 + W^2n)
+ *   Chebyshev    A = 10 log10(1 + eps^2 cosh^2(n acosh W)), solved for n
+ *                with the arccosh formula
+ *   Elliptic     A = 10 log10(1 + eps^2 R_n^2(W)) for a design whose
+ *                stop-band loss is the mask's; the order from the degree
+ *                equation in nome form (afc_elliptic.c)
+ *   Bessel       no closed form: |B_n(jw) / B_n(0)| and the group delay
+ *                are evaluated order by order from the three-term recurrence
+ *                of the reverse Bessel polynomial
+ *
+ * W is the offset mapped onto the low-pass prototype: f/F (LP), F/f (HP),
+ * |f^2 - F^2| / (f BW) (BP) and its inverse (BR), scaled to the cutoff
+ * normalization the design will use (spec norm). Bessel masks may also
+ * bound the group-delay error of the prototype at a second frequency.
+ *
+ * The batch entry points take whole arrays of masks and split them across
+ * threads; Bessel masks are solved four at a time in vector lanes.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_ORDER_H
+#define AFC_ORDER_H
+
+#include "afc.h"
+
+typedef struct {
+    afc_family family;
+    afc_type type;
+    double ripple_dB;      // Chebyshev / elliptic pass-band ripple
+    double freq;           // cutoff (LP/HP) or center (BP/BR) frequency in Hz
+    double bw;             // bandwidth in Hz (BP/BR only)
+    afc_norm norm;         // cutoff normalization of the design
+    double atten_dB;       // required loss (0: none) ...
+    double offset;         // ... at this frequency in Hz
+    double delay_freq;     // Bessel: frequency in Hz where the group delay
+    double delay_tol;      //   may be at most this fraction below DC (0: none)
+} afc_order_spec;
+
+// Smallest order meeting the mask, or an error (AFC_ERR_ORDER if even
+// AFC_MAX_ORDER does not).
+int afc_min_order(const afc_order_spec *spec);
+
+// Loss in dB at spec->offset for the given order.
+int afc_rejection(const afc_order_spec *spec, int order, double *atten_dB);
+
+// Array versions over count masks on up to threads workers (0 = all cores).
+// order[i] receives the order or the error code; atten_dB[i] is NAN if
+// the mask or the order is invalid.
+void afc_min_order_batch(const afc_order_spec *spec, long count, int *order, int threads);
+void afc_rejection_batch(const afc_order_spec *spec, const int *order, long count,
+                         double *atten_dB, int threads);
+
+#endif
@@ -0,0 +1,185 @@
+/*
+ * Analog Filter Calculator - parallel loop helper
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "afc_parallel.h"
+
+typedef struct {
+    long count, chunk;
+    afc_range_fn fn;
+    void *ctx;
+    atomic_long next;
+} loop_job;
+
+typedef struct {
+    loop_job *job;
+    int tid;
+} loop_worker;
+
+static void *run_worker(void *arg) {
+    loop_worker *w = arg;
+    loop_job *job = w->job;
+    for (;;) {
+        long begin = atomic_fetch_add(&job->next, job->chunk);
+        if (begin >= job->count)
+            break;
+        long end = begin + job->chunk < job->count ? begin + job->chunk : job->count;
+        job->fn(job->ctx, begin, end, w->tid);
+    }
+    return NULL;
+}
+
+int afc_cpu_count(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+int afc_thread_count(int requested) {
+    if (requested <= 0)
+        requested = afc_cpu_count();
+    return requested > AFC_MAX_THREADS ? AFC_MAX_THREADS : requested;
+}
+
+void afc_parallel_for(long count, long chunk, int threads, afc_range_fn fn, void *ctx) {
+    pthread_t tid[AFC_MAX_THREADS];
+    loop_worker workers[AFC_MAX_THREADS];
+    loop_job job = { .count = count, .chunk = chunk > 0 ? chunk : 1, .fn = fn, .ctx = ctx };
+    long nchunks = (count + job.chunk - 1) / job.chunk;
+    int spawned = 0;
+
+    atomic_init(&job.next, 0);
+    threads = afc_thread_count(threads);
+    if (threads > nchunks)
+        threads = nchunks > 0 ? (int)nchunks : 1;
+
+    for (int t = 0; t < threads; t++) {
+        workers[t].job = &job;
+        workers[t].tid = t;
+    }
+    for (int t = 1; t < threads; t++)
+        if (pthread_create(&tid[spawned], NULL, run_worker, &workers[t]) == 0)
+            spawned++;
+    run_worker(&workers[0]);
+    for (int t = 0; t < spawned; t++)
+        pthread_join(tid[t], NULL);
+}
+
+/*
+ * Work stealing: each worker owns a contiguous range of chunk indices packed
+ * as (next << 32 | end) in one atomic word. The owner takes chunks from the
+ * front; an idle worker steals the back half of the largest remaining range.
+ * Both sides update the word with a CAS, so no locks are needed.
+ */
+typedef struct {
+    _Alignas(64) atomic_uint_least64_t range;
+} steal_deque;
+
+typedef struct {
+    long count, chunk;
+    int threads;
+    afc_range_fn fn;
+    void *ctx;
+    steal_deque *deques;
+} steal_job;
+
+typedef struct {
+    steal_job *job;
+    int tid;
+} steal_worker;
+
+#define RANGE(next, end)  (((uint64_t)(next) << 32) | (uint32_t)(end))
+#define RANGE_NEXT(r)     ((long)((r) >> 32))
+#define RANGE_END(r)      ((long)((r) & 0xffffffffu))
+
+// Take the next chunk of deque d; returns -1 if it is empty.
+static long take_front(steal_deque *d) {
+    uint64_t r = atomic_load(&d->range);
+    while (RANGE_NEXT(r) < RANGE_END(r))
+        if (atomic_compare_exchange_weak(&d->range, &r, RANGE(RANGE_NEXT(r) + 1, RANGE_END(r))))
+            return RANGE_NEXT(r);
+    return -1;
+}
+
+// Move the back half of the fullest other deque into deque self.
+static int steal_half(steal_job *job, int self) {
+    for (;;) {
+        int victim = -1;
+        long most = 0;
+        for (int t = 0; t < job->threads; t++) {
+            uint64_t r = atomic_load(&job->deques[t].range);
+            if (t != self && RANGE_END(r) - RANGE_NEXT(r) > most) {
+                most = RANGE_END(r) - RANGE_NEXT(r);
+                victim = t;
+            }
+        }
+        if (victim < 0)
+            return 0;
+
+        steal_deque *d = &job->deques[victim];
+        uint64_t r = atomic_load(&d->range);
+        long next = RANGE_NEXT(r), end = RANGE_END(r);
+        if (next >= end)
+            continue;
+        long mid = next + (end - next) / 2;   // a single chunk goes to the thief
+        if (atomic_compare_exchange_strong(&d->range, &r, RANGE(next, mid))) {
+            // only this worker writes its own deque once it is empty
+            atomic_store(&job->deques[self].range, RANGE(mid, end));
+            return 1;
+        }
+    }
+}
+
+static void *run_steal_worker(void *arg) {
+    steal_worker *w = arg;
+    steal_job *job = w->job;
+    do {
+        long c;
+        while ((c = take_front(&job->deques[w->tid])) >= 0) {
+            long begin = c * job->chunk;
+            long end = begin + job->chunk < job->count ? begin + job->chunk : job->count;
+            job->fn(job->ctx, begin, end, w->tid);
+        }
+    } while (steal_half(job, w->tid));
+    return NULL;
+}
+
+void afc_parallel_steal(long count, long chunk, int threads, afc_range_fn fn, void *ctx) {
+    pthread_t tid[AFC_MAX_THREADS];
+    steal_worker workers[AFC_MAX_THREADS];
+    steal_deque deques[AFC_MAX_THREADS];
+    steal_job job = { .count = count, .fn = fn, .ctx = ctx, .deques = deques };
+    long nchunks;
+    int spawned = 0;
+
+    // keep chunk indices within the 32-bit halves of a deque word
+    job.chunk = chunk > 0 ? chunk : 1;
+    while ((count + job.chunk - 1) / job.chunk > 0x7fffffffL)
+        job.chunk *= 2;
+    nchunks = (count + job.chunk - 1) / job.chunk;
+
+    threads = afc_thread_count(threads);
+    if (threads > nchunks)
+        threads = nchunks > 0 ? (int)nchunks : 1;
+    job.threads = threads;
+
+    for (int t = 0; t < threads; t++) {
+        atomic_init(&deques[t].range, RANGE(nchunks * t / threads, nchunks * (t + 1) / threads));
+        workers[t].job = &job;
+        workers[t].tid = t;
+    }
+    for (int t = 1; t < threads; t++)
+        if (pthread_create(&tid[spawned], NULL, run_steal_worker, &workers[t]) == 0)
+            spawned++;
+    // a worker that failed to start has its range stolen by the others
+    run_steal_worker(&workers[0]);
+    for (int t = 0; t < spawned; t++)
+        pthread_join(tid[t], NULL);
+}
@@ -0,0 +1,33 @@
+/*
+ * Analog Filter Calculator - parallel loop helper
+ * Runs fn over [0, count) in chunks on a pool of pthreads. Chunks are
+ * claimed dynamically so uneven work still balances across cores.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_PARALLEL_H
+#define AFC_PARALLEL_H
+
+#define AFC_MAX_THREADS 256
+
+// Work callback: process items [begin, end) on worker thread tid.
+typedef void (*afc_range_fn)(void *ctx, long begin, long end, int tid);
+
+// Number of online CPUs (at least 1).
+int afc_cpu_count(void);
+
+// Clamp a requested thread count; 0 or less means "all cores".
+int afc_thread_count(int requested);
+
+// Run fn over [0, count) with the given chunk size on up to threads workers.
+// The calling thread takes part as worker 0. Returns when all work is done.
+void afc_parallel_for(long count, long chunk, int threads, afc_range_fn fn, void *ctx);
+
+// Same contract, but each worker starts with an equal share of the chunks
+// and idle workers steal half of the largest remaining share. Suits long
+// runs of uneven work where a shared counter would be contended.
+void afc_parallel_steal(long count, long chunk, int threads, afc_range_fn fn, void *ctx);
+
+#endif
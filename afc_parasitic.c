@@ -0,0 +1,494 @@
+/*
+ * Analog Filter Calculator - parasitic component models
+ * The part table holds per part four planes over the sweep (Zv and dZv/dw,
+ * real and imaginary), padded to whole blocks. The response runs per block
+ * of PART_BLOCK frequencies with the chain matrix and its w derivative in
+ * separate real and imaginary arrays, so every step is a fixed-length loop
+ * of real multiply-adds the compiler vectorizes.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "afc_parasitic.h"
+#include "afc_parallel.h"
+#include "afc_spec.h"
+#include "afc_stats.h"
+#include "afc_touchstone.h"
+
+#define PART_BLOCK      64     // frequencies per block
+#define PART_CHUNK      1024   // frequencies claimed by a worker at a time
+#define PART_PLANES     4      // Zv re, im, dZv/dw re, im
+#define DATA_MAX_POINTS (1L << 24)
+
+typedef double complex cplx;
+
+/* ---------------------------------------------------------------------- */
+/* Measured parts                                                         */
+/* ---------------------------------------------------------------------- */
+
+void afc_part_data_free(afc_part_data *d) {
+    free(d->freq);
+    free(d->re);
+    free(d->im);
+    memset(d, 0, sizeof *d);
+}
+
+int afc_part_data_load(const char *path, int shunt, afc_part_data *d) {
+    afc_touchstone ts;
+    int err;
+
+    memset(d, 0, sizeof *d);
+    if ((err = afc_touchstone_load(path, &ts)) != AFC_OK)
+        return err;
+    if (ts.ports > 2 || ts.count < 2 || ts.count > DATA_MAX_POINTS) {
+        afc_touchstone_free(&ts);
+        return AFC_ERR_FORMAT;
+    }
+    d->count = ts.count;
+    d->freq = malloc(d->count * sizeof *d->freq);
+    d->re = malloc(d->count * sizeof *d->re);
+    d->im = malloc(d->count * sizeof *d->im);
+    err = d->freq && d->re && d->im ? AFC_OK : AFC_ERR_MEMORY;
+    for (long k = 0; err == AFC_OK && k < d->count; k++) {
+        // S11 of a one-port, S21 of a two-port
+        size_t at = (size_t)k * ts.ports * ts.ports + (ts.ports == 2 ? 2 : 0);
+        cplx s = ts.re[at] + I * ts.im[at], z;
+        double Z0 = ts.R[0];
+        if (ts.ports == 1)
+            z = Z0 * (1 + s) / (1 - s);
+        else if (shunt)
+            z = Z0 * s / (2 * (1 - s));
+        else
+            z = 2 * Z0 * (1 - s) / s;
+        if (!isfinite(creal(z)) || !isfinite(cimag(z)))
+            err = AFC_ERR_FORMAT;
+        d->freq[k] = ts.freq[k];
+        d->re[k] = creal(z);
+        d->im[k] = cimag(z);
+    }
+    afc_touchstone_free(&ts);
+    if (err != AFC_OK)
+        afc_part_data_free(d);
+    return err;
+}
+
+// Impedance and d/dw at f by linear interpolation; AFC_ERR_FREQ outside
+// the measured range.
+static int data_at(const afc_part_data *d, double f, cplx *z, cplx *dz) {
+    if (!(f >= d->freq[0] && f <= d->freq[d->count - 1]))
+        return AFC_ERR_FREQ;
+    long lo = 0, hi = d->count - 1;
+    while (hi - lo > 1) {
+        long mid = (lo + hi) / 2;
+        if (d->freq[mid] <= f)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    cplx z0 = d->re[lo] + I * d->im[lo], z1 = d->re[hi] + I * d->im[hi];
+    double span = d->freq[hi] - d->freq[lo];
+    *z = z0 + (z1 - z0) * ((f - d->freq[lo]) / span);
+    *dz = (z1 - z0) / (2 * AFC_M_PI * span);
+    return AFC_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Options                                                                */
+/* ---------------------------------------------------------------------- */
+
+static int parse_value(const char *s, double *out) {
+    return afc_parse_number(s, NAN, out) && *out >= 0;
+}
+
+// "q" or "q@Hz"
+static int parse_q(const char *s, afc_part_model *m) {
+    char buf[64], *at;
+    snprintf(buf, sizeof buf, "%s", s);
+    m->Q_freq = 0;
+    if ((at = strchr(buf, '@'))) {
+        *at = '\0';
+        if (!parse_value(at + 1, &m->Q_freq) || !(m->Q_freq > 0))
+            return 0;
+    }
+    return parse_value(buf, &m->Q) && m->Q > 0;
+}
+
+// "L3=file" or "C2=file"
+static int load_part(const char *s, int shunt, afc_parasitics *p) {
+    char *end;
+    int kind = toupper((unsigned char)s[0]);
+    long e = strtol(s + 1, &end, 10);
+    if ((kind != 'L' && kind != 'C') || *end != '=' || e < 1 || e > AFC_MAX_ORDER)
+        return AFC_ERR_ARGUMENT;
+    afc_part_data **slot = kind == 'L' ? &p->data_L[e - 1] : &p->data_C[e - 1];
+    afc_part_data *d = malloc(sizeof *d);
+    if (!d)
+        return AFC_ERR_MEMORY;
+    int err = afc_part_data_load(end + 1, shunt, d);
+    if (err != AFC_OK) {
+        free(d);
+        return err;
+    }
+    if (*slot) {
+        afc_part_data_free(*slot);
+        free(*slot);
+    }
+    *slot = d;
+    return 1;
+}
+
+int afc_parasitic_option(const char *opt, const char *val, afc_parasitics *p) {
+    int ok;
+    if (!strcmp(opt, "-Q"))
+        ok = parse_q(val, &p->L);
+    else if (!strcmp(opt, "-Qc"))
+        ok = parse_q(val, &p->C);
+    else if (!strcmp(opt, "-srf"))
+        ok = parse_value(val, &p->L.SRF);
+    else if (!strcmp(opt, "-srfc"))
+        ok = parse_value(val, &p->C.SRF);
+    else if (!strcmp(opt, "-esr"))
+        ok = parse_value(val, &p->C.ESR);
+    else if (!strcmp(opt, "-esl"))
+        ok = parse_value(val, &p->C.ESL);
+    else if (!strcmp(opt, "-esrl"))
+        ok = parse_value(val, &p->L.ESR);
+    else if (!strcmp(opt, "-part") || !strcmp(opt, "-spart"))
+        return load_part(val, opt[1] == 's', p);
+    else
+        return 0;
+    return ok ? 1 : AFC_ERR_ARGUMENT;
+}
+
+static int model_active(const afc_part_model *m) {
+    return m->Q > 0 || m->SRF > 0 || m->ESR > 0 || m->ESL > 0;
+}
+
+int afc_parasitics_active(const afc_parasitics *p) {
+    if (model_active(&p->L) || model_active(&p->C))
+        return 1;
+    for (int e = 0; e < AFC_MAX_ORDER; e++)
+        if (p->data_L[e] || p->data_C[e])
+            return 1;
+    return 0;
+}
+
+void afc_parasitics_free(afc_parasitics *p) {
+    for (int e = 0; e < AFC_MAX_ORDER; e++) {
+        afc_part_data *d[2] = { p->data_L[e], p->data_C[e] };
+        for (int i = 0; i < 2; i++)
+            if (d[i]) {
+                afc_part_data_free(d[i]);
+                free(d[i]);
+            }
+        p->data_L[e] = p->data_C[e] = NULL;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* Part table                                                             */
+/* ---------------------------------------------------------------------- */
+
+static double *part_plane(const afc_part_table *t, int part, int plane) {
+    return t->z + ((size_t)part * PART_PLANES + plane) * t->padded;
+}
+
+static int model_check(const afc_part_model *m) {
+    return m->Q >= 0 && m->Q_freq >= 0 && m->SRF >= 0 && m->ESR >= 0 && m->ESL >= 0;
+}
+
+// Zv of the modelled part (value L or C, inductor or not) and its w
+// derivative: the ideal reactance jX plus the loss |X|/Q.
+static void model_at(const afc_part_model *m, int inductor, double value, double w,
+                     cplx *z, cplx *dz) {
+    double X = inductor ? w * value : -1 / (w * value);
+    double dX = inductor ? value : 1 / (w * w * value);
+    double R = 0, dR = 0;
+    if (m->Q > 0 && m->Q_freq > 0) {
+        double wq = 2 * AFC_M_PI * m->Q_freq;
+        double Xq = inductor ? wq * value : 1 / (wq * value);
+        R = Xq / m->Q * sqrt(w / wq);
+        dR = R / (2 * w);
+    } else if (m->Q > 0) {
+        R = fabs(X) / m->Q;
+        dR = inductor ? value / m->Q : -R / w;
+    }
+    *z = R + I * X;
+    *dz = dR + I * dX;
+}
+
+int afc_part_table_init(afc_part_table *t, const afc_element *el, int n,
+                        const afc_parasitics *p, const double *freq, long count) {
+    memset(t, 0, sizeof *t);
+    if (n < 1 || n > AFC_MAX_ORDER || count < 1)
+        return AFC_ERR_ARGUMENT;
+    if (!model_check(&p->L) || !model_check(&p->C))
+        return AFC_ERR_ARGUMENT;
+    for (long i = 0; i < count; i++)
+        if (!(freq[i] > 0))
+            return AFC_ERR_FREQ;
+
+    t->n = n;
+    t->count = count;
+    t->padded = (count + PART_BLOCK - 1) / PART_BLOCK * PART_BLOCK;
+    memcpy(t->el, el, n * sizeof *el);
+    t->w = malloc(t->padded * sizeof *t->w);
+    t->z = malloc((size_t)2 * n * PART_PLANES * t->padded * sizeof *t->z);
+    if (!t->w || !t->z) {
+        afc_part_table_free(t);
+        return AFC_ERR_MEMORY;
+    }
+    // the padding repeats the last frequency and is never written out
+    for (long i = 0; i < t->padded; i++)
+        t->w[i] = 2 * AFC_M_PI * freq[i < count ? i : count - 1];
+
+    for (int part = 0; part < 2 * n; part++) {
+        int inductor = part & 1, e = part / 2;
+        double value = inductor ? el[e].L : el[e].C;
+        const afc_part_data *data = inductor ? p->data_L[e] : p->data_C[e];
+        const afc_part_model *m = inductor ? &p->L : &p->C;
+        double *zr = part_plane(t, part, 0), *zi = part_plane(t, part, 1);
+        double *dzr = part_plane(t, part, 2), *dzi = part_plane(t, part, 3);
+
+        if (!(value > 0)) {
+            // not fitted: never read, but keep the planes defined
+            memset(zr, 0, PART_PLANES * t->padded * sizeof *zr);
+            continue;
+        }
+        if (!data) {
+            t->esr[part] = m->ESR;
+            t->esl[part] = m->ESL;
+            if (m->SRF > 0) {
+                double ws = 2 * AFC_M_PI * m->SRF;
+                if (inductor)
+                    t->cp[part] = 1 / (ws * ws * value);
+                else if (!(m->ESL > 0))
+                    t->esl[part] = 1 / (ws * ws * value);
+            }
+        }
+        for (long i = 0; i < t->padded; i++) {
+            cplx z, dz;
+            if (data) {
+                int err = data_at(data, t->w[i] / (2 * AFC_M_PI), &z, &dz);
+                if (err != AFC_OK) {
+                    afc_part_table_free(t);
+                    return err;
+                }
+            } else {
+                model_at(m, inductor, value, t->w[i], &z, &dz);
+            }
+            zr[i] = creal(z);
+            zi[i] = cimag(z);
+            dzr[i] = creal(dz);
+            dzi[i] = cimag(dz);
+        }
+    }
+    return AFC_OK;
+}
+
+void afc_part_table_free(afc_part_table *t) {
+    free(t->w);
+    free(t->z);
+    t->w = t->z = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Response                                                               */
+/* ---------------------------------------------------------------------- */
+
+// One complex block quantity and its w derivative.
+typedef struct {
+    double re[PART_BLOCK], im[PART_BLOCK];
+    double dre[PART_BLOCK], dim[PART_BLOCK];
+} block_val;
+
+typedef struct {
+    const afc_part_table *t;
+    double Rs, RL;
+    const double *kC, *kL;
+    const afc_response *out;
+} part_job;
+
+// x = 1 / x, dx = -dx / x^2. The loops stay branch-free (and restrict
+// keeps the compiler from guarding them against aliasing) so they vectorize.
+static void block_invert(block_val *restrict x, int delay) {
+    for (int i = 0; i < PART_BLOCK; i++) {
+        double m = 1 / (x->re[i] * x->re[i] + x->im[i] * x->im[i]);
+        x->re[i] *= m;
+        x->im[i] *= -m;
+    }
+    if (!delay)
+        return;
+    for (int i = 0; i < PART_BLOCK; i++) {
+        double yr = x->re[i], yi = x->im[i];
+        double y2r = yr * yr - yi * yi, y2i = 2 * yr * yi;
+        double dr = x->dre[i], di = x->dim[i];
+        x->dre[i] = -(dr * y2r - di * y2i);
+        x->dim[i] = -(dr * y2i + di * y2r);
+    }
+}
+
+static void block_add(block_val *restrict x, const block_val *restrict y) {
+    for (int i = 0; i < PART_BLOCK; i++) {
+        x->re[i] += y->re[i];
+        x->im[i] += y->im[i];
+        x->dre[i] += y->dre[i];
+        x->dim[i] += y->dim[i];
+    }
+}
+
+// Impedance of one part over the block starting at b.
+static void part_block(const part_job *job, int part, long b, block_val *restrict z) {
+    const afc_part_table *t = job->t;
+    const double *restrict zr = part_plane(t, part, 0) + b, *restrict zi = part_plane(t, part, 1) + b;
+    const double *restrict dzr = part_plane(t, part, 2) + b, *restrict dzi = part_plane(t, part, 3) + b;
+    const double *restrict w = t->w + b;
+    const double *scale = part & 1 ? job->kL : job->kC;
+    double k = scale ? scale[part / 2] : 1;
+    double esr = t->esr[part], esl = t->esl[part], cp = t->cp[part];
+
+    if (!(part & 1))
+        k = 1 / k;   // a larger capacitor has the smaller impedance
+    for (int i = 0; i < PART_BLOCK; i++) {
+        z->re[i] = esr + k * zr[i];
+        z->im[i] = w[i] * esl + k * zi[i];
+        z->dre[i] = k * dzr[i];
+        z->dim[i] = esl + k * dzi[i];
+    }
+    if (cp > 0) {
+        block_invert(z, 1);
+        for (int i = 0; i < PART_BLOCK; i++) {
+            z->im[i] += w[i] * cp;
+            z->dim[i] += cp;
+        }
+        block_invert(z, 1);
+    }
+}
+
+// d += s x, with the product rule for the derivatives. Kept out of line so
+// the restrict qualifiers survive and the loops vectorize.
+static __attribute__((noinline)) void block_step(const block_val *restrict s, block_val *restrict d,
+                       const block_val *restrict x, int delay) {
+    if (delay)
+        for (int i = 0; i < PART_BLOCK; i++) {
+            d->dre[i] += s->dre[i] * x->re[i] - s->dim[i] * x->im[i]
+                       + s->re[i] * x->dre[i] - s->im[i] * x->dim[i];
+            d->dim[i] += s->dre[i] * x->im[i] + s->dim[i] * x->re[i]
+                       + s->re[i] * x->dim[i] + s->im[i] * x->dre[i];
+        }
+    for (int i = 0; i < PART_BLOCK; i++) {
+        d->re[i] += s->re[i] * x->re[i] - s->im[i] * x->im[i];
+        d->im[i] += s->re[i] * x->im[i] + s->im[i] * x->re[i];
+    }
+}
+
+static void part_chunk(void *ctx, long begin, long end, int tid) {
+    const part_job *job = ctx;
+    const afc_part_table *t = job->t;
+    const afc_response *out = job->out;
+    int delay = out->gd != NULL;
+    // chain matrix A, B, C, D with their w derivatives
+    block_val m[4], arm, other;
+    (void)tid;
+
+    for (long b = begin; b < end; b += PART_BLOCK) {
+        for (int k = 0; k < 4; k++) {
+            memset(&m[k], 0, sizeof m[k]);
+            if (k == 0 || k == 3)
+                for (int i = 0; i < PART_BLOCK; i++)
+                    m[k].re[i] = 1;
+        }
+
+        for (int e = 0; e < t->n; e++) {
+            const afc_element *el = &t->el[e];
+            int series = el->branch == AFC_SERIES, admittance;
+            switch (el->form) {
+            case AFC_FORM_C:
+                part_block(job, 2 * e, b, &arm);
+                admittance = 0;
+                break;
+            case AFC_FORM_L:
+                part_block(job, 2 * e + 1, b, &arm);
+                admittance = 0;
+                break;
+            case AFC_FORM_SERIES_LC:
+                part_block(job, 2 * e, b, &arm);
+                part_block(job, 2 * e + 1, b, &other);
+                block_add(&arm, &other);
+                admittance = 0;
+                break;
+            default:
+                part_block(job, 2 * e, b, &arm);
+                part_block(job, 2 * e + 1, b, &other);
+                block_invert(&arm, delay);
+                block_invert(&other, delay);
+                block_add(&arm, &other);
+                admittance = 1;
+                break;
+            }
+            // a series arm needs Z, a shunt arm Y
+            if (admittance == series)
+                block_invert(&arm, delay);
+
+            // series: B += A Z, D += C Z; shunt: A += B Y, C += D Y
+            for (int r = 0; r < 2; r++) {
+                int from = series ? 2 * r : 2 * r + 1, to = series ? 2 * r + 1 : 2 * r;
+                block_step(&m[from], &m[to], &arm, delay);
+            }
+        }
+
+        // E = A + B/RL + C Rs + D Rs/RL, S21 = 2 sqrt(Rs/RL) / E
+        double gRL = 1 / job->RL, Rs = job->Rs, RsRL = job->Rs / job->RL;
+        double k21 = 2 * sqrt(job->Rs / job->RL);
+        long stop = end < t->count ? end : t->count;
+        for (int i = 0; i < PART_BLOCK && b + i < stop; i++) {
+            // real arithmetic, complex division would go through a libgcc call
+            double Er = m[0].re[i] + m[1].re[i] * gRL + m[2].re[i] * Rs + m[3].re[i] * RsRL;
+            double Ei = m[0].im[i] + m[1].im[i] * gRL + m[2].im[i] * Rs + m[3].im[i] * RsRL;
+            double Fr = m[0].re[i] + m[1].re[i] * gRL - m[2].re[i] * Rs - m[3].re[i] * RsRL;
+            double Fi = m[0].im[i] + m[1].im[i] * gRL - m[2].im[i] * Rs - m[3].im[i] * RsRL;
+            double inv = 1 / (Er * Er + Ei * Ei);
+            double s21r = k21 * Er * inv, s21i = -k21 * Ei * inv;
+            double s11r = (Fr * Er + Fi * Ei) * inv, s11i = (Fi * Er - Fr * Ei) * inv;
+            long f = b + i;
+            if (out->s21_re) out->s21_re[f] = s21r;
+            if (out->s21_im) out->s21_im[f] = s21i;
+            if (out->s11_re) out->s11_re[f] = s11r;
+            if (out->s11_im) out->s11_im[f] = s11i;
+            if (out->il_dB)  out->il_dB[f] = -10 * log10(s21r * s21r + s21i * s21i);
+            if (out->rl_dB)  out->rl_dB[f] = -10 * log10(s11r * s11r + s11i * s11i);
+            if (delay) {
+                // group delay Im(E' / E)
+                double dr = m[0].dre[i] + m[1].dre[i] * gRL + m[2].dre[i] * Rs + m[3].dre[i] * RsRL;
+                double di = m[0].dim[i] + m[1].dim[i] * gRL + m[2].dim[i] * Rs + m[3].dim[i] * RsRL;
+                out->gd[f] = (di * Er - dr * Ei) * inv;
+            }
+        }
+    }
+}
+
+int afc_part_table_response(const afc_part_table *t, double Rs, double RL,
+                            const double *kC, const double *kL,
+                            const afc_response *out, int threads) {
+    if (!t->z)
+        return AFC_ERR_ARGUMENT;
+    if (!(Rs > 0) || !(RL > 0))
+        return AFC_ERR_IMPEDANCE;
+    for (int e = 0; e < t->n; e++)
+        if ((kC && !(kC[e] > 0)) || (kL && !(kL[e] > 0)))
+            return AFC_ERR_ARGUMENT;
+
+    part_job job = { t, Rs, RL, kC, kL, out };
+    long t0 = afc_stats_begin();
+    afc_parallel_for(t->padded, PART_CHUNK, afc_thread_count(threads), part_chunk, &job);
+    afc_stats_end(AFC_STAGE_RESPONSE, t0);
+    return AFC_OK;
+}
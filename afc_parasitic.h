@@ -0,0 +1,99 @@
+/*
+ * Analog Filter Calculator - parasitic component models
+ * Real inductors and capacitors instead of ideal ones: finite Q, inductor
+ * self-resonance, capacitor ESR and ESL, or a measured impedance per part
+ * taken from a vendor Touchstone file.
+ *
+ * Every model is evaluated once per sweep into an afc_part_table: per part
+ * the frequency-dependent impedance and its w derivative, one contiguous
+ * array per plane. The response then only cascades complex ABCD matrices
+ * from those arrays, and a tolerance sample (Monte Carlo) reuses the same
+ * table with a scale factor per part.
+ *
+ * A part is Z(w) = ESR + j w ESL + k Zv(w), in parallel with Cp when the
+ * part has one, where Zv is the ideal reactance plus the Q loss (or the
+ * measured impedance) and k the tolerance factor: the value ratio for an
+ * inductor, its inverse for a capacitor.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_PARASITIC_H
+#define AFC_PARASITIC_H
+
+#include "afc.h"
+#include "afc_response.h"
+
+typedef struct {
+    double Q;              // quality factor, 0 = lossless
+    double Q_freq;         // Hz the Q is given at, the loss then grows as
+                           // sqrt(f) (skin effect); 0 keeps Q constant
+    double SRF;            // self-resonance in Hz, 0 = none: the winding
+                           // capacitance of an inductor, the ESL of a
+                           // capacitor that has none given
+    double ESR;            // series resistance in ohm
+    double ESL;            // series inductance in H
+} afc_part_model;
+
+// Measured impedance of one part, frequencies ascending.
+typedef struct {
+    long count;
+    double *freq;          // Hz
+    double *re, *im;       // ohm
+} afc_part_data;
+
+typedef struct {
+    afc_part_model L, C;                     // every inductor / capacitor
+    afc_part_data *data_L[AFC_MAX_ORDER];    // measured part of element e,
+    afc_part_data *data_C[AFC_MAX_ORDER];    // NULL = use the model
+} afc_parasitics;
+
+// Load a part's impedance from a Touchstone file: S11 of a .s1p, else
+// S21 of a .s2p measured in a series-through (shunt = 0) or shunt-through
+// fixture. Free it with afc_part_data_free().
+int afc_part_data_load(const char *path, int shunt, afc_part_data *d);
+void afc_part_data_free(afc_part_data *d);
+
+// Command-line options shared by the front-ends, value in val:
+//   -Q q[@Hz], -Qc q[@Hz]    inductor / capacitor Q (at Hz: skin effect)
+//   -srf Hz, -srfc Hz        inductor / capacitor self-resonance
+//   -esr ohm, -esl H         capacitor ESR and ESL
+//   -esrl ohm                inductor DC resistance
+//   -part L3=file            measured part of element 3 (series-through)
+//   -spart C2=file           the same from a shunt-through fixture
+// Returns 1 if the option was taken, 0 if it is not one of these, or an
+// error code.
+int afc_parasitic_option(const char *opt, const char *val, afc_parasitics *p);
+
+// Whether any model or measured part differs from an ideal L or C.
+int afc_parasitics_active(const afc_parasitics *p);
+
+// Free the measured parts loaded by afc_parasitic_option().
+void afc_parasitics_free(afc_parasitics *p);
+
+typedef struct {
+    int n;
+    long count, padded;    // frequencies, rounded up to whole blocks
+    afc_element el[AFC_MAX_ORDER];
+    double esr[2 * AFC_MAX_ORDER], esl[2 * AFC_MAX_ORDER], cp[2 * AFC_MAX_ORDER];
+    double *w;             // angular frequencies
+    double *z;             // per part (2e capacitor, 2e+1 inductor of
+                           // element e) Zv re, im and their w derivatives
+} afc_part_table;
+
+// Evaluate the parts of the ladder el at the count frequencies freq.
+// Free the table with afc_part_table_free().
+int afc_part_table_init(afc_part_table *t, const afc_element *el, int n,
+                        const afc_parasitics *p, const double *freq, long count);
+
+// Response of the ladder between Rs and RL, as afc_ladder_response(), with
+// the capacitors scaled by kC[e] and the inductors by kL[e] (NULL: 1).
+// The sweep is split across threads (0 = all cores).
+int afc_part_table_response(const afc_part_table *t, double Rs, double RL,
+                            const double *kC, const double *kL,
+                            const afc_response *out, int threads);
+
+void afc_part_table_free(afc_part_table *t);
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ * Analog Filter Calculator - closed-form prototypes
+ * Butterworth and Chebyshev ladder g-values from their textbook formulas.
+ *
+ * The common orders and ripples are precomputed into afc_tables.h by
+ * gen_afc_tables.c, which calls these same routines, so a table entry is
+ * bit for bit what the formula gives; afc.c only evaluates them at run time
+ * outside the tables.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+
+#include "afc.h"
+
+#define PI AFC_M_PI
+
+// g(k) = 2 sin((2k-1) pi / 2n), g(n+1) = 1
+void afc_butterworth_synthesize(int n, double *g) {
+    for (int i = 1; i <= n; i++)
+        g[i-1] = 2 * sin((((2 * i) - 1) * PI) / (2 * n));
+    g[n] = 1.0;
+}
+
+/*
+ * Chebyshev prototype from the closed-form recurrence (Matthaei, Young, Jones):
+ *   beta = ln(coth(Ar / 17.37)),  gamma = sinh(beta / 2n)
+ *   a(k) = sin((2k-1)pi / 2n),    b(k) = gamma^2 + sin^2(k pi / n)
+ *   g1 = 2 a1 / gamma,            g(k) = 4 a(k-1) a(k) / (b(k-1) g(k-1))
+ *   g(n+1) = 1 (n odd) or coth^2(beta / 4) (n even)
+ * The values are normalized to the ripple band edge; *f3dB receives the
+ * -3 dB frequency relative to that edge, cosh(acosh(1/eps) / n).
+ */
+void afc_chebyshev_synthesize(int n, double ripple_dB, double *g, double *f3dB) {
+    double beta = log(1.0 / tanh(ripple_dB / 17.37));
+    double gamma = sinh(beta / (2 * n));
+    double eps = sqrt(pow(10, ripple_dB / 10) - 1);
+    double a_prev = sin(PI / (2 * n));
+    double b_prev = gamma * gamma + sin(PI / n) * sin(PI / n);
+
+    g[0] = 2 * a_prev / gamma;
+    for (int k = 2; k <= n; k++) {
+        double a = sin(((2 * k) - 1) * PI / (2 * n));
+        g[k-1] = 4 * a_prev * a / (b_prev * g[k-2]);
+        a_prev = a;
+        b_prev = gamma * gamma + sin(k * PI / n) * sin(k * PI / n);
+    }
+    if (n % 2 == 1) {
+        g[n] = 1.0;
+    } else {
+        double c = 1.0 / tanh(beta / 4);
+        g[n] = c * c;
+    }
+    *f3dB = cosh(acosh(1.0 / eps) / n);
+}
@@ -0,0 +1,628 @@
+/*
+ * Analog Filter Calculator - ladder frequency response
+ * Every arm of a ladder has a purely imaginary immittance jX(w), so the
+ * chain matrix is built with real multiply-adds on separate real and
+ * imaginary parts, the derivative chain alongside it for the group delay.
+ * The sensitivities need the chain ahead of and behind every arm, so they
+ * run a plain complex forward and backward pass per frequency instead.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "afc_response.h"
+#include "afc_parallel.h"
+#include "afc_stats.h"
+
+#define RESPONSE_BLOCK  128    // frequencies per kernel call, multiple of 8
+#define RESPONSE_CHUNK  8192   // frequencies claimed by a worker at a time
+#define SENS_CHUNK      256    // the same for the sensitivity passes
+#define SENS_POINTS     64     // pass-band points of afc_pass_band_sensitivity()
+#define TREE_CHUNK      256    // frequencies per tree block, task and leaf scratch
+#define TREE_LEAF       8      // arms per tree leaf, multiplied out on demand
+#define TREE_STRIDE     (TREE_CHUNK + 8)   // plane stride, padded off 4 KiB aliasing
+#define DB_PER_NEPER    8.685889638065037   // 20 / ln 10
+
+// One ladder arm: jX with X = w P - Q/w, or X = -1/(w P - Q/w) when the
+// resonator is the dual of the branch (a series LC in shunt, a parallel
+// LC in series).
+typedef struct {
+    double P, Q;
+    int inverted;
+    int series;
+} arm;
+
+typedef struct {
+    double w[RESPONSE_BLOCK];
+    double s21_re[RESPONSE_BLOCK], s21_im[RESPONSE_BLOCK];
+    double s11_re[RESPONSE_BLOCK], s11_im[RESPONSE_BLOCK];
+    double gd[RESPONSE_BLOCK];
+} response_block;
+
+typedef void (*block_kernel)(const arm *arms, int n, double Rs, double RL, response_block *b);
+
+// Planes of an incremental tree node: [[a, jb], [jc, d]] and the w
+// derivatives (see afc_ladder_tree).
+enum { PA, PB, PC, PD, PDA, PDB, PDC, PDD, TREE_PLANES };
+
+typedef void (*combine_fn)(double *o[TREE_PLANES], const double *l[TREE_PLANES],
+                           const double *r[TREE_PLANES], int delay);
+typedef void (*chain_fn)(const arm *arms, int n, const double *w, const double *inv_w,
+                         double *o[TREE_PLANES], int delay);
+
+#define KERNEL_NAME    cascade_scalar
+#define COMBINE_NAME   combine_scalar
+#define CHAIN_NAME     chain_scalar
+#define KERNEL_TARGET
+#define KERNEL_WIDTH   1
+#include "afc_response_kernel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RESPONSE_X86 1
+
+#define KERNEL_NAME    cascade_avx2
+#define COMBINE_NAME   combine_avx2
+#define CHAIN_NAME     chain_avx2
+#define KERNEL_TARGET  __attribute__((target("avx2,fma")))
+#define KERNEL_WIDTH   4
+#include "afc_response_kernel.h"
+
+#define KERNEL_NAME    cascade_avx512
+#define COMBINE_NAME   combine_avx512
+#define CHAIN_NAME     chain_avx512
+#define KERNEL_TARGET  __attribute__((target("avx512f")))
+#define KERNEL_WIDTH   8
+#include "afc_response_kernel.h"
+#endif
+
+static block_kernel pick_kernel(const char **name) {
+#ifdef RESPONSE_X86
+    if (__builtin_cpu_supports("avx512f")) {
+        *name = "avx512";
+        return cascade_avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        *name = "avx2";
+        return cascade_avx2;
+    }
+#endif
+    *name = "scalar";
+    return cascade_scalar;
+}
+
+// Tree functions for the same instruction set
+static combine_fn pick_tree(chain_fn *chain) {
+#ifdef RESPONSE_X86
+    if (__builtin_cpu_supports("avx512f")) {
+        *chain = chain_avx512;
+        return combine_avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        *chain = chain_avx2;
+        return combine_avx2;
+    }
+#endif
+    *chain = chain_scalar;
+    return combine_scalar;
+}
+
+const char *afc_response_isa(void) {
+    const char *name;
+    pick_kernel(&name);
+    return name;
+}
+
+// Map the ladder elements to arms; returns AFC_OK or an error.
+static int make_arms(const afc_element *el, int n, arm *arms) {
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+
+    for (int i = 0; i < n; i++) {
+        const afc_element *e = &el[i];
+        arm *a = &arms[i];
+        int needC = e->form != AFC_FORM_L, needL = e->form != AFC_FORM_C;
+
+        if (e->form < AFC_FORM_C || e->form > AFC_FORM_PARALLEL_LC)
+            return AFC_ERR_ELEMENT;
+        if ((needC && !(e->C > 0)) || (needL && !(e->L > 0)))
+            return AFC_ERR_ELEMENT;
+
+        a->series = e->branch == AFC_SERIES;
+        a->inverted = 0;
+        a->P = a->Q = 0;
+
+        // P and Q of the arm as a shunt admittance or a series impedance
+        switch (e->form) {
+        case AFC_FORM_C:
+            if (a->series) a->Q = 1 / e->C; else a->P = e->C;
+            break;
+        case AFC_FORM_L:
+            if (a->series) a->P = e->L; else a->Q = 1 / e->L;
+            break;
+        case AFC_FORM_SERIES_LC:      // impedance j(wL - 1/(wC))
+            a->P = e->L;
+            a->Q = 1 / e->C;
+            a->inverted = !a->series;
+            break;
+        case AFC_FORM_PARALLEL_LC:    // admittance j(wC - 1/(wL))
+            a->P = e->C;
+            a->Q = 1 / e->L;
+            a->inverted = a->series;
+            break;
+        }
+    }
+    return AFC_OK;
+}
+
+static void run_sweep(block_kernel kernel, const arm *arms, int n, double Rs, double RL,
+                      const double *freq, long count, const afc_response *out) {
+    response_block b;
+
+    for (long base = 0; base < count; base += RESPONSE_BLOCK) {
+        int m = count - base < RESPONSE_BLOCK ? (int)(count - base) : RESPONSE_BLOCK;
+        // pad a short last block with its final frequency
+        for (int k = 0; k < RESPONSE_BLOCK; k++)
+            b.w[k] = 2 * AFC_M_PI * freq[base + (k < m ? k : m - 1)];
+
+        kernel(arms, n, Rs, RL, &b);
+
+        size_t bytes = (size_t)m * sizeof(double);
+        if (out->s21_re) memcpy(out->s21_re + base, b.s21_re, bytes);
+        if (out->s21_im) memcpy(out->s21_im + base, b.s21_im, bytes);
+        if (out->s11_re) memcpy(out->s11_re + base, b.s11_re, bytes);
+        if (out->s11_im) memcpy(out->s11_im + base, b.s11_im, bytes);
+        if (out->gd)     memcpy(out->gd + base, b.gd, bytes);
+        if (out->il_dB)
+            for (int k = 0; k < m; k++)
+                out->il_dB[base + k] = -10 * log10(b.s21_re[k] * b.s21_re[k] + b.s21_im[k] * b.s21_im[k]);
+        if (out->rl_dB)
+            for (int k = 0; k < m; k++)
+                out->rl_dB[base + k] = -10 * log10(b.s11_re[k] * b.s11_re[k] + b.s11_im[k] * b.s11_im[k]);
+    }
+}
+
+static int check_sweep(double Rs, double RL, const double *freq, long count) {
+    if (!(Rs > 0) || !(RL > 0))
+        return AFC_ERR_IMPEDANCE;
+    for (long i = 0; i < count; i++)
+        if (!(freq[i] > 0) || !isfinite(freq[i]))
+            return AFC_ERR_FREQ;
+    return AFC_OK;
+}
+
+int afc_ladder_response(const afc_element *el, int n, double Rs, double RL,
+                        const double *freq, long count, const afc_response *out) {
+    arm arms[AFC_MAX_ORDER];
+    const char *name;
+    int err;
+
+    if ((err = make_arms(el, n, arms)) != AFC_OK || (err = check_sweep(Rs, RL, freq, count)) != AFC_OK)
+        return err;
+    long t0 = afc_stats_begin();
+    run_sweep(pick_kernel(&name), arms, n, Rs, RL, freq, count, out);
+    afc_stats_end(AFC_STAGE_RESPONSE, t0);
+    return AFC_OK;
+}
+
+typedef struct {
+    block_kernel kernel;
+    const arm *arms;
+    int n;
+    double Rs, RL;
+    const double *freq;
+    const afc_response *out;
+} sweep_job;
+
+static double *offset(double *p, long by) {
+    return p ? p + by : NULL;
+}
+
+static void sweep_chunk(void *ctx, long begin, long end, int tid) {
+    const sweep_job *job = ctx;
+    const afc_response *o = job->out;
+    afc_response part = {
+        offset(o->s21_re, begin), offset(o->s21_im, begin),
+        offset(o->s11_re, begin), offset(o->s11_im, begin),
+        offset(o->il_dB, begin), offset(o->rl_dB, begin), offset(o->gd, begin)
+    };
+    (void)tid;
+    run_sweep(job->kernel, job->arms, job->n, job->Rs, job->RL, job->freq + begin, end - begin, &part);
+}
+
+int afc_ladder_response_mt(const afc_element *el, int n, double Rs, double RL,
+                           const double *freq, long count, const afc_response *out, int threads) {
+    arm arms[AFC_MAX_ORDER];
+    const char *name;
+    int err;
+
+    if ((err = make_arms(el, n, arms)) != AFC_OK || (err = check_sweep(Rs, RL, freq, count)) != AFC_OK)
+        return err;
+
+    sweep_job job = { pick_kernel(&name), arms, n, Rs, RL, freq, out };
+    long t0 = afc_stats_begin();
+    afc_parallel_for(count, RESPONSE_CHUNK, threads, sweep_chunk, &job);
+    afc_stats_end(AFC_STAGE_RESPONSE, t0);
+    return AFC_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Sensitivities                                                          */
+/* ---------------------------------------------------------------------- */
+
+typedef double complex cplx;
+
+typedef struct {
+    const afc_element *el;
+    const arm *arms;
+    int n;
+    double Rs, RL;
+    const double *freq;
+    const afc_sensitivity *out;
+} sens_job;
+
+// Arm reactance X and its derivative with respect to w, plus dX / d ln P
+// and dX / d ln Q, each with its own w derivative.
+static double arm_reactance(const arm *a, double w, double inv_w, double *dX,
+                            double dXp[2], double dXw[2]) {
+    double t[2] = { w * a->P, -a->Q * inv_w }, tw[2] = { a->P, a->Q * inv_w * inv_w };
+    double T = t[0] + t[1], dT = tw[0] + tw[1];
+    if (!a->inverted) {
+        for (int i = 0; i < 2; i++) {
+            dXp[i] = t[i];
+            dXw[i] = tw[i];
+        }
+        *dX = dT;
+        return T;
+    }
+    // X = -1/T: dX = dT / T^2
+    double r = 1 / (T + 1e-300);
+    for (int i = 0; i < 2; i++) {
+        dXp[i] = t[i] * r * r;
+        dXw[i] = (tw[i] - 2 * t[i] * dT * r) * r * r;
+    }
+    *dX = dT * r * r;
+    return -r;
+}
+
+// Which of an element's parts P and Q stand for: P is C or L itself, Q is
+// 1/C or 1/L (see make_arms), so d/d ln C = d/d ln P or -d/d ln Q.
+static void part_signs(afc_form form, double c[2], double l[2]) {
+    c[0] = form == AFC_FORM_C || form == AFC_FORM_PARALLEL_LC;
+    c[1] = -(double)(form == AFC_FORM_C || form == AFC_FORM_SERIES_LC);
+    l[0] = form == AFC_FORM_L || form == AFC_FORM_SERIES_LC;
+    l[1] = -(double)(form == AFC_FORM_L || form == AFC_FORM_PARALLEL_LC);
+}
+
+static void put(double *p, size_t i, double v) {
+    if (p)
+        p[i] = v;
+}
+
+// Complex products written out: the library routines behind a * b check
+// for infinities on every call.
+static inline cplx cmul(cplx a, cplx b) {
+    return CMPLX(creal(a) * creal(b) - cimag(a) * cimag(b), creal(a) * cimag(b) + cimag(a) * creal(b));
+}
+
+static inline cplx jmul(cplx a, double x) {   // a * jx
+    return CMPLX(-cimag(a) * x, creal(a) * x);
+}
+
+static void sens_chunk(void *ctx, long begin, long end, int tid) {
+    const sens_job *job = ctx;
+    const afc_sensitivity *o = job->out;
+    int n = job->n;
+    // row vector ahead of each arm and its w derivative, arm reactances
+    cplx r[AFC_MAX_ORDER], dr[AFC_MAX_ORDER];
+    double X[AFC_MAX_ORDER], dX[AFC_MAX_ORDER], dXp[AFC_MAX_ORDER][2], dXw[AFC_MAX_ORDER][2];
+    double sc[AFC_MAX_ORDER][2], sl[AFC_MAX_ORDER][2];
+    int delay = o->gd_C || o->gd_L;   // the loss alone needs no w derivatives
+    (void)tid;
+
+    for (int e = 0; e < n; e++)
+        part_signs(job->el[e].form, sc[e], sl[e]);
+
+    for (long k = begin; k < end; k++) {
+        double w = 2 * AFC_M_PI * job->freq[k], inv_w = 1 / w;
+
+        // forward: (a, b) -> (a, a z + b) through a series arm, (a + b z, b)
+        // shunt; dE/dz needs a of a series arm and b of a shunt arm
+        cplx a = 1, b = job->Rs, da = 0, db = 0;
+        for (int e = 0; e < n; e++) {
+            const arm *ar = &job->arms[e];
+            X[e] = arm_reactance(ar, w, inv_w, &dX[e], dXp[e], dXw[e]);
+            if (ar->series) {
+                r[e] = a;
+                dr[e] = da;
+                if (delay)
+                    db += jmul(da, X[e]) + jmul(a, dX[e]);
+                b += jmul(a, X[e]);
+            } else {
+                r[e] = b;
+                dr[e] = db;
+                if (delay)
+                    da += jmul(db, X[e]) + jmul(b, dX[e]);
+                a += jmul(b, X[e]);
+            }
+        }
+        cplx E = a + b / job->RL, dE = da + db / job->RL;
+        cplx invE = conj(E) / (creal(E) * creal(E) + cimag(E) * cimag(E));
+        cplx gdE = cmul(dE, invE);   // its imaginary part is the group delay
+
+        // backward: (p, q) -> (p + z q, q) through a series arm, (p, z p + q)
+        // shunt; dE/dz = r q or r p
+        cplx p = 1, q = 1 / job->RL, dp = 0, dq = 0;
+        for (int e = n - 1; e >= 0; e--) {
+            const arm *ar = &job->arms[e];
+            cplx c = ar->series ? q : p, dc = ar->series ? dq : dp;
+            // dE/dz and its w derivative, relative to E
+            cplx G = cmul(cmul(r[e], c), invE);
+
+            double il[2], gd[2];
+            for (int i = 0; i < 2; i++)
+                il[i] = DB_PER_NEPER * creal(jmul(G, dXp[e][i]));
+            size_t at = (size_t)k * n + e;
+            put(o->il_C, at, sc[e][0] * il[0] + sc[e][1] * il[1]);
+            put(o->il_L, at, sl[e][0] * il[0] + sl[e][1] * il[1]);
+            if (delay) {
+                cplx dG = cmul(cmul(dr[e], c) + cmul(r[e], dc), invE);
+                for (int i = 0; i < 2; i++) {
+                    cplx Ep = jmul(G, dXp[e][i]);
+                    cplx Ewp = jmul(dG, dXp[e][i]) + jmul(G, dXw[e][i]);
+                    gd[i] = cimag(Ewp - cmul(gdE, Ep));
+                }
+                put(o->gd_C, at, sc[e][0] * gd[0] + sc[e][1] * gd[1]);
+                put(o->gd_L, at, sl[e][0] * gd[0] + sl[e][1] * gd[1]);
+            }
+
+            if (ar->series) {
+                if (delay)
+                    dp += jmul(dq, X[e]) + jmul(q, dX[e]);
+                p += jmul(q, X[e]);
+            } else {
+                if (delay)
+                    dq += jmul(dp, X[e]) + jmul(p, dX[e]);
+                q += jmul(p, X[e]);
+            }
+        }
+    }
+}
+
+int afc_ladder_sensitivity(const afc_element *el, int n, double Rs, double RL,
+                           const double *freq, long count, const afc_sensitivity *out,
+                           int threads) {
+    arm arms[AFC_MAX_ORDER];
+    int err;
+
+    if ((err = make_arms(el, n, arms)) != AFC_OK || (err = check_sweep(Rs, RL, freq, count)) != AFC_OK)
+        return err;
+
+    sens_job job = { el, arms, n, Rs, RL, freq, out };
+    afc_parallel_for(count, SENS_CHUNK, threads, sens_chunk, &job);
+    return AFC_OK;
+}
+
+int afc_pass_band_sensitivity(const afc_spec *spec, const afc_element *el, int n,
+                              double *dB_per_pct) {
+    double freq[SENS_POINTS], il_C[SENS_POINTS * AFC_MAX_ORDER], il_L[SENS_POINTS * AFC_MAX_ORDER];
+    double F = spec->freq, load = afc_load_impedance(spec);
+    double f1 = F, f2 = F;
+    int half = SENS_POINTS / 2;
+
+    if (!(load > 0))
+        return AFC_ERR_ARGUMENT;
+    if (spec->type == AFC_BANDPASS || spec->type == AFC_BANDREJECT) {
+        // band edges: f2 - f1 = bw, f1 f2 = F^2
+        f1 = sqrt(spec->bw * spec->bw / 4 + F * F) - spec->bw / 2;
+        f2 = f1 + spec->bw;
+    }
+    for (int k = 0; k < SENS_POINTS; k++) {
+        double t = (k + 1.0) / SENS_POINTS;
+        switch (spec->type) {
+        case AFC_LOWPASS:    freq[k] = F * t; break;
+        case AFC_HIGHPASS:   freq[k] = F / t; break;
+        case AFC_BANDPASS:   freq[k] = f1 + (f2 - f1) * k / (SENS_POINTS - 1); break;
+        default:             // both sides of the stop band
+            freq[k] = k < half ? f1 * (k + 1.0) / half : f2 * half / (k - half + 1.0);
+            break;
+        }
+    }
+
+    afc_sensitivity s = { .il_C = il_C, .il_L = il_L };
+    int err = afc_ladder_sensitivity(el, n, spec->R, load, freq, SENS_POINTS, &s, 1);
+    if (err != AFC_OK)
+        return err;
+    for (int e = 0; e < n; e++) {
+        double worst = 0;
+        for (int k = 0; k < SENS_POINTS; k++)
+            worst = fmax(worst, fmax(fabs(il_C[k * n + e]), fabs(il_L[k * n + e])));
+        dB_per_pct[e] = worst * 0.01;
+    }
+    return AFC_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Incremental evaluation                                                 */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    const afc_ladder_tree *t;
+    const arm *arms;
+    combine_fn combine;
+    chain_fn chain;
+    const int *path;       // inner nodes to recompute, children first
+    int npath;
+    const afc_response *out;
+} tree_job;
+
+static int tree_planes(const afc_ladder_tree *t) {
+    return t->delay ? TREE_PLANES : PDA;
+}
+
+// The nodes are stored per block of TREE_CHUNK frequencies, so the whole
+// path of a block is close together; begin is a multiple of TREE_CHUNK.
+static double *tree_plane(const afc_ladder_tree *t, int node, int plane, long begin) {
+    size_t block = (size_t)(begin / TREE_CHUNK);
+    return t->nodes + ((block * (t->size - 1) + node - 1) * tree_planes(t) + plane) * TREE_STRIDE;
+}
+
+// Planes of child j over [begin, begin + TREE_CHUNK): stored for an inner
+// node, multiplied out into scratch for a leaf (the identity past the last
+// element).
+static void tree_child(const tree_job *job, int j, long begin,
+                       double *scratch, const double *pl[TREE_PLANES]) {
+    const afc_ladder_tree *t = job->t;
+    int planes = tree_planes(t);
+
+    if (j < t->size) {
+        for (int p = 0; p < planes; p++)
+            pl[p] = tree_plane(t, j, p, begin);
+        return;
+    }
+    double *o[TREE_PLANES];
+    for (int p = 0; p < planes; p++)
+        pl[p] = o[p] = scratch + p * TREE_CHUNK;
+    int first = (j - t->size) * TREE_LEAF;
+    int count = first < t->n ? (t->n - first < TREE_LEAF ? t->n - first : TREE_LEAF) : 0;
+    job->chain(job->arms + first, count, t->w + begin, t->w + t->padded + begin, o, t->delay);
+}
+
+static void tree_chunk(void *ctx, long begin, long end, int tid) {
+    const tree_job *job = ctx;
+    const afc_ladder_tree *t = job->t;
+    double left[TREE_PLANES * TREE_CHUNK], right[TREE_PLANES * TREE_CHUNK];
+    int planes = tree_planes(t);
+    (void)end;
+    (void)tid;
+
+    for (int i = 0; i < job->npath; i++) {
+        int node = job->path[i];
+        const double *l[TREE_PLANES], *r[TREE_PLANES];
+        double *o[TREE_PLANES];
+        tree_child(job, 2 * node, begin, left, l);
+        tree_child(job, 2 * node + 1, begin, right, r);
+        for (int p = 0; p < planes; p++)
+            o[p] = tree_plane(t, node, p, begin);
+        job->combine(o, l, r, t->delay);
+    }
+}
+
+static void tree_update(const afc_ladder_tree *t, const int *path, int npath) {
+    arm arms[AFC_MAX_ORDER];
+    make_arms(t->el, t->n, arms);   // validated when the elements were set
+    tree_job job = { t, arms, NULL, NULL, path, npath, NULL };
+    job.combine = pick_tree(&job.chain);
+    afc_parallel_for(t->padded, TREE_CHUNK, t->threads, tree_chunk, &job);
+}
+
+int afc_tree_init(afc_ladder_tree *t, const afc_element *el, int n, double Rs, double RL,
+                  const double *freq, long count, int delay, int threads) {
+    arm arms[AFC_MAX_ORDER];
+    int path[AFC_MAX_ORDER], err;
+
+    memset(t, 0, sizeof *t);
+    if ((err = make_arms(el, n, arms)) != AFC_OK || (err = check_sweep(Rs, RL, freq, count)) != AFC_OK)
+        return err;
+    t->n = n;
+    t->size = 2;
+    while (t->size * TREE_LEAF < n)
+        t->size *= 2;
+    t->count = count;
+    t->Rs = Rs;
+    t->RL = RL;
+    t->delay = delay != 0;
+    t->threads = threads;
+    memcpy(t->el, el, (size_t)n * sizeof *el);
+    t->padded = (count + TREE_CHUNK - 1) / TREE_CHUNK * TREE_CHUNK;
+    t->w = malloc(2 * (size_t)t->padded * sizeof *t->w);
+    t->nodes = malloc((size_t)(t->padded / TREE_CHUNK) * (t->size - 1) * tree_planes(t) *
+                      TREE_STRIDE * sizeof *t->nodes);
+    if (!t->w || !t->nodes) {
+        afc_tree_free(t);
+        return AFC_ERR_MEMORY;
+    }
+    // the last block is padded with the final frequency
+    for (long k = 0; k < t->padded; k++) {
+        t->w[k] = 2 * AFC_M_PI * freq[k < count ? k : count - 1];
+        t->w[t->padded + k] = 1 / t->w[k];
+    }
+
+    // every inner node, deepest first
+    for (int i = 0; i < t->size - 1; i++)
+        path[i] = t->size - 1 - i;
+    tree_update(t, path, t->size - 1);
+    return AFC_OK;
+}
+
+int afc_tree_set(afc_ladder_tree *t, int index, const afc_element *e) {
+    arm a;
+    int path[32], npath = 0, err;
+
+    if (index < 0 || index >= t->n)
+        return AFC_ERR_ARGUMENT;
+    if ((err = make_arms(e, 1, &a)) != AFC_OK)
+        return err;
+    if (e->branch != t->el[index].branch)
+        return AFC_ERR_ELEMENT;
+    t->el[index] = *e;
+    for (int node = (t->size + index / TREE_LEAF) / 2; node >= 1; node /= 2)
+        path[npath++] = node;
+    tree_update(t, path, npath);
+    return AFC_OK;
+}
+
+static void tree_out_chunk(void *ctx, long begin, long end, int tid) {
+    const tree_job *job = ctx;
+    const afc_ladder_tree *t = job->t;
+    const afc_response *o = job->out;
+    double kRL = 1 / t->RL, kRsRL = t->Rs / t->RL, k21 = 2 * sqrt(t->Rs / t->RL);
+    (void)tid;
+
+    const double *root[TREE_PLANES];
+    for (long k = begin; k < end; k++) {
+        int i = (int)(k % TREE_CHUNK);
+        if (k == begin || i == 0)
+            for (int p = 0; p < tree_planes(t); p++)
+                root[p] = tree_plane(t, 1, p, k - i);
+
+        // Den = A + B/RL + C Rs + D Rs/RL, as in the cascade kernel
+        double a = root[PA][i], b = root[PB][i], c = root[PC][i], d = root[PD][i];
+        double Er = a + d * kRsRL, Ei = b * kRL + c * t->Rs;
+        double Nr = a - d * kRsRL, Ni = b * kRL - c * t->Rs;
+        double inv = 1 / (Er * Er + Ei * Ei);
+        double s21r = Er * inv * k21, s21i = -Ei * inv * k21;
+        double s11r = (Nr * Er + Ni * Ei) * inv, s11i = (Ni * Er - Nr * Ei) * inv;
+        put(o->s21_re, k, s21r);
+        put(o->s21_im, k, s21i);
+        put(o->s11_re, k, s11r);
+        put(o->s11_im, k, s11i);
+        if (o->il_dB)
+            o->il_dB[k] = -10 * log10(s21r * s21r + s21i * s21i);
+        if (o->rl_dB)
+            o->rl_dB[k] = -10 * log10(s11r * s11r + s11i * s11i);
+        if (o->gd) {
+            double dEr = root[PDA][i] + root[PDD][i] * kRsRL;
+            double dEi = root[PDB][i] * kRL + root[PDC][i] * t->Rs;
+            o->gd[k] = (dEi * Er - dEr * Ei) * inv;
+        }
+    }
+}
+
+int afc_tree_response(const afc_ladder_tree *t, const afc_response *out) {
+    if (!t->nodes || (out->gd && !t->delay))
+        return AFC_ERR_ARGUMENT;
+    tree_job job = { t, NULL, NULL, NULL, NULL, 0, out };
+    afc_parallel_for(t->count, RESPONSE_CHUNK, t->threads, tree_out_chunk, &job);
+    return AFC_OK;
+}
+
+void afc_tree_free(afc_ladder_tree *t) {
+    free(t->w);
+    free(t->nodes);
+    t->w = t->nodes = NULL;
+}
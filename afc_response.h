@@ -0,0 +1,104 @@
+/*
+ * Analog Filter Calculator - ladder frequency response
+ * Evaluates a designed PI/Tee ladder over a frequency sweep by cascading
+ * the ABCD matrices of its arms: S21, S11, insertion loss, return loss and
+ * group delay. Frequencies and results are separate arrays (structure of
+ * arrays) and the inner loop runs on AVX-512, AVX2 or plain doubles,
+ * whichever the CPU supports.
+ *
+ * The element sensitivities of the loss and group delay come from the
+ * same chain in two passes per frequency: a forward pass keeps the row
+ * vector [1 Rs] M1...Mk ahead of each arm, a backward pass the column
+ * vector M(k+1)...Mn [1 1/RL]^T behind it, and the derivative of the
+ * response denominator with respect to arm k is their product.
+ *
+ * For interactive tuning, an afc_ladder_tree keeps per frequency a balanced
+ * tree of the partial chain products. A lossless ABCD matrix has A, D real
+ * and B, C imaginary, so a node is four real planes (eight with the w
+ * derivative for the group delay), stored per block of frequencies. Leaves
+ * are runs of eight arms chained on the fly, so changing one element
+ * re-chains its run and recomputes the log2(n/8) nodes above it. On sweeps
+ * too big for the cache the update is bound by memory traffic, and the
+ * gain over a full afc_ladder_response() is mostly for long ladders.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_RESPONSE_H
+#define AFC_RESPONSE_H
+
+#include "afc.h"
+
+// Output arrays of count entries each; leave a pointer NULL to skip it.
+typedef struct {
+    double *s21_re, *s21_im;
+    double *s11_re, *s11_im;
+    double *il_dB;         // insertion loss, -20 log10 |S21|
+    double *rl_dB;         // return loss, -20 log10 |S11|
+    double *gd;            // group delay of S21 in s
+} afc_response;
+
+// Response of the n-element ladder el between a source Rs and a load RL
+// (ohm) at the count frequencies freq (Hz, > 0). S-parameters are
+// referenced to Rs at the input and RL at the output.
+int afc_ladder_response(const afc_element *el, int n, double Rs, double RL,
+                        const double *freq, long count, const afc_response *out);
+
+// Same, with the sweep split across threads (0 = all cores).
+int afc_ladder_response_mt(const afc_element *el, int n, double Rs, double RL,
+                           const double *freq, long count, const afc_response *out, int threads);
+
+// Sensitivities to the element values, count * n entries each indexed
+// [k * n + e] for frequency k and element e. The derivatives are taken
+// with respect to ln C and ln L, i.e. per relative change of the part, and
+// are 0 for a part the element does not have. NULL pointers are skipped.
+typedef struct {
+    double *il_C, *il_L;   // d insertion loss (dB)
+    double *gd_C, *gd_L;   // d group delay (s)
+} afc_sensitivity;
+
+// Sensitivities of the ladder el between Rs and RL at the count
+// frequencies freq, split across threads (0 = all cores).
+int afc_ladder_sensitivity(const afc_element *el, int n, double Rs, double RL,
+                           const double *freq, long count, const afc_sensitivity *out,
+                           int threads);
+
+// Worst change of the pass-band insertion loss per 1 % change of each
+// element of a design for spec: dB_per_pct[e] is the largest |d loss| of
+// element e's C or L over the pass band (to the cutoff, or between or
+// outside the BP/BR band edges).
+int afc_pass_band_sensitivity(const afc_spec *spec, const afc_element *el, int n,
+                              double *dB_per_pct);
+
+typedef struct {
+    int n, size;           // elements, leaves of 8 arms (power of two >= 2)
+    long count, padded;    // frequencies, rounded up to whole blocks
+    double Rs, RL;
+    int delay;             // w derivatives kept, group delay available
+    int threads;           // 0 = all cores
+    afc_element el[AFC_MAX_ORDER];
+    double *w;             // angular frequencies, then their inverses
+    double *nodes;         // size - 1 inner nodes of 4 or 8 planes, per block
+} afc_ladder_tree;
+
+// Build the tree of the ladder el between Rs and RL at the count
+// frequencies freq. delay = 0 halves the memory but leaves out the group
+// delay. Free it with afc_tree_free().
+int afc_tree_init(afc_ladder_tree *t, const afc_element *el, int n, double Rs, double RL,
+                  const double *freq, long count, int delay, int threads);
+
+// Replace element index (same branch, any form) and update its leaf and
+// the path to the root.
+int afc_tree_set(afc_ladder_tree *t, int index, const afc_element *e);
+
+// Response of the current ladder, as afc_ladder_response(); out->gd needs
+// a tree built with delay.
+int afc_tree_response(const afc_ladder_tree *t, const afc_response *out);
+
+void afc_tree_free(afc_ladder_tree *t);
+
+// Instruction set the response kernel runs on: "avx512", "avx2" or "scalar".
+const char *afc_response_isa(void);
+
+#endif
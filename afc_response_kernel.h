@@ -0,0 +1,185 @@
+/*
+ * Analog Filter Calculator - ABCD cascade kernel
+ * Included by afc_response.c once per instruction set with
+ *   KERNEL_NAME    function name
+ *   COMBINE_NAME   name of the tree node product
+ *   CHAIN_NAME     name of the tree leaf (arm chain) product
+ *   KERNEL_TARGET  function attributes (target ISA)
+ *   KERNEL_WIDTH   doubles per vector
+ * Computes a block of RESPONSE_BLOCK frequencies, KERNEL_WIDTH at a time,
+ * with the whole chain state held in vector registers. The tree functions
+ * work on a block of TREE_CHUNK frequencies of an afc_ladder_tree: the
+ * chain matrix of a run of arms (a leaf) and the product of two nodes.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+KERNEL_TARGET
+static void KERNEL_NAME(const arm *arms, int n, double Rs, double RL, response_block *b) {
+    typedef double vd __attribute__((vector_size(KERNEL_WIDTH * sizeof(double))));
+    const double kRL = 1 / RL, kRsRL = Rs / RL;
+    const double k21 = 2 * sqrt(Rs / RL);
+
+    for (int f = 0; f < RESPONSE_BLOCK; f += KERNEL_WIDTH) {
+        vd w, inv_w, zero = {0}, one = zero + 1;
+        memcpy(&w, &b->w[f], sizeof w);
+        inv_w = one / w;
+
+        // chain matrix and its derivative with respect to w
+        vd Ar = one, Ai = zero, Br = zero, Bi = zero;
+        vd Cr = zero, Ci = zero, Dr = one, Di = zero;
+        vd dAr = zero, dAi = zero, dBr = zero, dBi = zero;
+        vd dCr = zero, dCi = zero, dDr = zero, dDi = zero;
+
+        for (int e = 0; e < n; e++) {
+            const arm *a = &arms[e];
+            // the arm immittance is j X: X = w P - Q / w, or -1/that when inverted
+            vd T = w * a->P - inv_w * a->Q;
+            vd dT = a->P + inv_w * inv_w * a->Q;
+            vd X, dX;
+            if (a->inverted) {
+                vd r = one / (T + 1e-300);
+                X = -r;
+                dX = dT * r * r;
+            } else {
+                X = T;
+                dX = dT;
+            }
+
+            // (u + jv) * jX = -vX + j uX, and its derivative by the product rule
+            if (a->series) {       // B += A z, D += C z
+                dBr -= dAi * X + Ai * dX;
+                dBi += dAr * X + Ar * dX;
+                dDr -= dCi * X + Ci * dX;
+                dDi += dCr * X + Cr * dX;
+                Br -= Ai * X;
+                Bi += Ar * X;
+                Dr -= Ci * X;
+                Di += Cr * X;
+            } else {               // A += B y, C += D y
+                dAr -= dBi * X + Bi * dX;
+                dAi += dBr * X + Br * dX;
+                dCr -= dDi * X + Di * dX;
+                dCi += dDr * X + Dr * dX;
+                Ar -= Bi * X;
+                Ai += Br * X;
+                Cr -= Di * X;
+                Ci += Dr * X;
+            }
+        }
+
+        // Den = A + B/RL + C Rs + D Rs/RL; S21 = 2 sqrt(Rs/RL) / Den
+        vd Er = Ar + Br * kRL + Cr * Rs + Dr * kRsRL;
+        vd Ei = Ai + Bi * kRL + Ci * Rs + Di * kRsRL;
+        vd dEr = dAr + dBr * kRL + dCr * Rs + dDr * kRsRL;
+        vd dEi = dAi + dBi * kRL + dCi * Rs + dDi * kRsRL;
+        vd Nr = Ar + Br * kRL - Cr * Rs - Dr * kRsRL;
+        vd Ni = Ai + Bi * kRL - Ci * Rs - Di * kRsRL;
+        vd inv = one / (Er * Er + Ei * Ei);
+
+        vd s21r = Er * inv * k21, s21i = -Ei * inv * k21;
+        vd s11r = (Nr * Er + Ni * Ei) * inv, s11i = (Ni * Er - Nr * Ei) * inv;
+        // group delay = d arg(Den) / dw = Im(Den' conj(Den)) / |Den|^2
+        vd gd = (dEi * Er - dEr * Ei) * inv;
+
+        memcpy(&b->s21_re[f], &s21r, sizeof s21r);
+        memcpy(&b->s21_im[f], &s21i, sizeof s21i);
+        memcpy(&b->s11_re[f], &s11r, sizeof s11r);
+        memcpy(&b->s11_im[f], &s11i, sizeof s11i);
+        memcpy(&b->gd[f], &gd, sizeof gd);
+    }
+}
+
+// Chain matrix [[a, jb], [jc, d]] of arms[0..n-1] into the planes o.
+KERNEL_TARGET
+static void CHAIN_NAME(const arm *arms, int n, const double *w_in, const double *inv_w_in,
+                       double *o[TREE_PLANES], int delay) {
+    typedef double vd __attribute__((vector_size(KERNEL_WIDTH * sizeof(double))));
+    const size_t bytes = sizeof(vd);
+
+    for (int k = 0; k < TREE_CHUNK; k += KERNEL_WIDTH) {
+        vd w, inv_w, zero = {0}, one = zero + 1;
+        vd a = one, b = zero, c = zero, d = one;
+        vd da = zero, db = zero, dc = zero, dd = zero;
+        memcpy(&w, &w_in[k], bytes);
+        memcpy(&inv_w, &inv_w_in[k], bytes);
+
+        for (int e = 0; e < n; e++) {
+            const arm *ar = &arms[e];
+            vd X = w * ar->P - inv_w * ar->Q;
+            vd dX = ar->P + inv_w * inv_w * ar->Q;
+            if (ar->inverted) {
+                vd r = one / (X + 1e-300);
+                X = -r;
+                dX = dX * r * r;
+            }
+            // times [[1, jX], [0, 1]] or [[1, 0], [jX, 1]]
+            if (ar->series) {
+                db += da * X + a * dX;
+                dd -= dc * X + c * dX;
+                b += a * X;
+                d -= c * X;
+            } else {
+                da -= db * X + b * dX;
+                dc += dd * X + d * dX;
+                a -= b * X;
+                c += d * X;
+            }
+        }
+        memcpy(&o[PA][k], &a, bytes);
+        memcpy(&o[PB][k], &b, bytes);
+        memcpy(&o[PC][k], &c, bytes);
+        memcpy(&o[PD][k], &d, bytes);
+        if (delay) {
+            memcpy(&o[PDA][k], &da, bytes);
+            memcpy(&o[PDB][k], &db, bytes);
+            memcpy(&o[PDC][k], &dc, bytes);
+            memcpy(&o[PDD][k], &dd, bytes);
+        }
+    }
+}
+
+// o = l r with [[a, jb], [jc, d]] nodes: both products of the imaginary
+// entries are real, so everything stays in real planes.
+KERNEL_TARGET
+static void COMBINE_NAME(double *o[TREE_PLANES], const double *l[TREE_PLANES],
+                         const double *r[TREE_PLANES], int delay) {
+    typedef double vd __attribute__((vector_size(KERNEL_WIDTH * sizeof(double))));
+    const size_t bytes = sizeof(vd);
+
+    for (int k = 0; k < TREE_CHUNK; k += KERNEL_WIDTH) {
+        vd la, lb, lc, ld, ra, rb, rc, rd;
+        memcpy(&la, &l[PA][k], bytes); memcpy(&lb, &l[PB][k], bytes);
+        memcpy(&lc, &l[PC][k], bytes); memcpy(&ld, &l[PD][k], bytes);
+        memcpy(&ra, &r[PA][k], bytes); memcpy(&rb, &r[PB][k], bytes);
+        memcpy(&rc, &r[PC][k], bytes); memcpy(&rd, &r[PD][k], bytes);
+        if (delay) {
+            vd dla, dlb, dlc, dld, dra, drb, drc, drd, x;
+            memcpy(&dla, &l[PDA][k], bytes); memcpy(&dlb, &l[PDB][k], bytes);
+            memcpy(&dlc, &l[PDC][k], bytes); memcpy(&dld, &l[PDD][k], bytes);
+            memcpy(&dra, &r[PDA][k], bytes); memcpy(&drb, &r[PDB][k], bytes);
+            memcpy(&drc, &r[PDC][k], bytes); memcpy(&drd, &r[PDD][k], bytes);
+            x = dla * ra + la * dra - dlb * rc - lb * drc;
+            memcpy(&o[PDA][k], &x, bytes);
+            x = dla * rb + la * drb + dlb * rd + lb * drd;
+            memcpy(&o[PDB][k], &x, bytes);
+            x = dlc * ra + lc * dra + dld * rc + ld * drc;
+            memcpy(&o[PDC][k], &x, bytes);
+            x = dld * rd + ld * drd - dlc * rb - lc * drb;
+            memcpy(&o[PDD][k], &x, bytes);
+        }
+        vd oa = la * ra - lb * rc, ob = la * rb + lb * rd;
+        vd oc = lc * ra + ld * rc, od = ld * rd - lc * rb;
+        memcpy(&o[PA][k], &oa, bytes);
+        memcpy(&o[PB][k], &ob, bytes);
+        memcpy(&o[PC][k], &oc, bytes);
+        memcpy(&o[PD][k], &od, bytes);
+    }
+}
+
+#undef KERNEL_NAME
+#undef COMBINE_NAME
+#undef CHAIN_NAME
+#undef KERNEL_TARGET
+#undef KERNEL_WIDTH
@@ -0,0 +1,439 @@
+/*
+ * Analog Filter Calculator - standard-value snapping
+ * A choice of realizations moves each part by delta_k = ln(real/ideal); to
+ * first order the loss moves by r = sum_k delta_k J_k, J_k the loss
+ * sensitivity of part k over the grid. The search minimizes |r|^2.
+ *
+ * Everything the search needs follows from the Gram matrix J_m . J_k: the
+ * residual norm and the projections p_m = r . J_m are updated per node in
+ * O(parts) without touching the grid. A partial choice is cut when even
+ *   |r| - sum of the largest remaining |delta J|            (triangle)
+ *   |r| + sum over remaining m of min_j delta_mj p_m / |r|  (projection on r)
+ * exceeds the best cost found. The top levels of the tree are split into
+ * tasks that run in parallel and share that best cost.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "afc_snap.h"
+#include "afc_parallel.h"
+#include "afc_response.h"
+
+#define SNAP_FLOOR_DB     60       // loss beyond this counts as this
+#define SNAP_MAX_PARTS    (2 * AFC_MAX_ORDER)
+#define SNAP_TASKS_PER_THREAD 16
+#define SNAP_DEFAULT_NODES 20000000L
+#define SNAP_POLISH_PASSES 8
+
+typedef struct {
+    int element;
+    int isL;
+    double ideal;
+    int ncand;
+    afc_part cand[AFC_MAX_CANDIDATES];
+    double delta[AFC_MAX_CANDIDATES];  // ln(candidate / ideal)
+    double dmin, dmax;
+    double reach;                      // largest |delta J|
+    const double *J;                   // loss sensitivity over the grid
+} snap_part;
+
+typedef struct {
+    double cost;
+    unsigned char choice[SNAP_MAX_PARTS];
+} task_result;
+
+typedef struct {
+    snap_part *parts;
+    int nparts;
+    const double *gram;                // nparts x nparts, J_m . J_k
+    double tail[SNAP_MAX_PARTS + 1];   // sum of reach from a depth on
+    int split;                         // depth covered by the task prefix
+    long task_nodes;                   // node budget per task
+    atomic_uint_least64_t best;        // bits of the best cost (non-negative doubles order as integers)
+    atomic_long nodes;
+    atomic_int truncated;
+    task_result *results;
+    double *scratch;                   // per worker: projection stack
+} snap_job;
+
+/* ---------------------------------------------------------------------- */
+/* Response helpers                                                       */
+/* ---------------------------------------------------------------------- */
+
+// Insertion loss of a ladder, clipped at SNAP_FLOOR_DB.
+static int clipped_loss(const afc_element *el, int n, double Rs, double RL,
+                        const double *freq, int count, double *il) {
+    int err = afc_ladder_response(el, n, Rs, RL, freq, count, &(afc_response){ .il_dB = il });
+    for (int i = 0; err == AFC_OK && i < count; i++)
+        il[i] = fmin(il[i], SNAP_FLOOR_DB);
+    return err;
+}
+
+static void apply_choice(const afc_element *el, int n, const snap_part *parts, int nparts,
+                         const unsigned char *choice, afc_element *out) {
+    memcpy(out, el, n * sizeof *out);
+    for (int k = 0; k < nparts; k++) {
+        const snap_part *p = &parts[k];
+        if (p->isL)
+            out[p->element].L = p->cand[choice[k]].value;
+        else
+            out[p->element].C = p->cand[choice[k]].value;
+    }
+}
+
+// Squared and worst deviation of a choice from the ideal loss.
+static int exact_cost(const afc_element *el, int n, double Rs, double RL, const double *freq,
+                      int count, const double *target, const snap_part *parts, int nparts,
+                      const unsigned char *choice, double *sq, double *worst) {
+    afc_element trial[AFC_MAX_ORDER];
+    double il[AFC_SNAP_MAX_POINTS];
+
+    apply_choice(el, n, parts, nparts, choice, trial);
+    int err = clipped_loss(trial, n, Rs, RL, freq, count, il);
+    *sq = 0;
+    *worst = 0;
+    for (int i = 0; err == AFC_OK && i < count; i++) {
+        double d = il[i] - target[i];
+        *sq += d * d;
+        *worst = fmax(*worst, fabs(d));
+    }
+    return err;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Branch and bound                                                       */
+/* ---------------------------------------------------------------------- */
+
+static double load_best(snap_job *job) {
+    uint64_t bits = atomic_load(&job->best);
+    double v;
+    memcpy(&v, &bits, sizeof v);
+    return v;
+}
+
+static void offer_best(snap_job *job, double cost) {
+    uint64_t bits, cur = atomic_load(&job->best);
+    memcpy(&bits, &cost, sizeof bits);
+    while (bits < cur && !atomic_compare_exchange_weak(&job->best, &cur, bits))
+        ;
+}
+
+static double norm2(const double *r, int count) {
+    double s = 0;
+    for (int i = 0; i < count; i++)
+        s += r[i] * r[i];
+    return s;
+}
+
+// Lower bound of any completion of a partial choice at depth with residual
+// norm^2 s and projections p[m] = r . J_m.
+static double bound(const snap_job *job, int depth, double s, const double *p) {
+    double norm = sqrt(s);
+    double b = norm - job->tail[depth];
+    if (norm > 0) {
+        double proj = 0;
+        for (int m = depth; m < job->nparts; m++)
+            proj += p[m] * (p[m] > 0 ? job->parts[m].dmin : job->parts[m].dmax);
+        b = fmax(b, norm + proj / norm);
+    }
+    return b > 0 ? b * b : 0;
+}
+
+typedef struct {
+    snap_job *job;
+    task_result *res;
+    double *stack;         // (nparts + 1) projection vectors
+    unsigned char choice[SNAP_MAX_PARTS];
+    long nodes;
+} dfs_state;
+
+// Step from depth to depth + 1 choosing candidate j: new projections into
+// next, returns the new residual norm^2.
+static double step(const snap_job *job, int depth, int j, double s, const double *p, double *next) {
+    const double *g = job->gram + (size_t)depth * job->nparts;
+    double d = job->parts[depth].delta[j];
+    for (int m = depth + 1; m < job->nparts; m++)
+        next[m] = p[m] + d * g[m];
+    return s + d * (2 * p[depth] + d * g[depth]);
+}
+
+static void dfs(dfs_state *st, int depth, double s) {
+    snap_job *job = st->job;
+    int np = job->nparts;
+    const double *p = st->stack + (size_t)depth * np;
+
+    if (++st->nodes > job->task_nodes) {
+        atomic_store(&job->truncated, 1);
+        return;
+    }
+    if (depth == np) {
+        if (s < st->res->cost) {
+            st->res->cost = s;
+            memcpy(st->res->choice, st->choice, np);
+            offer_best(job, s);
+        }
+        return;
+    }
+
+    // visit the children nearest the ideal first
+    const snap_part *part = &job->parts[depth];
+    const double *g = job->gram + (size_t)depth * np;
+    double cs[AFC_MAX_CANDIDATES];
+    int order[AFC_MAX_CANDIDATES];
+    for (int j = 0; j < part->ncand; j++) {
+        double d = part->delta[j];
+        double t = s + d * (2 * p[depth] + d * g[depth]);
+        cs[j] = t;
+        int k = j;
+        while (k > 0 && cs[order[k - 1]] > t) {
+            order[k] = order[k - 1];
+            k--;
+        }
+        order[k] = j;
+    }
+
+    double *next = st->stack + (size_t)(depth + 1) * np;
+    for (int c = 0; c < part->ncand; c++) {
+        int j = order[c];
+        step(job, depth, j, s, p, next);
+        // strict test: subtrees that can tie the best are still explored,
+        // so the result does not depend on which task finished first
+        if (bound(job, depth + 1, cs[j], next) > load_best(job))
+            continue;
+        st->choice[depth] = (unsigned char)j;
+        dfs(st, depth + 1, cs[j]);
+    }
+}
+
+static void run_tasks(void *ctx, long begin, long end, int tid) {
+    snap_job *job = ctx;
+    int np = job->nparts;
+    dfs_state st = { .job = job, .stack = job->scratch + (size_t)tid * (np + 1) * np };
+
+    for (long t = begin; t < end; t++) {
+        st.res = &job->results[t];
+        st.res->cost = INFINITY;
+        st.nodes = 0;
+
+        // decode the task's prefix (mixed radix over the first split parts)
+        long rest = t;
+        double s = 0;
+        int alive = 1;
+        memset(st.stack, 0, np * sizeof *st.stack);
+        for (int d = job->split - 1; d >= 0; d--) {
+            st.choice[d] = (unsigned char)(rest % job->parts[d].ncand);
+            rest /= job->parts[d].ncand;
+        }
+        for (int d = 0; d < job->split && alive; d++) {
+            double *next = st.stack + (size_t)(d + 1) * np;
+            s = step(job, d, st.choice[d], s, st.stack + (size_t)d * np, next);
+            alive = bound(job, d + 1, s, next) <= load_best(job);
+        }
+        if (alive)
+            dfs(&st, job->split, s);
+        atomic_fetch_add(&job->nodes, st.nodes);
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* Driver                                                                 */
+/* ---------------------------------------------------------------------- */
+
+int afc_snap(const afc_element *el, int n, double Rs, double RL,
+             const double *freq, int count, const afc_snap_config *cfg,
+             afc_element *out, afc_snap_element *parts_out, afc_snap_result *res) {
+    snap_part parts[SNAP_MAX_PARTS];
+    double target[AFC_SNAP_MAX_POINTS];
+    int nparts = 0, threads = afc_thread_count(cfg->threads);
+    int err;
+
+    if (count < 1 || count > AFC_SNAP_MAX_POINTS || afc_eseries_size(cfg->series) == 0)
+        return AFC_ERR_ARGUMENT;
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    if ((err = clipped_loss(el, n, Rs, RL, freq, count, target)) != AFC_OK)
+        return err;
+
+    // the parts and their nearest realizations
+    for (int e = 0; e < n; e++) {
+        for (int isL = 0; isL <= 1; isL++) {
+            double v = isL ? el[e].L : el[e].C;
+            if (!(v > 0))
+                continue;
+            snap_part *p = &parts[nparts++];
+            p->element = e;
+            p->isL = isL;
+            p->ideal = v;
+            p->ncand = afc_eseries_candidates(cfg->series, v, cfg->pairs, p->cand, cfg->pairs ? 4 : 2);
+            if (p->ncand == 0)
+                return AFC_ERR_ELEMENT;
+        }
+    }
+
+    double *sens = malloc((size_t)nparts * count * sizeof *sens);
+    double *adj = malloc(2 * (size_t)n * count * sizeof *adj);
+    if (!sens || !adj) {
+        free(sens);
+        free(adj);
+        return AFC_ERR_MEMORY;
+    }
+
+    // loss sensitivities of all parts in one adjoint sweep; zero where the
+    // loss is clipped
+    afc_sensitivity as = { .il_C = adj, .il_L = adj + (size_t)n * count };
+    err = afc_ladder_sensitivity(el, n, Rs, RL, freq, count, &as, 1);
+    for (int k = 0; k < nparts && err == AFC_OK; k++) {
+        snap_part *p = &parts[k];
+        double *J = sens + (size_t)k * count;
+        const double *d = p->isL ? as.il_L : as.il_C;
+        for (int i = 0; i < count; i++)
+            J[i] = target[i] < SNAP_FLOOR_DB ? d[(size_t)i * n + p->element] : 0;
+        p->J = J;
+
+        p->dmin = INFINITY;
+        p->dmax = -INFINITY;
+        for (int j = 0; j < p->ncand; j++) {
+            p->delta[j] = log(p->cand[j].value / p->ideal);
+            p->dmin = fmin(p->dmin, p->delta[j]);
+            p->dmax = fmax(p->dmax, p->delta[j]);
+        }
+        p->reach = fmax(-p->dmin, p->dmax) * sqrt(norm2(J, count));
+    }
+    free(adj);
+    if (err != AFC_OK) {
+        free(sens);
+        return err;
+    }
+
+    // most influential parts first: the bound bites earliest that way
+    for (int a = 1; a < nparts; a++) {
+        snap_part t = parts[a];
+        int k = a;
+        while (k > 0 && parts[k - 1].reach < t.reach) {
+            parts[k] = parts[k - 1];
+            k--;
+        }
+        parts[k] = t;
+    }
+
+    snap_job *job = calloc(1, sizeof *job);
+    double *gram = malloc((size_t)nparts * nparts * sizeof *gram);
+    long ntasks = 1;
+    if (!job || !gram) {
+        free(job);
+        free(gram);
+        free(sens);
+        return AFC_ERR_MEMORY;
+    }
+    for (int a = 0; a < nparts; a++)
+        for (int b = 0; b < nparts; b++) {
+            double d = 0;
+            for (int i = 0; i < count; i++)
+                d += parts[a].J[i] * parts[b].J[i];
+            gram[(size_t)a * nparts + b] = d;
+        }
+    free(sens);
+    job->parts = parts;
+    job->nparts = nparts;
+    job->gram = gram;
+    for (int k = nparts - 1; k >= 0; k--)
+        job->tail[k] = job->tail[k + 1] + parts[k].reach;
+    while (job->split < nparts && ntasks * parts[job->split].ncand <= (long)SNAP_TASKS_PER_THREAD * threads)
+        ntasks *= parts[job->split++].ncand;
+    long budget = cfg->max_nodes > 0 ? cfg->max_nodes : SNAP_DEFAULT_NODES;
+    job->task_nodes = budget / ntasks > 1000 ? budget / ntasks : 1000;
+    double inf = INFINITY;
+    uint64_t inf_bits;
+    memcpy(&inf_bits, &inf, sizeof inf_bits);
+    atomic_init(&job->best, inf_bits);
+    atomic_init(&job->nodes, 0);
+    atomic_init(&job->truncated, 0);
+    job->results = malloc(ntasks * sizeof *job->results);
+    job->scratch = malloc((size_t)threads * (nparts + 1) * nparts * sizeof *job->scratch);
+    if (!job->results || !job->scratch) {
+        free(job->results);
+        free(job->scratch);
+        free(job);
+        free(gram);
+        return AFC_ERR_MEMORY;
+    }
+
+    afc_parallel_steal(ntasks, 1, threads, run_tasks, job);
+
+    // lowest cost, earliest task on ties
+    unsigned char choice[SNAP_MAX_PARTS] = {0};
+    double best = INFINITY;
+    for (long t = 0; t < ntasks; t++)
+        if (job->results[t].cost < best) {
+            best = job->results[t].cost;
+            memcpy(choice, job->results[t].choice, nparts);
+        }
+    res->nodes = atomic_load(&job->nodes);
+    res->complete = !atomic_load(&job->truncated);
+    free(job->results);
+    free(job->scratch);
+    free(job);
+    free(gram);
+
+    // the linear model is only a guide: polish the choice on the exact loss
+    double sq, worst;
+    err = exact_cost(el, n, Rs, RL, freq, count, target, parts, nparts, choice, &sq, &worst);
+    for (int pass = 0, improved = 1; pass < SNAP_POLISH_PASSES && improved && err == AFC_OK; pass++) {
+        improved = 0;
+        for (int k = 0; k < nparts; k++) {
+            unsigned char keep = choice[k];
+            for (int j = 0; j < parts[k].ncand; j++) {
+                double tsq, tworst;
+                if (j == keep)
+                    continue;
+                choice[k] = (unsigned char)j;
+                if (exact_cost(el, n, Rs, RL, freq, count, target, parts, nparts, choice, &tsq, &tworst) == AFC_OK &&
+                    tsq < sq) {
+                    sq = tsq;
+                    worst = tworst;
+                    keep = (unsigned char)j;
+                    improved = 1;
+                }
+            }
+            choice[k] = keep;
+        }
+    }
+    if (err != AFC_OK)
+        return err;
+    res->rms_dB = sqrt(sq / count);
+    res->max_dB = worst;
+
+    // plain rounding for comparison: the closest single part each time
+    unsigned char nearest[SNAP_MAX_PARTS];
+    for (int k = 0; k < nparts; k++) {
+        nearest[k] = 0;
+        for (int j = 0; j < parts[k].ncand; j++)
+            if (parts[k].cand[j].combo == AFC_COMBO_SINGLE) {
+                nearest[k] = (unsigned char)j;
+                break;
+            }
+    }
+    if ((err = exact_cost(el, n, Rs, RL, freq, count, target, parts, nparts, nearest, &sq, &worst)) != AFC_OK)
+        return err;
+    res->nearest_rms_dB = sqrt(sq / count);
+    res->nearest_max_dB = worst;
+
+    apply_choice(el, n, parts, nparts, choice, out);
+    for (int e = 0; e < n; e++)
+        memset(&parts_out[e], 0, sizeof parts_out[e]);
+    for (int k = 0; k < nparts; k++) {
+        afc_snap_element *pe = &parts_out[parts[k].element];
+        if (parts[k].isL)
+            pe->L = parts[k].cand[choice[k]];
+        else
+            pe->C = parts[k].cand[choice[k]];
+    }
+    return AFC_OK;
+}
@@ -0,0 +1,49 @@
+/*
+ * Analog Filter Calculator - standard-value snapping
+ * Replaces every ideal L and C of a ladder by E-series parts (optionally
+ * series/parallel pairs), choosing the combination whose insertion loss
+ * stays closest to the ideal design over a frequency grid.
+ *
+ * The choice is a branch-and-bound search over the few nearest realizations
+ * of each part, scored with a linear model of the response built from the
+ * element sensitivities, then polished against the exact response.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_SNAP_H
+#define AFC_SNAP_H
+
+#include "afc.h"
+#include "afc_eseries.h"
+
+#define AFC_SNAP_MAX_POINTS 256
+
+typedef struct {
+    afc_eseries series;
+    int pairs;             // also try two-part series/parallel combinations
+    int threads;           // 0 = all cores
+    long max_nodes;        // search budget, 0 for the default
+} afc_snap_config;
+
+// Standard parts of one ladder element; value 0 where it has no C or no L
+typedef struct {
+    afc_part C, L;
+} afc_snap_element;
+
+typedef struct {
+    double rms_dB, max_dB;                 // loss deviation of the snapped ladder
+    double nearest_rms_dB, nearest_max_dB; // same for rounding each part to the nearest value
+    long nodes;                            // search nodes visited
+    int complete;                          // 0 if max_nodes cut the search short
+} afc_snap_result;
+
+// Snap the n-element ladder el (between Rs and RL) to standard values,
+// scoring the insertion loss at the count frequencies freq against the
+// ideal one. out receives the realized ladder, parts the bill of materials.
+int afc_snap(const afc_element *el, int n, double Rs, double RL,
+             const double *freq, int count, const afc_snap_config *cfg,
+             afc_element *out, afc_snap_element *parts, afc_snap_result *res);
+
+#endif
@@ -0,0 +1,195 @@
+/*
+ * Analog Filter Calculator - text spec records
+ * Parses one design spec from a CSV or JSON Lines record into an afc_spec.
+ * Shared by the non-interactive front-ends.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+#include "afc_input.h"
+#include "afc_spec.h"
+#include "afc_stats.h"
+
+// Parse a number field; an empty field yields the default value.
+int afc_parse_number(const char *s, double def, double *out) {
+    while (isspace((unsigned char)*s))
+        s++;
+    if (*s == '\0') {
+        *out = def;
+        return 1;
+    }
+    return afc_parse_double(s, NULL, out, NULL) == NULL;
+}
+
+// Trim leading and trailing whitespace in place.
+char *afc_trim(char *s) {
+    while (isspace((unsigned char)*s))
+        s++;
+    char *e = s + strlen(s);
+    while (e > s && isspace((unsigned char)e[-1]))
+        *--e = '\0';
+    return s;
+}
+
+// Checked before the conversion: (int) of a value out of range is undefined.
+static const char *order_field(double order, int *out) {
+    if (!isfinite(order) || order != floor(order))
+        return "invalid order";
+    if (order < 1 || order > AFC_MAX_ORDER)
+        return afc_strerror(AFC_ERR_ORDER);
+    *out = (int)order;
+    return NULL;
+}
+
+static const char *spec_from_csv(char *line, afc_spec *spec) {
+    char *field[10] = {0};
+    int nf = 0;
+    char *p = line;
+    while (nf < 10) {
+        field[nf++] = p;
+        char *comma = strchr(p, ',');
+        if (!comma)
+            break;
+        *comma = '\0';
+        p = comma + 1;
+    }
+    for (int i = 0; i < 10; i++)
+        field[i] = field[i] ? afc_trim(field[i]) : "";
+    if (nf < 5)
+        return "too few fields";
+
+    const char *err;
+    double order;
+    int norm;
+    spec->family = afc_family_from_name(field[0]);
+    spec->type = afc_type_from_name(field[1]);
+    spec->topology = afc_topology_from_name(field[6][0] ? field[6] : "pi");
+    if (!spec->family)
+        return "unknown family";
+    if (!spec->type)
+        return "unknown filter type";
+    if (!spec->topology)
+        return "unknown topology";
+    if (!afc_parse_number(field[2], 0, &order))
+        return "invalid order";
+    if ((err = order_field(order, &spec->order)))
+        return err;
+    if (!afc_parse_number(field[3], 0, &spec->ripple_dB))
+        return "invalid ripple";
+    if (!afc_parse_number(field[4], 0, &spec->freq))
+        return "invalid frequency";
+    if (!afc_parse_number(field[5], 0, &spec->bw))
+        return "invalid bandwidth";
+    if (!afc_parse_number(field[7], 50.0, &spec->R))
+        return "invalid impedance";
+    if ((norm = afc_norm_from_name(field[8][0] ? field[8] : "3db")) < 0)
+        return "unknown normalization";
+    spec->norm = norm;
+    if (!afc_parse_number(field[9], 0, &spec->stop_dB))
+        return "invalid stop-band loss";
+    return NULL;
+}
+
+// Minimal flat-object JSON reader: finds "key": value and copies the value
+// (string contents or bare number) into val.
+int afc_json_get(const char *line, const char *key, char *val, size_t size) {
+    size_t klen = strlen(key);
+    const char *p = line;
+    while ((p = strchr(p, '"')) != NULL) {
+        p++;
+        if (strncmp(p, key, klen) == 0 && p[klen] == '"') {
+            p += klen + 1;
+            while (isspace((unsigned char)*p))
+                p++;
+            if (*p != ':')
+                continue;
+            p++;
+            while (isspace((unsigned char)*p))
+                p++;
+            size_t n = 0;
+            if (*p == '"') {
+                p++;
+                while (*p && *p != '"' && n + 1 < size)
+                    val[n++] = *p++;
+            } else {
+                while (*p && *p != ',' && *p != '}' && !isspace((unsigned char)*p) && n + 1 < size)
+                    val[n++] = *p++;
+            }
+            val[n] = '\0';
+            return 1;
+        }
+        // skip the rest of this string token
+        while (*p && *p != '"')
+            p++;
+        if (*p)
+            p++;
+    }
+    return 0;
+}
+
+static const char *spec_from_jsonl(const char *line, afc_spec *spec) {
+    char v[64];
+    const char *err;
+    double order;
+    int norm;
+
+    if (!afc_json_get(line, "family", v, sizeof v) || !(spec->family = afc_family_from_name(v)))
+        return "unknown family";
+    if (!afc_json_get(line, "type", v, sizeof v) || !(spec->type = afc_type_from_name(v)))
+        return "unknown filter type";
+    if (!afc_json_get(line, "topology", v, sizeof v))
+        strcpy(v, "pi");
+    if (!(spec->topology = afc_topology_from_name(v)))
+        return "unknown topology";
+    if (!afc_json_get(line, "order", v, sizeof v) || !afc_parse_number(v, 0, &order))
+        return "invalid order";
+    if ((err = order_field(order, &spec->order)))
+        return err;
+    if (!afc_json_get(line, "ripple", v, sizeof v))
+        v[0] = '\0';
+    if (!afc_parse_number(v, 0, &spec->ripple_dB))
+        return "invalid ripple";
+    if (!afc_json_get(line, "freq", v, sizeof v) && !afc_json_get(line, "cutoff", v, sizeof v)
+            && !afc_json_get(line, "center", v, sizeof v))
+        v[0] = '\0';
+    if (!afc_parse_number(v, 0, &spec->freq))
+        return "invalid frequency";
+    if (!afc_json_get(line, "bw", v, sizeof v) && !afc_json_get(line, "bandwidth", v, sizeof v))
+        v[0] = '\0';
+    if (!afc_parse_number(v, 0, &spec->bw))
+        return "invalid bandwidth";
+    if (!afc_json_get(line, "impedance", v, sizeof v))
+        v[0] = '\0';
+    if (!afc_parse_number(v, 50.0, &spec->R))
+        return "invalid impedance";
+    if (!afc_json_get(line, "norm", v, sizeof v))
+        strcpy(v, "3db");
+    if ((norm = afc_norm_from_name(v)) < 0)
+        return "unknown normalization";
+    spec->norm = norm;
+    if (!afc_json_get(line, "stop", v, sizeof v))
+        v[0] = '\0';
+    if (!afc_parse_number(v, 0, &spec->stop_dB))
+        return "invalid stop-band loss";
+    return NULL;
+}
+
+const char *afc_spec_from_csv(char *line, afc_spec *spec) {
+    long t0 = afc_stats_begin();
+    const char *err = spec_from_csv(line, spec);
+    afc_stats_end(AFC_STAGE_PARSE, t0);
+    return err;
+}
+
+const char *afc_spec_from_jsonl(const char *line, afc_spec *spec) {
+    long t0 = afc_stats_begin();
+    const char *err = spec_from_jsonl(line, spec);
+    afc_stats_end(AFC_STAGE_PARSE, t0);
+    return err;
+}
@@ -0,0 +1,45 @@
+/*
+ * Analog Filter Calculator - text spec records
+ *
+ * CSV record:   family,type,order,ripple,freq,bw,topology,impedance[,norm[,stop]]
+ * JSONL record: {"family":"chebyshev","type":"lp","order":5,"ripple":0.1,
+ *                "freq":1e6,"topology":"pi","impedance":50}
+ *
+ * family   butterworth | chebyshev | bessel | elliptic (or cauer)
+ * type     lp | hp | bp | br  (or 1-4 as in the interactive tools)
+ * freq     cutoff frequency for LP/HP, center frequency for BP/BR (Hz)
+ * bw       bandwidth for BP/BR (Hz), ignored for LP/HP
+ * topology pi | tee (or 1/2)
+ * norm     3db (default) | delay (Bessel unit group delay) | ripple
+ *          (Chebyshev and elliptic ripple band edge)
+ * stop     elliptic minimum stop-band loss in dB
+ * Numbers may carry an engineering suffix ("2.4G", "100k", see afc_input.h).
+ * Empty ripple/bw/impedance/stop fields default to 0, 0, 50 ohm and 0.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_SPEC_H
+#define AFC_SPEC_H
+
+#include <stddef.h>
+
+#include "afc.h"
+
+// Parse one record; returns NULL on success or a message describing the
+// first bad field. The CSV parser splits line in place.
+const char *afc_spec_from_csv(char *line, afc_spec *spec);
+const char *afc_spec_from_jsonl(const char *line, afc_spec *spec);
+
+// Parse a number field, engineering suffixes allowed (see afc_input.h); an
+// empty field yields def. Returns 0 if malformed.
+int afc_parse_number(const char *s, double def, double *out);
+
+// Copy the value of "key" in a flat JSON object into val. Returns 0 if absent.
+int afc_json_get(const char *line, const char *key, char *val, size_t size);
+
+// Trim leading and trailing whitespace in place.
+char *afc_trim(char *s);
+
+#endif
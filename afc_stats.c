@@ -0,0 +1,216 @@
+/*
+ * Analog Filter Calculator - pipeline stage statistics
+ * Every thread that records gets a block on first use, linked into a list
+ * of live blocks; a thread-specific key folds it into the retired totals
+ * when the thread exits, so the short-lived workers of afc_parallel_for()
+ * do not pile up.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "afc_stats.h"
+
+#define SUB_COUNT (1L << AFC_STATS_SUB_BITS)
+
+typedef struct recorder {
+    afc_stats stats;
+    struct recorder *prev, *next;
+} recorder;
+
+int afc_stats_enabled;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t key;
+static recorder *live;
+static afc_stats retired;
+static __thread recorder *local;
+
+static const char *const stage_names[AFC_STAGE_COUNT] = {
+    "parse", "prototype", "denorm", "response", "format"
+};
+
+const char *afc_stage_name(afc_stage stage) {
+    return stage >= 0 && stage < AFC_STAGE_COUNT ? stage_names[stage] : "?";
+}
+
+void afc_stats_enable(void) {
+    afc_stats_enabled = 1;
+}
+
+long afc_stats_now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000L + t.tv_nsec;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Histogram                                                              */
+/* ---------------------------------------------------------------------- */
+
+// Values below SUB_COUNT have a bucket each; above, every power of two is
+// split into SUB_COUNT buckets by the bits below the leading one.
+static int bucket_of(long ns) {
+    if (ns < SUB_COUNT)
+        return ns > 0 ? (int)ns : 0;
+    int msb = 63 - __builtin_clzl((unsigned long)ns);
+    if (msb >= AFC_STATS_MAX_BITS)
+        return AFC_STATS_BUCKETS - 1;
+    int shift = msb - AFC_STATS_SUB_BITS;
+    return ((shift + 1) << AFC_STATS_SUB_BITS) + (int)((ns >> shift) - SUB_COUNT);
+}
+
+// Middle of bucket b.
+static long bucket_value(int b) {
+    int shift = (b >> AFC_STATS_SUB_BITS) - 1;
+    if (shift <= 0)
+        return b;
+    long low = ((b & (SUB_COUNT - 1)) + SUB_COUNT) << shift;
+    return low + (1L << (shift - 1));
+}
+
+long afc_stats_quantile(const afc_stage_stats *s, double q) {
+    if (s->count == 0)
+        return 0;
+    long rank = (long)(q * s->count + 0.5), seen = 0;
+    if (rank < 1)
+        rank = 1;
+    for (int b = 0; b < AFC_STATS_BUCKETS; b++)
+        if ((seen += s->hist[b]) >= rank) {
+            long v = bucket_value(b);
+            return v < s->min_ns ? s->min_ns : v > s->max_ns ? s->max_ns : v;
+        }
+    return s->max_ns;
+}
+
+static void merge_stage(afc_stage_stats *d, const afc_stage_stats *s) {
+    if (s->count == 0)
+        return;
+    if (d->count == 0 || s->min_ns < d->min_ns)
+        d->min_ns = s->min_ns;
+    if (s->max_ns > d->max_ns)
+        d->max_ns = s->max_ns;
+    d->count += s->count;
+    d->total_ns += s->total_ns;
+    for (int b = 0; b < AFC_STATS_BUCKETS; b++)
+        d->hist[b] += s->hist[b];
+}
+
+static void merge(afc_stats *d, const afc_stats *s) {
+    for (int i = 0; i < AFC_STAGE_COUNT; i++)
+        merge_stage(&d->stage[i], &s->stage[i]);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Per-thread blocks                                                      */
+/* ---------------------------------------------------------------------- */
+
+static void retire(void *p) {
+    recorder *r = p;
+    pthread_mutex_lock(&lock);
+    merge(&retired, &r->stats);
+    if (r->prev)
+        r->prev->next = r->next;
+    else
+        live = r->next;
+    if (r->next)
+        r->next->prev = r->prev;
+    pthread_mutex_unlock(&lock);
+    free(r);
+}
+
+static void make_key(void) {
+    pthread_key_create(&key, retire);
+}
+
+static recorder *local_block(void) {
+    if (local)
+        return local;
+    pthread_once(&once, make_key);
+    recorder *r = calloc(1, sizeof *r);
+    if (!r)
+        return NULL;
+    pthread_mutex_lock(&lock);
+    r->next = live;
+    if (live)
+        live->prev = r;
+    live = r;
+    pthread_mutex_unlock(&lock);
+    pthread_setspecific(key, r);
+    return local = r;
+}
+
+void afc_stats_record(afc_stage stage, long ns) {
+    recorder *r = local_block();
+    if (!r || stage < 0 || stage >= AFC_STAGE_COUNT)
+        return;
+    afc_stage_stats *s = &r->stats.stage[stage];
+    if (s->count == 0 || ns < s->min_ns)
+        s->min_ns = ns;
+    if (ns > s->max_ns)
+        s->max_ns = ns;
+    s->count++;
+    s->total_ns += ns;
+    s->hist[bucket_of(ns)]++;
+}
+
+void afc_stats_collect(afc_stats *out) {
+    pthread_mutex_lock(&lock);
+    *out = retired;
+    for (recorder *r = live; r; r = r->next)
+        merge(out, &r->stats);
+    pthread_mutex_unlock(&lock);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Reports                                                                */
+/* ---------------------------------------------------------------------- */
+
+static const struct { const char *name; double q; } quantiles[] = {
+    { "p50", 0.5 }, { "p90", 0.9 }, { "p99", 0.99 }, { "p999", 0.999 }
+};
+
+#define QUANTILES (int)(sizeof quantiles / sizeof quantiles[0])
+
+void afc_stats_print(FILE *out, const afc_stats *stats, int json) {
+    if (json) {
+        fprintf(out, "{\"stats\":{");
+        for (int i = 0; i < AFC_STAGE_COUNT; i++) {
+            const afc_stage_stats *s = &stats->stage[i];
+            fprintf(out, "%s\"%s\":{\"count\":%ld,\"total_ns\":%ld,\"mean_ns\":%ld,\"min_ns\":%ld",
+                    i ? "," : "", stage_names[i], s->count, s->total_ns,
+                    s->count ? s->total_ns / s->count : 0, s->min_ns);
+            for (int k = 0; k < QUANTILES; k++)
+                fprintf(out, ",\"%s_ns\":%ld", quantiles[k].name, afc_stats_quantile(s, quantiles[k].q));
+            fprintf(out, ",\"max_ns\":%ld}", s->max_ns);
+        }
+        fprintf(out, "}}\n");
+        return;
+    }
+
+    fprintf(out, "| Stage     |      Count | Total (ms) | Mean (ns) |  p50 (ns) |  p90 (ns) |  p99 (ns) | p99.9 (ns) |  Max (ns) |\n");
+    fprintf(out, "|-----------|------------|------------|-----------|-----------|-----------|-----------|------------|-----------|\n");
+    for (int i = 0; i < AFC_STAGE_COUNT; i++) {
+        const afc_stage_stats *s = &stats->stage[i];
+        fprintf(out, "| %-9s | %10ld | %10.3f | %9ld | %9ld | %9ld | %9ld | %10ld | %9ld |\n",
+                stage_names[i], s->count, s->total_ns * 1e-6, s->count ? s->total_ns / s->count : 0,
+                afc_stats_quantile(s, 0.5), afc_stats_quantile(s, 0.9),
+                afc_stats_quantile(s, 0.99), afc_stats_quantile(s, 0.999), s->max_ns);
+    }
+}
+
+int afc_stats_option(const char *opt) {
+    if (strncmp(opt, "--stats", 7))
+        return 0;
+    if (!strcmp(opt + 7, "") || !strcmp(opt + 7, "=text"))
+        return 1;
+    if (!strcmp(opt + 7, "=json"))
+        return 2;
+    return -1;
+}
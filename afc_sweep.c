@@ -0,0 +1,228 @@
+/*
+ * Analog Filter Calculator - design sweeps and the columnar result file
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <fcntl.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "afc_sweep.h"
+#include "afc_response.h"
+
+#define PASS_POINTS 32
+
+/* ---------------------------------------------------------------------- */
+/* Metrics                                                                */
+/* ---------------------------------------------------------------------- */
+
+// Pass-band points for the group-delay flatness
+static void pass_band(const afc_spec *s, double *f) {
+    double F = s->freq, BW = s->bw;
+    for (int i = 0; i < PASS_POINTS; i++) {
+        double t = (double)i / (PASS_POINTS - 1);
+        switch (s->type) {
+        case AFC_LOWPASS:
+            f[i] = F * (0.01 + 0.99 * t);
+            break;
+        case AFC_HIGHPASS:
+            f[i] = F * pow(10, t);
+            break;
+        case AFC_BANDPASS:
+            f[i] = F + BW * (t - 0.5);
+            break;
+        case AFC_BANDREJECT: {
+            // half below and half above the stop band
+            double lo = fmax(F - 2 * BW, F / 10), t2 = (double)(i % (PASS_POINTS / 2)) / (PASS_POINTS / 2 - 1);
+            f[i] = i < PASS_POINTS / 2 ? lo + (F - BW / 2 - lo) * t2 : F + BW / 2 + 1.5 * BW * t2;
+            break;
+        }
+        }
+    }
+}
+
+int afc_design_metrics(const afc_spec *spec, const afc_element *el, int n, double offset, afc_metrics *m) {
+    double Rs = spec->R, RL = afc_load_impedance(spec);
+    double f[PASS_POINTS], gd[PASS_POINTS], stop[2], il[2];
+    int nstop = 1, err;
+
+    pass_band(spec, f);
+    if ((err = afc_ladder_response(el, n, Rs, RL, f, PASS_POINTS, &(afc_response){ .gd = gd })) != AFC_OK)
+        return err;
+    double lo = gd[0], hi = gd[0];
+    for (int i = 1; i < PASS_POINTS; i++) {
+        lo = fmin(lo, gd[i]);
+        hi = fmax(hi, gd[i]);
+    }
+    m->gd_ripple = lo > 0 ? (hi - lo) / lo : INFINITY;
+
+    switch (spec->type) {
+    case AFC_LOWPASS:    stop[0] = spec->freq * offset; break;
+    case AFC_HIGHPASS:   stop[0] = spec->freq / offset; break;
+    case AFC_BANDREJECT: stop[0] = spec->freq; break;
+    case AFC_BANDPASS:
+        stop[0] = spec->freq - offset * spec->bw / 2;
+        stop[1] = spec->freq + offset * spec->bw / 2;
+        nstop = stop[0] > 0 ? 2 : 1;
+        if (nstop == 1)
+            stop[0] = stop[1];
+        break;
+    }
+    if ((err = afc_ladder_response(el, n, Rs, RL, stop, nstop, &(afc_response){ .il_dB = il })) != AFC_OK)
+        return err;
+    m->rejection_dB = nstop == 2 ? fmin(il[0], il[1]) : il[0];
+
+    m->total_L = 0;
+    for (int i = 0; i < n; i++)
+        m->total_L += el[i].L;
+    return AFC_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* File                                                                   */
+/* ---------------------------------------------------------------------- */
+
+static size_t align_up(size_t x) {
+    return (x + AFC_SWEEP_ALIGN - 1) / AFC_SWEEP_ALIGN * AFC_SWEEP_ALIGN;
+}
+
+static size_t type_size(uint32_t type) {
+    return type == AFC_COL_I32 ? 4 : type == AFC_COL_F64 ? 8 : 0;
+}
+
+int afc_sweep_create(const char *path, const afc_sweep_layout *layout, int ncolumns,
+                     uint64_t rows, afc_sweep_file *f) {
+    size_t size = align_up(sizeof(afc_sweep_header) + ncolumns * sizeof(afc_sweep_column));
+    afc_sweep_column dir[ncolumns > 0 ? ncolumns : 1];
+
+    memset(f, 0, sizeof *f);
+    f->fd = -1;
+    for (int c = 0; c < ncolumns; c++) {
+        if (!type_size(layout[c].type) || layout[c].width < 1 || strlen(layout[c].name) >= sizeof dir[c].name)
+            return AFC_ERR_ARGUMENT;
+        memset(&dir[c], 0, sizeof dir[c]);
+        strcpy(dir[c].name, layout[c].name);
+        dir[c].type = layout[c].type;
+        dir[c].width = layout[c].width;
+        dir[c].offset = size;
+        // the file must fit both size_t and off_t, and align_up() adds up
+        // to AFC_SWEEP_ALIGN - 1
+        size_t bytes;
+        if (__builtin_mul_overflow(type_size(layout[c].type), layout[c].width, &bytes) ||
+            __builtin_mul_overflow(bytes, rows, &bytes) ||
+            __builtin_add_overflow(size, bytes, &size) || size > PTRDIFF_MAX - AFC_SWEEP_ALIGN)
+            return AFC_ERR_ARGUMENT;
+        size = align_up(size);
+    }
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return AFC_ERR_IO;
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close(fd);
+        return AFC_ERR_IO;
+    }
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        return AFC_ERR_IO;
+    }
+
+    afc_sweep_header *h = map;
+    memcpy(h->magic, AFC_SWEEP_MAGIC, sizeof h->magic);
+    h->version = 1;
+    h->ncolumns = (uint32_t)ncolumns;
+    h->rows = rows;
+    memcpy(h + 1, dir, ncolumns * sizeof *dir);
+
+    f->fd = fd;
+    f->writable = 1;
+    f->map = map;
+    f->size = size;
+    f->rows = rows;
+    f->ncolumns = ncolumns;
+    f->columns = (afc_sweep_column *)(h + 1);
+    return AFC_OK;
+}
+
+int afc_sweep_open(const char *path, afc_sweep_file *f) {
+    struct stat st;
+    int err = AFC_ERR_IO;
+
+    memset(f, 0, sizeof *f);
+    f->fd = open(path, O_RDONLY);
+    if (f->fd < 0)
+        return AFC_ERR_IO;
+    if (fstat(f->fd, &st) != 0)
+        goto fail;
+    err = AFC_ERR_FORMAT;
+    if ((size_t)st.st_size < sizeof(afc_sweep_header))
+        goto fail;
+    f->size = (size_t)st.st_size;
+    f->map = mmap(NULL, f->size, PROT_READ, MAP_SHARED, f->fd, 0);
+    if (f->map == MAP_FAILED) {
+        f->map = NULL;
+        err = AFC_ERR_IO;
+        goto fail;
+    }
+
+    // check the directory against the file before anyone indexes it; the
+    // sizes come from the file, so every product is checked for overflow
+    const afc_sweep_header *h = f->map;
+    size_t dir, bytes;
+    int ok = !memcmp(h->magic, AFC_SWEEP_MAGIC, sizeof h->magic) && h->version == 1 &&
+             !__builtin_mul_overflow(h->ncolumns, sizeof(afc_sweep_column), &dir) &&
+             dir <= f->size - sizeof *h && h->ncolumns <= INT_MAX;
+    f->rows = h->rows;
+    f->ncolumns = ok ? (int)h->ncolumns : 0;
+    f->columns = (afc_sweep_column *)(h + 1);
+    for (int c = 0; ok && c < f->ncolumns; c++) {
+        const afc_sweep_column *col = &f->columns[c];
+        ok = type_size(col->type) && col->offset % AFC_SWEEP_ALIGN == 0 && col->offset <= f->size &&
+             !__builtin_mul_overflow(type_size(col->type), col->width, &bytes) &&
+             !__builtin_mul_overflow(bytes, f->rows, &bytes) &&
+             bytes <= f->size - col->offset && memchr(col->name, '\0', sizeof col->name);
+    }
+    if (ok)
+        return AFC_OK;
+
+fail:
+    if (f->map)
+        munmap(f->map, f->size);
+    close(f->fd);
+    memset(f, 0, sizeof *f);
+    f->fd = -1;
+    return err;
+}
+
+const afc_sweep_column *afc_sweep_find(const afc_sweep_file *f, const char *name) {
+    for (int c = 0; c < f->ncolumns; c++)
+        if (!strcmp(f->columns[c].name, name))
+            return &f->columns[c];
+    return NULL;
+}
+
+void *afc_sweep_data(const afc_sweep_file *f, const afc_sweep_column *c) {
+    return (char *)f->map + c->offset;
+}
+
+int afc_sweep_close(afc_sweep_file *f) {
+    int err = AFC_OK;
+    if (f->map) {
+        if (f->writable && msync(f->map, f->size, MS_SYNC) != 0)
+            err = AFC_ERR_IO;
+        munmap(f->map, f->size);
+    }
+    if (f->fd >= 0)
+        close(f->fd);
+    f->map = NULL;
+    f->fd = -1;
+    return err;
+}
@@ -0,0 +1,97 @@
+/*
+ * Analog Filter Calculator - design sweeps and the columnar result file
+ *
+ * A sweep file is a header, a column directory and then one contiguous,
+ * 64-byte aligned array per column, in native byte order:
+ *
+ *   afc_sweep_header            magic "AFCSWP01", column count, row count
+ *   afc_sweep_column[ncolumns]  name, type, values per row, file offset
+ *   column data                 rows * width values each
+ *
+ * Readers map the file and index the arrays in place; nothing is parsed.
+ * Per-element columns (g, C, L) have width = the largest order of the
+ * sweep, with zeros past each design's own order.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_SWEEP_H
+#define AFC_SWEEP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "afc.h"
+
+#define AFC_SWEEP_MAGIC   "AFCSWP01"
+#define AFC_SWEEP_ALIGN   64
+
+typedef enum {
+    AFC_COL_I32 = 1,
+    AFC_COL_F64 = 2
+} afc_col_type;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;      // 1
+    uint32_t ncolumns;
+    uint64_t rows;
+    uint64_t reserved;
+} afc_sweep_header;
+
+typedef struct {
+    char name[24];
+    uint32_t type;         // afc_col_type
+    uint32_t width;        // values per row
+    uint64_t offset;       // from the start of the file
+} afc_sweep_column;
+
+// Figures of merit of one design, as stored in a sweep
+typedef struct {
+    double rejection_dB;   // loss at the offset frequency (worse side for BP)
+    double gd_ripple;      // (max - min) / min group delay over the pass band
+    double total_L;        // sum of all inductances in H
+} afc_metrics;
+
+// Evaluate the metrics of a designed ladder. offset is the stop-band point
+// as a ratio: offset * f for LP, f / offset for HP, f +- offset * bw / 2 for
+// BP; BR reports the loss at the center frequency.
+int afc_design_metrics(const afc_spec *spec, const afc_element *el, int n, double offset, afc_metrics *m);
+
+/* ---------------------------------------------------------------------- */
+/* Writing                                                                */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    const char *name;
+    afc_col_type type;
+    uint32_t width;
+} afc_sweep_layout;
+
+typedef struct {
+    int fd;
+    int writable;
+    void *map;
+    size_t size;
+    uint64_t rows;
+    int ncolumns;
+    afc_sweep_column *columns;
+} afc_sweep_file;
+
+// Create path sized for rows rows of the given columns and map it for
+// writing; column arrays are filled in place through afc_sweep_data().
+int afc_sweep_create(const char *path, const afc_sweep_layout *layout, int ncolumns,
+                     uint64_t rows, afc_sweep_file *f);
+
+// Map an existing sweep file read-only.
+int afc_sweep_open(const char *path, afc_sweep_file *f);
+
+// Column by name (NULL if absent) and a pointer to its first value.
+const afc_sweep_column *afc_sweep_find(const afc_sweep_file *f, const char *name);
+void *afc_sweep_data(const afc_sweep_file *f, const afc_sweep_column *c);
+
+// Flush (if writable) and unmap.
+int afc_sweep_close(afc_sweep_file *f);
+
+#endif
@@ -0,0 +1,335 @@
+/*
+ * Analog Filter Calculator - element table output
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <strings.h>
+
+#include "afc_table.h"
+#include "afc_response.h"
+#include "afc_stats.h"
+
+afc_out_format afc_out_format_from_name(const char *s) {
+    if (!strcasecmp(s, "md") || !strcasecmp(s, "markdown")) return AFC_OUT_MARKDOWN;
+    if (!strcasecmp(s, "csv"))                               return AFC_OUT_CSV;
+    if (!strcasecmp(s, "json") || !strcasecmp(s, "jsonl"))   return AFC_OUT_JSON;
+    if (!strcasecmp(s, "spice"))                             return AFC_OUT_SPICE;
+    return 0;
+}
+
+static const char *component_name(afc_form form) {
+    switch (form) {
+    case AFC_FORM_C:           return "C";
+    case AFC_FORM_L:           return "L";
+    case AFC_FORM_SERIES_LC:   return "SLC";
+    case AFC_FORM_PARALLEL_LC: return "PLC";
+    }
+    return "?";
+}
+
+/* ---------------------------------------------------------------------- */
+/* Markdown                                                               */
+/* ---------------------------------------------------------------------- */
+
+void afc_write_table_header(afc_writer *w, afc_type type) {
+    if (type == AFC_LOWPASS || type == AFC_HIGHPASS) {
+        afc_write_str(w, "| Element | Coefficient | Capacitance (nF) | Inductance (uH) | Sensitivity (dB/%) |\n");
+        afc_write_str(w, "|---------|-------------|------------------|-----------------|--------------------|\n");
+    } else if (type == AFC_BANDPASS || type == AFC_BANDREJECT) {
+        afc_write_str(w, "| Element | Coefficient | Capacitance (nF) | Inductance (uH) | Resonator   | Sensitivity (dB/%) |\n");
+        afc_write_str(w, "|---------|-------------|------------------|-----------------|-------------|--------------------|\n");
+    }
+}
+
+void afc_write_table_rows(afc_writer *w, afc_type type, const afc_element *el, int n,
+                          const double *sens) {
+    for (int i = 0; i < n; i++) {
+        const afc_element *e = &el[i];
+        if (type == AFC_BANDPASS || type == AFC_BANDREJECT) {
+            afc_write_str(w, "|   ");
+            afc_write_int(w, i + 1, 2);
+            afc_write_str(w, "     | ");
+        } else {
+            // elliptic tanks are resonators in LP/HP ladders too
+            afc_write_str(w, e->form == AFC_FORM_C ? "|   C" : e->form == AFC_FORM_L ? "|   L" : "|  LC");
+            afc_write_int(w, i + 1, -5);
+            afc_write_str(w, "| ");
+        }
+        afc_write_fixed(w, e->g, 4, 11);
+        afc_write_str(w, " | ");
+        if (e->form == AFC_FORM_L)
+            afc_write_pad(w, "-", 16);
+        else
+            afc_write_fixed(w, e->C * 1e9, 4, 16);
+        afc_write_str(w, " | ");
+        if (e->form == AFC_FORM_C)
+            afc_write_pad(w, "-", 15);
+        else
+            afc_write_fixed(w, e->L * 1e6, 4, 15);
+        if (type == AFC_BANDPASS || type == AFC_BANDREJECT) {
+            afc_write_str(w, " | ");
+            afc_write_pad(w, e->form == AFC_FORM_SERIES_LC ? "series LC" : "parallel LC", -11);
+        }
+        afc_write_str(w, " | ");
+        if (sens)
+            afc_write_fixed(w, sens[i], 4, 18);
+        else
+            afc_write_pad(w, "-", 18);
+        afc_write_str(w, " |\n");
+    }
+}
+
+void afc_print_table_header(afc_type type) {
+    afc_writer w;
+    afc_writer_init(&w, stdout);
+    if (type == AFC_LOWPASS || type == AFC_HIGHPASS)
+        afc_write_str(&w, "\n");
+    else if (type == AFC_BANDPASS)
+        afc_write_str(&w, "\nBand-pass filter selected\n");
+    else if (type == AFC_BANDREJECT)
+        afc_write_str(&w, "\nBand-reject filter selected\n");
+    afc_write_table_header(&w, type);
+    afc_writer_free(&w);
+}
+
+void afc_print_table_rows(const afc_spec *spec, const afc_element *el, int n) {
+    double sens[AFC_MAX_ORDER];
+    afc_writer w;
+    long t0 = afc_stats_begin();
+    afc_writer_init(&w, stdout);
+    int ok = afc_pass_band_sensitivity(spec, el, n, sens) == AFC_OK;
+    afc_write_table_rows(&w, spec->type, el, n, ok ? sens : NULL);
+    afc_writer_free(&w);
+    afc_stats_end(AFC_STAGE_FORMAT, t0);
+}
+
+/* ---------------------------------------------------------------------- */
+/* SPICE                                                                  */
+/* ---------------------------------------------------------------------- */
+
+static void write_node(afc_writer *w, int node) {
+    afc_write_char(w, ' ');
+    if (node < 0) {
+        afc_write_char(w, 'm');
+        afc_write_int(w, -node, 0);
+    } else {
+        afc_write_int(w, node, 0);
+    }
+}
+
+// One component line, e.g. "L2 1 m2 1.591549u". Nodes below 0 are the inner
+// node m<-node>.
+static void write_part(afc_writer *w, char kind, int index, int a, int b, double value) {
+    afc_write_char(w, kind);
+    afc_write_int(w, index, 0);
+    write_node(w, a);
+    write_node(w, b);
+    afc_write_char(w, ' ');
+    afc_write_spice_value(w, value);
+    afc_write_char(w, '\n');
+}
+
+void afc_write_spice(afc_writer *w, const char *name, const afc_spec *spec,
+                     const afc_element *el, int n) {
+    int last = 1;
+    for (int i = 0; i < n; i++)
+        last += el[i].branch == AFC_SERIES;
+
+    afc_write_str(w, "* ");
+    afc_write_str(w, afc_family_name(spec->family));
+    afc_write_char(w, ' ');
+    afc_write_str(w, afc_type_name(spec->type));
+    afc_write_str(w, ", order ");
+    afc_write_int(w, spec->order, 0);
+    afc_write_str(w, ", ");
+    afc_write_str(w, afc_topology_name(spec->topology));
+    afc_write_str(w, ", source ");
+    afc_write_fixed(w, spec->R, 4, 0);
+    afc_write_str(w, " ohm, load ");
+    afc_write_fixed(w, afc_load_impedance(spec), 4, 0);
+    afc_write_str(w, " ohm\n.SUBCKT ");
+    afc_write_str(w, name);
+    write_node(w, 1);
+    write_node(w, last);
+    afc_write_char(w, '\n');
+
+    int node = 1;
+    for (int i = 0; i < n; i++) {
+        const afc_element *e = &el[i];
+        int k = i + 1;
+        int a = node, b = e->branch == AFC_SERIES ? node + 1 : 0;
+        switch (e->form) {
+        case AFC_FORM_C:
+            write_part(w, 'C', k, a, b, e->C);
+            break;
+        case AFC_FORM_L:
+            write_part(w, 'L', k, a, b, e->L);
+            break;
+        case AFC_FORM_SERIES_LC:
+            write_part(w, 'L', k, a, -k, e->L);
+            write_part(w, 'C', k, -k, b, e->C);
+            break;
+        case AFC_FORM_PARALLEL_LC:
+            write_part(w, 'L', k, a, b, e->L);
+            write_part(w, 'C', k, a, b, e->C);
+            break;
+        }
+        if (e->branch == AFC_SERIES)
+            node++;
+    }
+    afc_write_str(w, ".ENDS ");
+    afc_write_str(w, name);
+    afc_write_char(w, '\n');
+}
+
+/* ---------------------------------------------------------------------- */
+/* Per-design output                                                      */
+/* ---------------------------------------------------------------------- */
+
+void afc_write_preamble(afc_writer *w, afc_out_format fmt) {
+    if (fmt == AFC_OUT_CSV)
+        afc_write_str(w, "design,element,component,g,capacitance_F,inductance_H\n");
+}
+
+void afc_write_error(afc_writer *w, afc_out_format fmt, long index, const char *msg) {
+    switch (fmt) {
+    case AFC_OUT_JSON:
+        afc_write_str(w, "{\"design\":");
+        afc_write_int(w, index, 0);
+        afc_write_str(w, ",\"error\":\"");
+        afc_write_str(w, msg);
+        afc_write_str(w, "\"}\n");
+        break;
+    case AFC_OUT_MARKDOWN:
+        afc_write_str(w, "\n### Design ");
+        afc_write_int(w, index, 0);
+        afc_write_str(w, "\n\nError: ");
+        afc_write_str(w, msg);
+        afc_write_char(w, '\n');
+        break;
+    default:
+        afc_write_str(w, fmt == AFC_OUT_SPICE ? "* design " : "# design ");
+        afc_write_int(w, index, 0);
+        afc_write_str(w, ": error: ");
+        afc_write_str(w, msg);
+        afc_write_char(w, '\n');
+        break;
+    }
+}
+
+static void write_csv(afc_writer *w, long index, const afc_element *el, int n) {
+    for (int i = 0; i < n; i++) {
+        const afc_element *e = &el[i];
+        afc_write_int(w, index, 0);
+        afc_write_char(w, ',');
+        afc_write_int(w, i + 1, 0);
+        afc_write_char(w, ',');
+        afc_write_str(w, component_name(e->form));
+        afc_write_char(w, ',');
+        afc_write_fixed(w, e->g, 4, 0);
+        afc_write_char(w, ',');
+        if (e->form != AFC_FORM_L)
+            afc_write_exp(w, e->C, 9, 0);
+        afc_write_char(w, ',');
+        if (e->form != AFC_FORM_C)
+            afc_write_exp(w, e->L, 9, 0);
+        afc_write_char(w, '\n');
+    }
+}
+
+static void write_json(afc_writer *w, long index, const afc_element *el, int n, double load) {
+    afc_write_str(w, "{\"design\":");
+    afc_write_int(w, index, 0);
+    afc_write_str(w, ",\"elements\":[");
+    for (int i = 0; i < n; i++) {
+        const afc_element *e = &el[i];
+        afc_write_str(w, i ? ",{\"element\":" : "{\"element\":");
+        afc_write_int(w, i + 1, 0);
+        afc_write_str(w, ",\"component\":\"");
+        afc_write_str(w, component_name(e->form));
+        afc_write_str(w, "\",\"g\":");
+        afc_write_fixed(w, e->g, 4, 0);
+        if (e->form != AFC_FORM_L) {
+            afc_write_str(w, ",\"capacitance_F\":");
+            afc_write_exp(w, e->C, 9, 0);
+        }
+        if (e->form != AFC_FORM_C) {
+            afc_write_str(w, ",\"inductance_H\":");
+            afc_write_exp(w, e->L, 9, 0);
+        }
+        afc_write_char(w, '}');
+    }
+    afc_write_str(w, "],\"load_ohm\":");
+    afc_write_fixed(w, load, 4, 0);
+    afc_write_str(w, "}\n");
+}
+
+static void write_markdown(afc_writer *w, long index, const afc_spec *s, const afc_element *el,
+                           int n, double load) {
+    afc_write_str(w, "\n### Design ");
+    afc_write_int(w, index, 0);
+    afc_write_str(w, ": ");
+    afc_write_str(w, afc_family_name(s->family));
+    afc_write_char(w, ' ');
+    afc_write_str(w, afc_type_name(s->type));
+    afc_write_str(w, ", order ");
+    afc_write_int(w, s->order, 0);
+    afc_write_str(w, ", ");
+    afc_write_str(w, afc_topology_name(s->topology));
+    afc_write_str(w, ", ");
+    afc_write_fixed(w, s->freq, 0, 0);
+    afc_write_str(w, " Hz");
+    if (s->type == AFC_BANDPASS || s->type == AFC_BANDREJECT) {
+        afc_write_str(w, ", bw ");
+        afc_write_fixed(w, s->bw, 0, 0);
+        afc_write_str(w, " Hz");
+    }
+    afc_write_str(w, ", ");
+    afc_write_fixed(w, s->R, 4, 0);
+    afc_write_str(w, " ohm\n\n");
+    double sens[AFC_MAX_ORDER];
+    int ok = afc_pass_band_sensitivity(s, el, n, sens) == AFC_OK;
+    afc_write_table_header(w, s->type);
+    afc_write_table_rows(w, s->type, el, n, ok ? sens : NULL);
+    if (fabs(load - s->R) > 1e-9 * s->R) {
+        afc_write_str(w, "\nLoad impedance: ");
+        afc_write_fixed(w, load, 4, 0);
+        afc_write_str(w, " ohm\n");
+    }
+}
+
+void afc_write_design(afc_writer *w, afc_out_format fmt, long index, const afc_spec *spec,
+                      const afc_element *el, int n) {
+    long t0 = afc_stats_begin();
+    // even-order Chebyshev ladders need an unequal load termination
+    double load = afc_load_impedance(spec);
+    char name[32];
+
+    switch (fmt) {
+    case AFC_OUT_MARKDOWN:
+        write_markdown(w, index, spec, el, n, load);
+        break;
+    case AFC_OUT_CSV:
+        write_csv(w, index, el, n);
+        if (fabs(load - spec->R) > 1e-9 * spec->R) {
+            afc_write_str(w, "# design ");
+            afc_write_int(w, index, 0);
+            afc_write_str(w, ": load impedance ");
+            afc_write_fixed(w, load, 4, 0);
+            afc_write_str(w, " ohm\n");
+        }
+        break;
+    case AFC_OUT_JSON:
+        write_json(w, index, el, n, load);
+        break;
+    case AFC_OUT_SPICE:
+        snprintf(name, sizeof name, "AFC%ld", index);
+        afc_write_spice(w, name, spec, el, n);
+        break;
+    }
+    afc_stats_end(AFC_STAGE_FORMAT, t0);
+}
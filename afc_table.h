@@ -0,0 +1,68 @@
+/*
+ * Analog Filter Calculator - element table output
+ * The markdown table of the interactive *_with_table calculators and the
+ * per-design output formats of the batch tools, all written through an
+ * afc_writer:
+ *
+ *   markdown  a heading and the element table per design
+ *   csv       design,element,component,g,capacitance_F,inductance_H
+ *   json      one object per design and line (JSON Lines)
+ *
+ * CSV and JSON give C and L in farad and henry with ten significant digits,
+ * so RF values keep their precision; only the markdown table rounds to
+ * fixed nF / uH.
+ *   spice     a .SUBCKT per design, ports (in out) and ground node 0
+ *
+ * In the SPICE netlist the ladder nodes are numbered 1, 2, ... from the
+ * input, each series branch stepping to the next node; series LC arms get
+ * an inner node m<element>. A design without series branches has both
+ * ports on node 1.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_TABLE_H
+#define AFC_TABLE_H
+
+#include "afc.h"
+#include "afc_writer.h"
+
+typedef enum {
+    AFC_OUT_MARKDOWN = 1,
+    AFC_OUT_CSV      = 2,
+    AFC_OUT_JSON     = 3,
+    AFC_OUT_SPICE    = 4
+} afc_out_format;
+
+// md | csv | json (or jsonl) | spice; 0 if unknown.
+afc_out_format afc_out_format_from_name(const char *s);
+
+// Print the column header for the filter type.
+void afc_print_table_header(afc_type type);
+
+// Print one row per element (values in nF / uH) of a design for spec, with
+// the element's worst pass-band loss change per 1 % (see
+// afc_pass_band_sensitivity()).
+void afc_print_table_rows(const afc_spec *spec, const afc_element *el, int n);
+
+// The two functions above, into a writer; the header is the column titles
+// and the separator line only. sens[i] fills the sensitivity column of
+// element i ("-" if sens is NULL).
+void afc_write_table_header(afc_writer *w, afc_type type);
+void afc_write_table_rows(afc_writer *w, afc_type type, const afc_element *el, int n,
+                          const double *sens);
+
+// Text that starts the output (the CSV column names; nothing otherwise).
+void afc_write_preamble(afc_writer *w, afc_out_format fmt);
+
+// Design number index and its elements, or the reason it failed.
+void afc_write_design(afc_writer *w, afc_out_format fmt, long index, const afc_spec *spec,
+                      const afc_element *el, int n);
+void afc_write_error(afc_writer *w, afc_out_format fmt, long index, const char *msg);
+
+// One SPICE subcircuit called name.
+void afc_write_spice(afc_writer *w, const char *name, const afc_spec *spec,
+                     const afc_element *el, int n);
+
+#endif
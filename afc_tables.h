@@ -0,0 +1,2552 @@
+/*
+ * Analog Filter Calculator - precomputed prototype tables
+ * Generated by gen_afc_tables.c, do not edit.
+ */
+
+#ifndef AFC_TABLES_H
+#define AFC_TABLES_H
+
+#define AFC_PROTO_TABLE_ORDER 32
+#define AFC_CHEBYSHEV_TABLE_RIPPLES 9
+#define AFC_BESSEL_TABLE_ORDER 32
+
+// Butterworth ladder g-values, g[n-1][0..n] (g(n+1) last)
+static const double afc_butterworth_g[32][33] = {
+    { // order 1
+        2, 1,
+    },
+    { // order 2
+        1.4142135623730949, 1.4142135623730951, 1,
+    },
+    { // order 3
+        0.99999999999999989, 2, 0.99999999999999989, 1,
+    },
+    { // order 4
+        0.76536686473017956, 1.8477590650225735, 1.8477590650225735, 0.76536686473017979,
+        1,
+    },
+    { // order 5
+        0.61803398874989479, 1.6180339887498949, 2, 1.6180339887498949,
+        0.61803398874989501, 1,
+    },
+    { // order 6
+        0.51763809020504148, 1.4142135623730949, 1.9318516525781366, 1.9318516525781366,
+        1.4142135623730951, 0.51763809020504203, 1,
+    },
+    { // order 7
+        0.44504186791262879, 1.246979603717467, 1.8019377358048383, 2,
+        1.8019377358048383, 1.2469796037174679, 0.44504186791262818, 1,
+    },
+    { // order 8
+        0.3901806440322565, 1.1111404660392044, 1.6629392246050905, 1.9615705608064609,
+        1.9615705608064609, 1.6629392246050909, 1.1111404660392044, 0.39018064403225722,
+        1,
+    },
+    { // order 9
+        0.34729635533386066, 0.99999999999999989, 1.532088886237956, 1.8793852415718166,
+        2, 1.8793852415718169, 1.532088886237956, 1.0000000000000007,
+        0.34729635533386055, 1,
+    },
+    { // order 10
+        0.31286893008046174, 0.9079809994790935, 1.4142135623730949, 1.7820130483767356,
+        1.9753766811902755, 1.9753766811902755, 1.7820130483767358, 1.4142135623730951,
+        0.90798099947909372, 0.31286893008046196, 1,
+    },
+    { // order 11
+        0.28462967654657029, 0.83083002600377276, 1.3097214678905702, 1.6825070656623622,
+        1.9189859472289947, 2, 1.9189859472289947, 1.6825070656623629,
+        1.3097214678905704, 0.83083002600377343, 0.28462967654657034, 1,
+    },
+    { // order 12
+        0.26105238444010315, 0.76536686473017956, 1.2175228580174413, 1.5867066805824703,
+        1.8477590650225735, 1.9828897227476208, 1.9828897227476208, 1.8477590650225737,
+        1.5867066805824703, 1.2175228580174418, 0.76536686473017979, 0.26105238444010398,
+        1,
+    },
+    { // order 13
+        0.2410733605106461, 0.70920977408507124, 1.1361294934623116, 1.4970214963422022,
+        1.7709120513064198, 1.941883634852104, 2, 1.9418836348521042,
+        1.7709120513064198, 1.4970214963422026, 1.1361294934623116, 0.70920977408507169,
+        0.24107336051064615, 1,
+    },
+    { // order 14
+        0.22392895220661571, 0.66055812391033419, 1.0640641530306731, 1.4142135623730949,
+        1.6934483984565682, 1.8877666606167349, 1.9874244197864852, 1.9874244197864852,
+        1.8877666606167349, 1.6934483984565685, 1.4142135623730951, 1.0640641530306734,
+        0.66055812391033442, 0.22392895220661596, 1,
+    },
+    { // order 15
+        0.20905692653530691, 0.61803398874989479, 0.99999999999999989, 1.3382612127177165,
+        1.6180339887498949, 1.8270909152852017, 1.9562952014676114, 2,
+        1.9562952014676114, 1.827090915285202, 1.6180339887498949, 1.3382612127177167,
+        0.99999999999999989, 0.61803398874989501, 0.20905692653530658, 1,
+    },
+    { // order 16
+        0.19603428065912121, 0.58056935450892466, 0.94279347365199528, 1.268786568327291,
+        1.546020906725474, 1.7638425286967099, 1.9138806714644179, 1.9903694533443936,
+        1.9903694533443939, 1.9138806714644179, 1.7638425286967101, 1.5460209067254742,
+        1.268786568327291, 0.94279347365199573, 0.58056935450892477, 0.19603428065912165,
+        1,
+    },
+    { // order 17
+        0.18453671892660398, 0.54732598014416567, 0.89147671155307651, 1.2052692727585126,
+        1.4780178344413182, 1.700434271459228, 1.8649444588087116, 1.9659461993678036,
+        2, 1.9659461993678036, 1.8649444588087116, 1.7004342714592287,
+        1.4780178344413182, 1.2052692727585128, 0.89147671155307673, 0.54732598014416611,
+        0.1845367189266037, 1,
+    },
+    { // order 18
+        0.17431148549531633, 0.51763809020504148, 0.84523652348139888, 1.1471528727020921,
+        1.4142135623730949, 1.6383040885779834, 1.8126155740732999, 1.9318516525781364,
+        1.9923893961834911, 1.9923893961834911, 1.9318516525781366, 1.8126155740733001,
+        1.6383040885779834, 1.4142135623730951, 1.1471528727020919, 0.84523652348139899,
+        0.51763809020504115, 0.17431148549531639, 1,
+    },
+    { // order 19
+        0.16515869094466465, 0.4909709742815983, 0.80339084930593885, 1.0938963162448536,
+        1.3545631432514822, 1.5782810187927871, 1.7589475024129781, 1.8916344834012693,
+        1.9727226068054449, 2, 1.9727226068054449, 1.8916344834012695,
+        1.7589475024129781, 1.5782810187927871, 1.3545631432514822, 1.0938963162448545,
+        0.80339084930593885, 0.49097097428159903, 0.16515869094466445, 1,
+    },
+    { // order 20
+        0.15691819145568989, 0.46689072771181078, 0.76536686473017956, 1.0449971294318976,
+        1.2988960966603673, 1.5208119312000616, 1.7052803287081844, 1.8477590650225735,
+        1.9447398407953531, 1.9938346674662559, 1.9938346674662559, 1.9447398407953533,
+        1.8477590650225735, 1.7052803287081846, 1.5208119312000621, 1.2988960966603675,
+        1.0449971294318978, 0.76536686473017979, 0.46689072771181106, 0.15691819145569014,
+        1,
+    },
+    { // order 21
+        0.14946018717284851, 0.44504186791262879, 0.73068204873278997, 0.99999999999999989,
+        1.246979603717467, 1.4661037436596525, 1.6524775486319898, 1.8019377358048383,
+        1.9111456115722816, 1.977661652450257, 2, 1.977661652450257,
+        1.9111456115722814, 1.8019377358048383, 1.6524775486319896, 1.4661037436596529,
+        1.2469796037174672, 1.0000000000000007, 0.73068204873278964, 0.44504186791262901,
+        0.14946018717284934, 1,
+    },
+    { // order 22
+        0.14267836639846468, 0.42513057910595331, 0.69892835919819674, 0.95849797344011367,
+        1.1985553330226937, 1.4142135623730949, 1.6010824818487208, 1.7553579791345111,
+        1.8738994499995234, 1.954293731942319, 1.994904229220507, 1.994904229220507,
+        1.954293731942319, 1.8738994499995234, 1.7553579791345111, 1.6010824818487208,
+        1.4142135623730951, 1.1985553330226941, 0.95849797344011334, 0.69892835919819729,
+        0.4251305791059542, 0.14267836639846485, 1,
+    },
+    { // order 23
+        0.13648482672934195, 0.40691202610526755, 0.66975922434197233, 0.9201300754623043,
+        1.1533606442297342, 1.365106286437308, 1.5514225814088396, 1.7088388090929771,
+        1.8344226030109061, 1.9258345746955985, 1.9813718920726615, 2,
+        1.9813718920726615, 1.9258345746955987, 1.8344226030109061, 1.7088388090929774,
+        1.5514225814088396, 1.3651062864373082, 1.1533606442297344, 0.92013007546230452,
+        0.66975922434197266, 0.40691202610526805, 0.1364848267293417, 1,
+    },
+    { // order 24
+        0.13080625846028612, 0.3901806440322565, 0.64287893060632317, 0.88457738043800249,
+        1.1111404660392044, 1.3186916302001377, 1.5036796149579548, 1.6629392246050902,
+        1.7937454830653767, 1.8938602589902112, 1.9615705608064609, 1.995717846477207,
+        1.995717846477207, 1.9615705608064609, 1.8938602589902114, 1.7937454830653767,
+        1.6629392246050902, 1.5036796149579548, 1.3186916302001379, 1.111140466039205,
+        0.88457738043800338, 0.64287893060632351, 0.39018064403225633, 0.13080625846028623,
+        1,
+    },
+    { // order 25
+        0.12558103905862675, 0.3747626291714492, 0.61803398874989479, 0.85155858313014532,
+        1.0716535899579933, 1.2748479794973793, 1.4579372548428231, 1.6180339887498947,
+        1.7526133600877274, 1.8595529717765027, 1.9371663222572622, 1.9842294026289555,
+        2, 1.9842294026289558, 1.9371663222572622, 1.8595529717765029,
+        1.7526133600877269, 1.6180339887498949, 1.4579372548428229, 1.2748479794973797,
+        1.071653589957994, 0.85155858313014576, 0.61803398874989501, 0.37476262917144915,
+        0.12558103905862716, 1,
+    },
+    { // order 26
+        0.1207569948445721, 0.36051007562781151, 0.59500610771040596, 0.82082561090551354,
+        1.0346756283553136, 1.2334377452570859, 1.4142135623730951, 1.5743669612181002,
+        1.711562544602895, 1.8237996919841801, 1.9094417330170912, 1.967239813894287,
+        1.996351108446635, 1.996351108446635, 1.9672398138942873, 1.9094417330170914,
+        1.8237996919841801, 1.7115625446028955, 1.5743669612181004, 1.4142135623730951,
+        1.2334377452570864, 1.034675628355314, 0.82082561090551354, 0.59500610771040607,
+        0.36051007562781184, 0.12075699484457268, 1,
+    },
+    { // order 27
+        0.11628965782095166, 0.34729635533386066, 0.57360646542218041, 0.79215953207831358,
+        0.99999999999999989, 1.1943171834055724, 1.3724832757374672, 1.5320888862379558,
+        1.6709756228258728, 1.7872652806468243, 1.8793852415718169, 1.9460897411596476,
+        1.986476715483886, 2, 1.986476715483886, 1.9460897411596476,
+        1.8793852415718169, 1.7872652806468246, 1.6709756228258728, 1.532088886237956,
+        1.3724832757374679, 1.1943171834055724, 0.99999999999999989, 0.79215953207831358,
+        0.57360646542218119, 0.34729635533386138, 0.11628965782095146, 1,
+    },
+    { // order 28
+        0.11214089447438358, 0.33501244660947282, 0.55367102284969871, 0.76536686473017956,
+        0.9674377742104795, 1.1573425923596112, 1.3326931559040081, 1.491284329766331,
+        1.6311217379185203, 1.7504468438175074, 1.8477590650225735, 1.921834643890199,
+        1.9717420370364718, 1.9968536300356332, 1.9968536300356332, 1.9717420370364718,
+        1.9218346438901992, 1.8477590650225735, 1.7504468438175074, 1.6311217379185203,
+        1.4912843297663314, 1.3326931559040081, 1.1573425923596117, 0.96743777421047972,
+        0.76536686473017979, 0.55367102284969893, 0.33501244660947305, 0.11214089447438381,
+        1,
+    },
+    { // order 29
+        0.10827781717083505, 0.32356399310552947, 0.53505667705844162, 0.74027631067982869,
+        0.93681688139958019, 1.1223741307247646, 1.2947725695636554, 1.4519909838462615,
+        1.5921861314112875, 1.7137143523351785, 1.815150839341914, 1.8953063423656047,
+        1.9532411114201733, 1.9882759143087192, 2, 1.9882759143087192,
+        1.9532411114201733, 1.8953063423656049, 1.815150839341914, 1.7137143523351788,
+        1.5921861314112877, 1.4519909838462619, 1.2947725695636556, 1.122374130724765,
+        0.93681688139958041, 0.7402763106798288, 0.53505667705844162, 0.32356399310552936,
+        0.10827781717083579, 1,
+    },
+    { // order 30
+        0.10467191248588766, 0.31286893008046174, 0.51763809020504148, 0.71673589909060054,
+        0.9079809994790935, 1.0892780700300539, 1.258640782099675, 1.4142135623730949,
+        1.5542919229139418, 1.6773411358908479, 1.7820130483767356, 1.8671608529944035,
+        1.9318516525781366, 1.9753766811902755, 1.9972590695091477, 1.9972590695091477,
+        1.9753766811902755, 1.9318516525781366, 1.8671608529944035, 1.7820130483767358,
+        1.6773411358908485, 1.554291922913942, 1.4142135623730951, 1.2586407820996748,
+        1.0892780700300546, 0.90798099947909372, 0.71673589909060043, 0.51763809020504115,
+        0.31286893008046196, 0.10467191248588761, 1,
+    },
+    { // order 31
+        0.10129833767742542, 0.30285555500915334, 0.50130506451744106, 0.69461050568964056,
+        0.88078830311526857, 1.0579280206539248, 1.2242119650953256, 1.377933838151373,
+        1.5175162453855819, 1.6415268824145526, 1.7486932322891642, 1.837915623240461,
+        1.9082785128000976, 1.959059882504989, 1.9897386467837903, 2,
+        1.9897386467837903, 1.959059882504989, 1.9082785128000979, 1.8379156232404614,
+        1.7486932322891644, 1.6415268824145528, 1.5175162453855819, 1.3779338381513728,
+        1.224211965095326, 1.0579280206539254, 0.88078830311526912, 0.69461050568964022,
+        0.50130506451744161, 0.30285555500915395, 0.1012983376774252, 1,
+    },
+    { // order 32
+        0.09813534865483603, 0.2934609489107235, 0.48596035980652774, 0.6737797067844401,
+        0.85511018686056417, 1.0282054883864433, 1.1913986089848667, 1.3431179096940367,
+        1.4819022507099182, 1.6064150629612897, 1.7154572200005442, 1.8079785862468867,
+        1.8830881303660416, 1.9400625063890879, 1.978353019929562, 1.9975909124103448,
+        1.9975909124103448, 1.978353019929562, 1.9400625063890879, 1.8830881303660416,
+        1.8079785862468869, 1.7154572200005442, 1.6064150629612899, 1.481902250709918,
+        1.3431179096940371, 1.1913986089848669, 1.0282054883864435, 0.85511018686056406,
+        0.67377970678444066, 0.48596035980652813, 0.29346094891072361, 0.098135348654835933,
+        1,
+    },
+};
+
+// Chebyshev ripples (dB) with tables below
+static const double afc_chebyshev_ripple[9] = { 0.01, 0.050000000000000003, 0.10000000000000001, 0.20000000000000001, 0.25, 0.5, 1, 2, 3, };
+
+// Chebyshev ladder g-values normalized to the ripple band edge,
+// g[ripple][n-1][0..n] (g(n+1) last), and the -3 dB frequency
+static const double afc_chebyshev_g[9][32][33] = {
+    { // 0.01 dB
+        { // order 1
+            0.096030713510289537, 1,
+        },
+        { // order 2
+            0.4488926306574364, 0.40780530906880114, 1.1007522969292767,
+        },
+        { // order 3
+            0.62919260428530521, 0.97029306803974191, 0.62919260428530521, 1,
+        },
+        { // order 4
+            0.71287980712715993, 1.2003595667194125, 1.3212985502074241, 0.64762963394748452,
+            1.1007522969292767,
+        },
+        { // order 5
+            0.75634389640737465, 1.3049264597745418, 1.577318694285782, 1.3049264597745416,
+            0.75634389640737498, 1,
+        },
+        { // order 6
+            0.78136220873860152, 1.3600161390615391, 1.6896859880273329, 1.5350283553720299,
+            1.4970408889328763, 0.70984381401550212, 1.1007522969292767,
+        },
+        { // order 7
+            0.79695637669701858, 1.3924274020326362, 1.7481444750877762, 1.6331319049322905,
+            1.7481444750877764, 1.3924274020326368, 0.79695637669701758, 1,
+        },
+        { // order 8
+            0.80728989063383672, 1.4130859220881866, 1.7824509358392255, 1.6833405862187087,
+            1.8529410167945193, 1.6193024904982305, 1.5554575744969963, 0.73339832484192968,
+            1.1007522969292767,
+        },
+        { // order 9
+            0.8144732945039832, 1.4270622211630062, 1.8043696491624091, 1.7125420270886731,
+            1.9057990307631827, 1.7125420270886731, 1.8043696491624088, 1.4270622211630066,
+            0.81447329450398309, 1,
+        },
+        { // order 10
+            0.81966160222630002, 1.436960845359724, 1.8192698542785835, 1.7311165097043777,
+            1.936241444291777, 1.7590164923509399, 1.9055304743092865, 1.6527513586423812,
+            1.581737951127151, 0.74463764873612071, 1.1007522969292767,
+        },
+        { // order 11
+            0.82352753282163904, 1.444229852936731, 1.8298854830988365, 1.7437233589120948,
+            1.9554815760128035, 1.7855449115557229, 1.9554815760128026, 1.7437233589120962,
+            1.829885483098836, 1.4442298529367321, 0.82352753282163926, 1,
+        },
+        { // order 12
+            0.82648348654980308, 1.4497264772376923, 1.8377306618577953, 1.7527070626422574,
+            1.9684880703659393, 1.8022017921178879, 1.9837777622038242, 1.7883115718743892,
+            1.9292963250476305, 1.6695224411381531, 1.5957897497385798, 0.75083512326561697,
+            1.1007522969292767,
+        },
+        { // order 13
+            0.82879329493703513, 1.453984613302034, 1.8437010655712982, 1.7593552216645691,
+            1.9777353383960681, 1.8134090203832891, 2.0014375885247428, 1.8134090203832895,
+            1.9777353383960676, 1.75935522166457, 1.8437010655712975, 1.4539846133020329,
+            0.82879329493703657, 1,
+        },
+        { // order 14
+            0.8306319275289249, 1.4573509734578345, 1.8483552391912532, 1.7644251086688327,
+            1.9845711559529793, 1.821350802376321, 2.0132639888671195, 1.8289891326899248,
+            2.0048560792297154, 1.8029225662206263, 1.9421949911269054, 1.6791745466691579,
+            1.6041824314658299, 0.75460385578672518, 1.1007522969292767,
+        },
+        { // order 15
+            0.83211904229069122, 1.4600587328625434, 1.852056835926865, 1.768387148191179,
+            1.9897830118899513, 1.8272085495148851, 2.0216145397782244, 1.8393772959799009,
+            2.021614539778223, 1.8272085495148862, 1.9897830118899495, 1.7683871481911795,
+            1.8520568359268641, 1.460058732862545, 0.83211904229068923, 1,
+        },
+        { // order 16
+            0.83333866947286939, 1.4622694390902888, 1.8550512563869872, 1.7715468967199299,
+            1.9938575947773496, 1.8316684534542982, 2.0277572465416664, 1.8466865011600422,
+            2.032744407860207, 1.8421558167068253, 2.0162132573527161, 1.8113590135941851,
+            1.950034315682396, 1.6852576747393095, 1.6095964438081216, 0.75706284856057093,
+            1.1007522969292767,
+        },
+        { // order 17
+            0.83435119860114304, 1.464097910345693, 1.8575091834471562, 1.7741102938465241,
+            1.9971097720630995, 1.8351524772532215, 2.0324249020797431, 1.852048115631713,
+            2.0405496114469459, 1.8520481156317126, 2.0324249020797436, 1.8351524772532206,
+            1.997109772063101, 1.7741102938465234, 1.8575091834471555, 1.4640979103456928,
+            0.8343511986011426, 1,
+        },
+        { // order 18
+            0.83520091928447193, 1.4656275833152161, 1.8595524384534006, 1.7762205204246164,
+            1.9997511204594229, 1.8379324711068117, 2.0360661297690639, 1.8561132660229873,
+            2.0462593700784755, 1.8589644334941116, 2.0431209409357054, 1.8497041845372417,
+            2.0231083891717239, 1.8167131025191106, 1.9551788177103098, 1.6893468618152481,
+            1.613292928777128, 0.75875464590389508, 1.1007522969292767,
+        },
+        { // order 19
+            0.83592090236593652, 1.4669202813730637, 1.8612699324473547, 1.7779797951500784,
+            2.0019284133243014, 1.8401904720175519, 2.0389688335580165, 1.8592790741801148,
+            2.0505787404742719, 1.8640108422026376, 2.0505787404742719, 1.8592790741801144,
+            2.0389688335580174, 1.8401904720175517, 2.0019284133243005, 1.7779797951500802,
+            1.8612699324473536, 1.4669202813730686, 0.83592090236593353, 1,
+        },
+        { // order 20
+            0.83653624033414908, 1.4680226079832921, 1.8627278347193668, 1.7794627778719736,
+            2.0037462690254038, 1.8420524013144872, 2.0413251490578452, 1.8617995218103474,
+            2.0539363759878637, 1.8678200197569508, 2.0560071769979489, 1.8659387599895518,
+            2.0493801000545666, 1.8544818436922164, 2.0276434118110109, 1.8203425735428149,
+            1.9587477400427256, 1.6922316127940342, 1.6159292576817161, 0.75996774448511362,
+            1.1007522969292767,
+        },
+        { // order 21
+            0.83706624749802561, 1.4689702358184209, 1.8639762428171625, 1.7807250938488035,
+            2.0052810202091593, 1.8436078065815851, 2.0432675950555876, 1.8638435852382009,
+            2.0566056187276769, 1.8707756014949617, 2.0600961810647953, 1.8707756014949619,
+            2.056605618727676, 1.8638435852382016, 2.0432675950555859, 1.8436078065815864,
+            2.0052810202091589, 1.7807250938488071, 1.8639762428171582, 1.4689702358184213,
+            0.83706624749802916, 1,
+        },
+        { // order 22
+            0.83752598432641856, 1.4697908480021182, 1.865053668892608, 1.7818089161373694,
+            2.0065895036309076, 1.8449219033817328, 2.0448901746074841, 1.8655274899077672,
+            2.0587678329886776, 1.8731216108418838, 2.063263186124304, 1.8744118834728789,
+            2.061842915562071, 1.8703279918033664, 2.0534836695006833, 1.8577205610308767,
+            2.0308020228025772, 1.8229255657504477, 1.9613302571272737, 1.6943445624374078,
+            1.6178756519439665, 0.7608668968148693, 1.1007522969292767,
+        },
+        { // order 23
+            0.83792733294747412, 1.4705061950287179, 1.8659901251084967, 1.7827467165666178,
+            2.0077147997424221, 1.8460431801171941, 2.0462612018191879, 1.8669334799550907,
+            2.0605474554530887, 1.8750195781831902, 2.0657731512948243, 1.8772234222927173,
+            2.0657731512948243, 1.8750195781831906, 2.0605474554530878, 1.8669334799550916,
+            2.0462612018191866, 1.8460431801171964, 2.007714799742419, 1.7827467165666193,
+            1.8659901251084969, 1.4705061950287204, 0.83792733294746968, 1,
+        },
+        { // order 24
+            0.83827976858382558, 1.4711335588788019, 1.8668092880571103, 1.7835638440532318,
+            2.0086900800609113, 1.8470083484825761, 2.0474313771032411, 1.86812119517265,
+            2.0620323418399744, 1.8765800885007551, 2.0678011097894782, 1.8794483331783514,
+            2.0688070697059739, 1.8785344491743825, 2.0656498427889547, 1.8732936988569886,
+            2.056338696528563, 1.8600291662482769, 2.0330986820397481, 1.8248338755816988,
+            1.9632619980616106, 1.6959394890793031, 1.6193536440255827, 0.76155168689844044,
+            1.1007522969292767,
+        },
+        { // order 25
+            0.83859092125471968, 1.4716868119688153, 1.8675300443576051, 1.7842803330828141,
+            2.0095412465963141, 1.8478456528280995, 2.0484390287763463, 1.8691348143182502,
+            2.0632860708293137, 1.8778810586973373, 2.0694666602512548, 1.8812436421481946,
+            2.0712045197131626, 1.8812436421481951, 2.0694666602512539, 1.8778810586973378,
+            2.0632860708293133, 1.8691348143182513, 2.048439028776345, 1.8478456528280998,
+            2.0095412465963149, 1.7842803330828161, 1.8675300443576028, 1.4716868119688133,
+            0.83859092125472201, 1,
+        },
+        { // order 26
+            0.83886699041395085, 1.4721771942696034, 1.8681676122215169, 1.7849121954142804,
+            2.010288780316662, 1.8485771350917801, 2.0493136079084846, 1.8700076801597854,
+            2.0643556520186404, 1.8789787688816217, 2.0708539176719345, 1.8827164638438822,
+            2.0731366032653686, 1.8833815828036067, 2.072404472042721, 1.8813078323333123,
+            2.0682901957277924, 1.8754043555280202, 2.0584152492112748, 1.8617391157169207,
+            2.034825527503223, 1.8262862461651719, 1.9647461989193462, 1.6971734852909837,
+            1.6205024280791669, 0.76208516008016225, 1.1007522969292767,
+        },
+        { // order 27
+            0.83911305490331489, 1.4726138912213349, 1.8687343672595655, 1.7854723578664051,
+            2.01094905980605, 1.8492202177114176, 2.0500780745402727, 1.8707653760247394,
+            2.0652765058682663, 1.8799147601300941, 2.0720235357511494, 1.8839420124539958,
+            2.0747198666941995, 1.8851024340518319, 2.0747198666941995, 1.8839420124539954,
+            2.0720235357511498, 1.8799147601300941, 2.0652765058682658, 1.8707653760247389,
+            2.0500780745402731, 1.8492202177114188, 2.0109490598060478, 1.785472357866406,
+            1.8687343672595658, 1.472613891221338, 0.83911305490331523, 1,
+        },
+        { // order 28
+            0.83933330735109157, 1.4730044687708135, 1.8692404586467135, 1.78597135330038,
+            2.0115353177394395, 1.8497888308219572, 2.0507505617910877, 1.8714278218464966,
+            2.066075769594852, 1.8807202829194292, 2.0730202126756021, 1.8849744409353426,
+            2.0760360316246187, 1.8865110710654107, 2.0765813946577594, 1.8860156253282887,
+            2.0748899455125569, 1.8832758454909631, 2.0702071713050398, 1.8769670300561705,
+            2.0599784734348838, 1.8630445446373196, 2.0361593043613881, 1.8274186875202891,
+            1.9659120693952792, 1.6981481336548285, 1.621413052386564, 0.7625087948419873,
+            1.1007522969292767,
+        },
+        { // order 29
+            0.8395312333398034, 1.4733552045436993, 1.8696942744849447, 1.786417836648033,
+            2.0120583451686311, 1.8502942286016129, 2.0513455585940852, 1.8720107329709839,
+            2.0667745451401611, 1.8814192450364895, 2.0738775242978749, 1.8858535993804597,
+            2.0771438565717757, 1.8876809406529487, 2.078103592272281, 1.887680940652948,
+            2.0771438565717766, 1.8858535993804599, 2.0738775242978744, 1.8814192450364899,
+            2.0667745451401611, 1.8720107329709847, 2.0513455585940834, 1.8502942286016144,
+            2.0120583451686316, 1.7864178366480346, 1.8696942744849454, 1.4733552045436962,
+            0.83953123333980972, 1,
+        },
+        { // order 30
+            0.83970974972137225, 1.4736713425707566, 1.8701027972164721, 1.7868189750506003,
+            2.0125270172549281, 1.8507455895916307, 2.0518747647844089, 1.8725266550514676,
+            2.0673894608781569, 1.8820302127744661, 2.0746211222615738, 1.8866093813441098,
+            2.0780865247869951, 1.8886647882036556, 2.0793665850464618, 1.8890413318665606,
+            2.0789521037446246, 1.8878784360333769, 2.0766896099228553, 1.884730223183775,
+            2.0716490796017943, 1.878160478652158, 2.0611880166092007, 1.8640658488821114,
+            2.0372124587747189, 1.8283196163834414, 1.9668450909837658, 1.6989315420312241,
+            1.6221471152536147, 0.76285078129191775, 1.1007522969292767,
+        },
+        { // order 31
+            0.83987131238240853, 1.47395729110086, 1.8704718778725973, 1.7871807461652909,
+            2.012948690647598, 1.8511504643283851, 2.052347718938488, 1.8729857109726935,
+            2.0679337776222142, 1.8825677989831138, 2.0752709019326083, 1.8872645961916141,
+            2.0788963902783371, 1.889501332794236, 2.0804278533421621, 1.890169046141482,
+            2.0804278533421616, 1.8895013327942367, 2.0788963902783366, 1.8872645961916148,
+            2.0752709019326083, 1.8825677989831144, 2.067933777622212, 1.8729857109726942,
+            2.0523477189384871, 1.8511504643283878, 2.0129486906475975, 1.7871807461652904,
+            1.8704718778725982, 1.4739572911008629, 0.83987131238240298, 1,
+        },
+        { // order 32
+            0.84001800093048662, 1.4742167775903519, 1.8708064497175849, 1.7875081686361578,
+            2.0133295073026445, 1.851515113380185, 2.0527722658836631, 1.8733961484112946,
+            2.0684181856000698, 1.8830436445963761, 2.0758425040071011, 1.8878369137886868,
+            2.0795981109422375, 1.8902195514330018, 2.0813295483079504, 1.8911158631502487,
+            2.0816501301220307, 1.89082462431752, 2.0806635129405073, 1.8892516661047207,
+            2.0780408190807775, 1.8858398113708139, 2.0727646170075409, 1.8790950437898217,
+            2.0621451134221958, 1.8648812013476559, 2.0380595138525113, 1.8290486541969009,
+            1.9676037224060996, 1.699570788938161, 1.6227475041042549, 0.76313081814487127,
+            1.1007522969292767,
+        },
+    },
+    { // 0.05 dB
+        { // order 1
+            0.21522683131794323, 1,
+        },
+        { // order 2
+            0.69228718242796516, 0.55846240538471148, 1.2396307714770254,
+        },
+        { // order 3
+            0.87942357883498434, 1.1131666637161393, 0.87942357883498423, 1,
+        },
+        { // order 4
+            0.95879244496509697, 1.2970165241979492, 1.607821594509953, 0.77345001997868457,
+            1.2396307714770254,
+        },
+        { // order 5
+            0.99844106523036114, 1.3745415290742504, 1.828335084277495, 1.3745415290742502,
+            0.99844106523036158, 1,
+        },
+        { // order 6
+            1.0208110077596066, 1.4140735753791154, 1.9183547900625342, 1.5475211120943753,
+            1.7529291171724879, 0.82347988711453768, 1.2396307714770254,
+        },
+        { // order 7
+            1.0345937163339853, 1.4369440431982099, 1.9637361232033979, 1.6161837734527442,
+            1.9637361232033979, 1.4369440431982108, 1.0345937163339838, 1,
+        },
+        { // order 8
+            1.043660426441964, 1.4513798957354314, 1.9899427215362946, 1.6502479753936432,
+            2.045698170865621, 1.6052705106418661, 1.7991751798567575, 0.84191232619890488,
+            1.2396307714770254,
+        },
+        { // order 9
+            1.0499324581555294, 1.4610863293662706, 2.0065318234666489, 1.6697470428623344,
+            2.0857796630743417, 1.6697470428623349, 2.006531823466648, 1.4610863293662719,
+            1.0499324581555285, 1,
+        },
+        { // order 10
+            1.0544469871026736, 1.4679324196505195, 2.017743613846799, 1.6820373113527909,
+            2.1085012096398259, 1.7009106728832948, 2.0851052099254024, 1.6276972629863395,
+            1.8196941978475101, 0.85061375642224168, 1.2396307714770254,
+        },
+        { // order 11
+            1.057802461078051, 1.4729451338435893, 2.0257004509709589, 1.6903315360139586,
+            2.1227318398771975, 1.7184210196399452, 2.122731839877197, 1.6903315360139595,
+            2.0257004509709593, 1.4729451338435893, 1.0578024610780521, 1,
+        },
+        { // order 12
+            1.0603632925662383, 1.4767274978702849, 2.0315646973991015, 1.6962196691329743,
+            2.1322975830828415, 1.7293164834426731, 2.1437139264979792, 1.7201070126245726,
+            2.1026860970418149, 1.6388466179961654, 1.8305968474462804, 0.85538639162918839,
+            1.2396307714770254,
+        },
+        { // order 13
+            1.0623614538690578, 1.4796528891724172, 2.0360186708409698, 1.7005654939654615,
+            2.1390730699650642, 1.7366060244703452, 2.156691232999524, 1.7366060244703454,
+            2.1390730699650642, 1.700565493965462, 2.0360186708409698, 1.4796528891724154,
+            1.0623614538690602, 1,
+        },
+        { // order 14
+            1.0639502020097737, 1.4819627232027368, 2.0394855165096404, 1.7038732385368172,
+            2.144068584109724, 1.741752322212891, 2.1653330505034045, 1.7467564538781191,
+            2.1591297749066656, 1.7296025828360637, 2.1121736971864511, 1.6452362779600767,
+            1.8370865938640035, 0.85827992212719495, 1.2396307714770254,
+        },
+        { // order 15
+            1.0652340355364756, 1.4838188173210982, 2.0422395995076168, 1.7064544532605206,
+            2.1478701068624351, 1.7455382836589071, 2.1714122402687339, 1.7534863861003156,
+            2.1714122402687335, 1.7455382836589075, 2.1478701068624342, 1.7064544532605201,
+            2.0422395995076168, 1.4838188173210993, 1.0652340355364736, 1,
+        },
+        { // order 16
+            1.0662861657523757, 1.4853329876271855, 2.0444654840273935, 1.7085106925256157,
+            2.1508378835160817, 1.7484153654127426, 2.1758725154957901, 1.758203997426129,
+            2.1795237777433436, 1.7552585540476924, 2.1673894882888844, 1.7350633212769861,
+            2.1179224278522772, 1.6492535770077759, 1.8412644773525633, 0.86016432496419182,
+            1.2396307714770254,
+        },
+        { // order 17
+            1.0671591064964518, 1.48658453985081, 2.0462912229206767, 1.7101773855001381,
+            2.1532040647644832, 1.7506597436431657, 2.1792553784572619, 1.7616555963264726,
+            2.1851911177684653, 1.7616555963264722, 2.1792553784572624, 1.750659743643165,
+            2.1532040647644846, 1.7101773855001379, 2.0462912229206758, 1.4865845398508095,
+            1.0671591064964514, 1,
+        },
+        { // order 18
+            1.0678913109694168, 1.4876310062827345, 2.0478080312157751, 1.7115484651952138,
+            2.1551241780124961, 1.752448657957983, 2.1818906432548704, 1.7642676756427391,
+            2.1893262227785484, 1.7661115496269559, 2.1870404998489876, 1.7601133284672643,
+            2.1723892818383321, 1.7385210399743924, 2.1216881443302595, 1.6519499824740573,
+            1.8441131719914083, 0.86145918247658593, 1.2396307714770254,
+        },
+        { // order 19
+            1.0685114545776373, 1.4885149564097586, 2.0490823755342307, 1.7126908637918321,
+            2.1567058616933803, 1.7539004413937591, 2.1839891600968926, 1.7662990333996818,
+            2.1924485253255162, 1.7693543694243214, 2.1924485253255166, 1.7662990333996811,
+            2.1839891600968939, 1.7539004413937587, 2.1567058616933803, 1.7126908637918332,
+            2.0490823755342302, 1.4885149564097628, 1.0685114545776337, 1,
+        },
+        { // order 20
+            1.0690412709501782, 1.4892684423060956, 2.0501636564527916, 1.713653392530351,
+            2.1580256959091257, 1.7550967599057428, 2.1856912311169814, 1.7679145599735884,
+            2.1948722362897191, 1.771797563226712, 2.1963747802038407, 1.7705854733458428,
+            2.1915612898855228, 1.7631792315971013, 2.1756719504987823, 1.7408616707197662,
+            2.124297477026619, 1.6538502460777209, 1.8461429880722917, 0.86238684578345315,
+            1.2396307714770254,
+        },
+        { // order 21
+            1.0694974734581766, 1.4899159740993324, 2.051089234654135, 1.7144723719340604,
+            2.1591394711592775, 1.7560955823867512, 2.1870934037367822, 1.7692236412331483,
+            2.1967969698501801, 1.7736906164783066, 2.1993267242229062, 1.7736906164783064,
+            2.1967969698501801, 1.7692236412331481, 2.1870934037367817, 1.756095582386751,
+            2.1591394711592788, 1.7144723719340629, 2.0510892346541318, 1.4899159740993315,
+            1.0694974734581817, 1,
+        },
+        { // order 22
+            1.0698930841106049, 1.4904765564786557, 2.0518878043219595, 1.7151753097350846,
+            2.1600886769535625, 1.7569390633227342, 2.1882640397749777, 1.7703013448611737,
+            2.1983547916618904, 1.7751916321851235, 2.201609865678777, 1.7760206638429505,
+            2.2005821725252055, 1.7733948222683602, 2.1945200218770733, 1.7652546952893471,
+            2.1779557265048863, 1.7425258606478484, 2.12618409242525, 1.6552411020558351,
+            1.847640603576064, 0.86307399648995609, 1.2396307714770254,
+        },
+        { // order 23
+            1.0702383697257314, 1.4909651105901502, 2.0525817089467813, 1.7157833670586251,
+            2.1609047284377283, 1.7576585065450321, 2.1892527459780253, 1.7712006948843519,
+            2.1996361106452911, 1.7764049682710221, 2.203417404553961, 1.7778197215639719,
+            2.203417404553961, 1.7764049682710223, 2.1996361106452906, 1.7712006948843528,
+            2.189252745978024, 1.7576585065450339, 2.1609047284377252, 1.7157833670586262,
+            2.0525817089467822, 1.4909651105901522, 1.0702383697257249, 1,
+        },
+        { // order 24
+            1.070541512546819, 1.4913934847375987, 2.0531885633807154, 1.7163130506587994,
+            2.1616117938675905, 1.7582775887266107, 2.1900962941519739, 1.7719600857723194,
+            2.2007046438151892, 1.7774019099417924, 2.2048766089037777, 1.7792418857273629,
+            2.2056029914484512, 1.7786559188722419, 2.2033221008458854, 1.7752904287726232,
+            2.1965762481524389, 1.7667327599027429, 2.1796150037839341, 1.7437545465994031,
+            2.1275944710842594, 1.6562904137449974, 1.8487772560610782, 0.86359707840364541,
+            1.2396307714770254,
+        },
+        { // order 25
+            1.0708090979790599, 1.491771184516308, 2.0537224106185294, 1.7167773981336465,
+            2.1622287310626671, 1.7588145100140187, 2.1908224548751845, 1.7726079244430109,
+            2.2016064345226796, 1.7782325947621724, 2.2060742475435995, 1.7803884900321043,
+            2.2073282335476732, 1.780388490032105, 2.2060742475435982, 1.7782325947621735,
+            2.2016064345226787, 1.7726079244430122, 2.1908224548751831, 1.7588145100140189,
+            2.1622287310626684, 1.7167773981336478, 2.0537224106185277, 1.4917711845163051,
+            1.070809097979063, 1,
+        },
+        { // order 26
+            1.071046474270277, 1.4921059080704979, 2.0541945602687872, 1.7171868233931973,
+            2.1627704416079157, 1.7592834634754873, 2.191452548661371, 1.7731656288561835,
+            2.2023754863197946, 1.7789331854576176, 2.2070712382781532, 1.7813285068641698,
+            2.2087174303788379, 1.7817542781284306, 2.2081896312180502, 1.78042630843087,
+            2.2052203170949105, 1.7766382837493246, 2.1980706764555369, 1.7678268393178429,
+            2.180861917074894, 1.7446892182508222, 2.1286776266530882, 1.6571019432029805,
+            1.8496603979468604, 0.86400442689408685, 1.2396307714770254,
+        },
+        { // order 27
+            1.0712580211479905, 1.4924039437829493, 2.0546142053120797, 1.717549729806171,
+            2.1632488357244224, 1.7596956606180676, 2.1920031849981729, 1.7736496188310686,
+            2.2030373945705843, 1.7795303426380731, 2.2079114449770993, 1.7821102826261992,
+            2.2098550635672685, 1.7828526984056883, 2.2098550635672685, 1.7821102826261987,
+            2.2079114449770998, 1.7795303426380729, 2.2030373945705843, 1.7736496188310682,
+            2.1920031849981734, 1.7596956606180685, 2.1632488357244197, 1.7175497298061722,
+            2.0546142053120793, 1.4924039437829524, 1.0712580211479916, 1,
+        },
+        { // order 28
+            1.0714473528166566, 1.4926704694046256, 2.0549888818915503, 1.7178729615524979,
+            2.1636735313848083, 1.7600600607806771, 2.1924874734415427, 1.7740726702000886,
+            2.20361175269545, 1.7800441027844207, 2.208627154740284, 1.7827685764627426,
+            2.2108002678522087, 1.7837512346315814, 2.2111929191094455, 1.7834344860752602,
+            2.2099747858055099, 1.7816814535094943, 2.2065974443977825, 1.7776355697187438,
+            2.199195072816444, 1.768661704669676, 2.1818246109914501, 1.7454177333842589,
+            2.1295281846288439, 1.657742715956481, 1.8503602455490342, 0.86432781233723444,
+            1.2396307714770254,
+        },
+        { // order 29
+            1.0716174730173293, 1.4929097796060626, 2.0553248163100206, 1.7181621404156306,
+            2.1640523686212503, 1.760383898829748, 2.1929158833574989, 1.7744448559842798,
+            2.204113785784263, 1.7804897818704259, 2.209242596899343, 1.7833289370714986,
+            2.211595501508858, 1.7844970654252199, 2.2122861756289489, 1.7844970654252195,
+            2.2115955015088584, 1.7833289370714989, 2.2092425968993425, 1.7804897818704264,
+            2.2041137857842634, 1.7744448559842803, 2.192915883357498, 1.7603838988297484,
+            2.1640523686212521, 1.7181621404156315, 2.0553248163100224, 1.4929097796060584,
+            1.0716174730173378, 1,
+        },
+        { // order 30
+            1.0717708946589128, 1.4931254608920033, 2.0556271898658967, 1.7184219202258328,
+            2.1643917931341283, 1.7606730728617637, 2.1932968648574827, 1.7747742132928215,
+            2.20455548396597, 1.7808792656058734, 2.209776267221272, 1.7838105111893721,
+            2.2122719320503093, 1.7851240241855748, 2.2131927810965508, 1.7853645069325907,
+            2.2128946712833399, 1.7846216655418889, 2.211266400154511, 1.7826084331452268,
+            2.2076327379304503, 1.7783968700125365, 2.2000647272217115, 1.7693146341020232,
+            2.1825845196304541, 1.7459971492602164, 2.1302086906925806, 1.6582576337763906,
+            1.8509242669975459, 0.86458881089398409, 1.2396307714770254,
+        },
+        { // order 31
+            1.0719097329755736, 1.4933205273587538, 2.05590034308783, 1.7186561812861574,
+            2.1646971460391113, 1.7609324330672047, 2.1936373043075874, 1.7750672241644252,
+            2.2049464041374445, 1.7812219031666849, 2.2102425009708044, 1.78422789620867,
+            2.2128528884144019, 1.7856569184632536, 2.2139542479702228, 1.78608319751943,
+            2.2139542479702223, 1.7856569184632543, 2.2128528884144014, 1.7842278962086706,
+            2.2102425009708044, 1.7812219031666854, 2.2049464041374427, 1.7750672241644252,
+            2.1936373043075874, 1.7609324330672063, 2.1646971460391122, 1.7186561812861563,
+            2.0559003430878313, 1.4933205273587564, 1.0719097329755651, 1,
+        },
+        { // order 32
+            1.072035778697767, 1.4934975270084816, 2.0561479347518423, 1.7188681804992418,
+            2.1649728852562617, 1.7611659997190199, 2.1939428632514764, 1.775329167756486,
+            2.2052942471028882, 1.7815251384526347, 2.2106525610427381, 1.7845923925274965,
+            2.2133561357844345, 1.7861142961514085, 2.2146009828866458, 1.7866863364107042,
+            2.2148313615922639, 1.7865004917939691, 2.2141222428843172, 1.7854962838226487,
+            2.2122356443208933, 1.7833153322006789, 2.2084333817857558, 1.7789928241901163,
+            2.2007526658516396, 1.7698357557205391, 2.183195566930797, 1.7464659115203183,
+            2.13076188865959, 1.658677714414859, 1.8513854916045511, 0.86480249068069692,
+            1.2396307714770254,
+        },
+    },
+    { // 0.1 dB
+        { // order 1
+            0.30525665168734356, 1,
+        },
+        { // order 2
+            0.84306883821520262, 0.62201542199207216, 1.355382532984766,
+        },
+        { // order 3
+            1.0315851425078761, 1.1474003299537219, 1.0315851425078759, 1,
+        },
+        { // order 4
+            1.1088122655091426, 1.3061831262133994, 1.7703777941490766, 0.81808068093320019,
+            1.355382532984766,
+        },
+        { // order 5
+            1.1468378278006446, 1.3712099875101429, 1.975027577855714, 1.3712099875101427,
+            1.1468378278006448, 1,
+        },
+        { // order 6
+            1.1681356977007933, 1.4039673621369895, 2.0562348736722798, 1.5170882194741937,
+            1.9029128395211719, 0.86184945524447365, 1.355382532984766,
+        },
+        { // order 7
+            1.1812028488781385, 1.4228020783280901, 2.0966938387157446, 1.5733926567201804,
+            2.096693838715745, 1.4228020783280906, 1.1812028488781372, 1,
+        },
+        { // order 8
+            1.1897762326369341, 1.4346485410682448, 2.1199200675065537, 1.6010016729441827,
+            2.1699697027879337, 1.5640750975579982, 1.944497573535976, 0.87781582223644372,
+            1.355382532984766,
+        },
+        { // order 9
+            1.195696577389999, 1.4425962127813119, 2.1345730750870273, 1.6167134698783503,
+            2.2053899255513634, 1.6167134698783505, 2.1345730750870269, 1.4425962127813126,
+            1.1956965773899983, 1,
+        },
+        { // order 10
+            1.1999527182799534, 1.4481934709103039, 2.1444555617718772, 1.6265837756323056,
+            2.2253524983875099, 1.6418630491621677, 2.2046432379284382, 1.5821773629098264,
+            1.9628561348544071, 0.88532402408748001, 1.355382532984766,
+        },
+        { // order 11
+            1.2031133065525157, 1.4522874892518152, 2.1514592039970597, 1.6332311441966991,
+            2.2378139162839386, 1.6559124182092166, 2.2378139162839381, 1.6332311441966998,
+            2.1514592039970606, 1.4522874892518152, 1.203113306552517, 1,
+        },
+        { // order 12
+            1.2055237823745129, 1.4553742762367521, 2.1566158812613967, 1.6379437185845538,
+            2.2461732732127384, 1.6646255908079264, 2.25620444974051, 1.6572245978899482,
+            2.2200403061816187, 1.5911492355683443, 1.9725888729666405, 0.88943435010908789,
+            1.355382532984766,
+        },
+        { // order 13
+            1.2074036506460348, 1.4577603051222676, 2.160529649169582, 1.6414185928830387,
+            2.2520862576186924, 1.6704431946850826, 2.2675415424476255, 1.6704431946850831,
+            2.252086257618692, 1.6414185928830392, 2.160529649169582, 1.4577603051222656,
+            1.2074036506460379, 1,
+        },
+        { // order 14
+            1.2088977351816081, 1.459643424476023, 2.1635743770367535, 1.6440616016084511,
+            2.2564417537278363, 1.6745447930087713, 2.2750757415841778, 1.6785488127651353,
+            2.2696487631446765, 1.6648006734739296, 2.2283323779710513, 1.5962832074220565,
+            1.97837520192087, 0.8919236494212659, 1.355382532984766,
+        },
+        { // order 15
+            1.2101046799362156, 1.4611560912475032, 2.1659921231131607, 1.6461230178600528,
+            2.2597539741020234, 1.6775593790361349, 2.2803686331592226, 1.6839120690237084,
+            2.2803686331592221, 1.6775593790361352, 2.2597539741020225, 1.6461230178600521,
+            2.1659921231131607, 1.4611560912475043, 1.210104679936213, 1,
+        },
+        { // order 16
+            1.2110935363519006, 1.4623897478943191, 2.1679455356996207, 1.6477645218612158,
+            2.2623384455952391, 1.6798487168176417, 2.2842483778669158, 1.687666602584492,
+            2.2874338346447658, 1.6853163754712395, 2.2768376088315065, 1.6691512473701504,
+            2.2333512514026888, 1.5995082443075768, 1.9820975207119569, 0.89354370952743589,
+            1.355382532984766,
+        },
+        { // order 17
+            1.2119138007091865, 1.463409201681966, 2.1695473627470281, 1.6490946317491226,
+            2.2643982159472547, 1.6816337015820682, 2.2871889577017868, 1.6904110115722282,
+            2.2923634976450891, 1.690411011572228, 2.2871889577017872, 1.6816337015820679,
+            2.2643982159472551, 1.6490946317491231, 2.1695473627470259, 1.4634092016819664,
+            1.211913800709185, 1,
+        },
+        { // order 18
+            1.2126016963490664, 1.4642614384875023, 2.1708778607845551, 1.6501885509123677,
+            2.2660691694883059, 1.6830558995218263, 2.2894785308642085, 1.6924865098834714,
+            2.2959570131921425, 1.6939549959641917, 2.2939666528084031, 1.6891751775953747,
+            2.2811845682488436, 1.6719037720650478, 2.2366367380380607, 1.6016717110880432,
+            1.9846343774491046, 0.89465642860154659, 1.355382532984766,
+        },
+        { // order 19
+            1.2131842232761272, 1.4649812068931451, 2.1719954778209636, 1.6510998292229948,
+            2.2674452711743935, 1.6842097266104319, 2.2913010649501571, 1.6940997706534604,
+            2.2986685514208425, 1.6965317284653685, 2.2986685514208425, 1.6940997706534604,
+            2.2913010649501571, 1.6842097266104326, 2.2674452711743913, 1.6510998292229975,
+            2.1719954778209609, 1.4649812068931507, 1.2131842232761219, 1,
+        },
+        { // order 20
+            1.2136818373159188, 1.4655946594390852, 2.1729436342823494, 1.6518674971363196,
+            2.2685933284067055, 1.6851602889397803, 2.2927788461601595, 1.6953822950880866,
+            2.300772348918692, 1.6984717760950727, 2.3020789780868705, 1.6975077462832815,
+            2.2978915494940133, 1.6916101472188092, 2.284036820908538, 1.6737660942191035,
+            2.2389123524238288, 1.6031958368957191, 1.9864414018394916, 0.89545335562440997,
+            1.355382532984766,
+        },
+        { // order 21
+            1.2141102639891157, 1.4661217878749706, 2.1737551553220369, 1.6525205840995938,
+            2.2695619857212566, 1.6859537703156555, 2.2939959557076448, 1.6964212288766689,
+            2.3024423907196754, 1.6999742253186094, 2.3046413754857493, 1.6999742253186096,
+            2.3024423907196749, 1.6964212288766687, 2.2939959557076439, 1.6859537703156562,
+            2.269561985721257, 1.6525205840995967, 2.1737551553220329, 1.4661217878749699,
+            1.214110263989121, 1,
+        },
+        { // order 22
+            1.2144817521631182, 1.4665780887938091, 2.1744552433731195, 1.6530810675635395,
+            2.2703874023471151, 1.68662373731245, 2.2950118897885865, 1.6972763286624968,
+            2.3037936679803805, 1.7011650722790084, 2.3066222355630677, 1.7018237873285285,
+            2.3057294246907332, 1.6997368727388462, 2.3004586895176571, 1.6932576847767165,
+            2.2860203532707812, 1.6750897603404731, 2.2405572045834297, 1.6043111007079496,
+            1.9877743248093165, 0.89604353207108078, 1.355382532984766,
+        },
+        { // order 23
+            1.2148059567365288, 1.4669757259112113, 2.1750635174690682, 1.6535658489433736,
+            2.271096947312683, 1.6871951054854553, 2.2958697990602603, 1.6979897763175216,
+            2.3049048376796404, 1.7021273976271205, 2.3081898615446659, 1.7032511422274317,
+            2.3081898615446659, 1.7021273976271207, 2.3049048376796399, 1.6979897763175222,
+            2.295869799060259, 1.6871951054854568, 2.2710969473126799, 1.6535658489433744,
+            2.1750635174690691, 1.4669757259112133, 1.214805956736521, 1,
+        },
+        { // order 24
+            1.2150905706447417, 1.467324355820238, 2.1755954408625957, 1.6539881086352972,
+            2.2717116695720585, 1.6876867128695232, 2.2966016558028426, 1.6985920996082982,
+            2.3058312990397969, 1.7029179072127316, 2.3094550088456365, 1.7043790419792655,
+            2.3100855830840068, 1.7039138048797571, 2.3081051865431106, 1.7012402350810814,
+            2.3022420624750088, 1.6944306126960054, 2.2874610917738294, 1.6760668034945012,
+            2.2417865922087961, 1.6051523373785772, 1.9887858021018723, 0.89649271779304829,
+            1.355382532984766,
+        },
+        { // order 25
+            1.2153417843298129, 1.4676317242657304, 2.176063338668595, 1.6543582545497586,
+            2.2722479886998572, 1.6881130357388978, 2.2972315972342834, 1.6991058754291677,
+            2.3066130640588356, 1.7035764590813107, 2.3104931285508914, 1.7052881271273816,
+            2.311581441483523, 1.7052881271273819, 2.310493128550891, 1.7035764590813109,
+            2.3066130640588356, 1.6991058754291681, 2.2972315972342825, 1.6881130357388974,
+            2.272247988699859, 1.6543582545497599, 2.1760633386685932, 1.4676317242657277,
+            1.2153417843298155, 1,
+        },
+        { // order 26
+            1.2155646244560192, 1.4679041031083495, 2.1764771351869121, 1.6546845984393301,
+            2.2727188766230757, 1.6884853602288883, 2.2977781487925979, 1.69954812000726,
+            2.3072796694951307, 1.7041317868710626, 2.3113571592273852, 1.7060332421686588,
+            2.3127855745766315, 1.7063710932466496, 2.3123276571267732, 1.705317209701241,
+            2.3097504578291601, 1.7023088414856093, 2.3035378358249408, 1.6952986281537241,
+            2.2885435644547303, 1.6768099199405999, 2.242730602323578, 1.6058028506490827,
+            1.9895715814497292, 0.89684247426382202, 1.355382532984766,
+        },
+        { // order 27
+            1.2157632068101543, 1.4681466148784874, 2.1768448960687499, 1.6549738461920145,
+            2.2731346992375823, 1.6888125995914636, 2.2982557387868399, 1.6999318747153809,
+            2.3078533405749471, 1.70460506522556, 2.3120851998282443, 1.7066528064251789,
+            2.3137714219917247, 1.7072417969820366, 2.3137714219917247, 1.7066528064251785,
+            2.3120851998282448, 1.7046050652255598, 2.3078533405749471, 1.6999318747153804,
+            2.2982557387868403, 1.6888125995914647, 2.2731346992375792, 1.6549738461920158,
+            2.176844896068749, 1.4681466148784912, 1.2157632068101552, 1,
+        },
+        { // order 28
+            1.2159409273549007, 1.4683634768260423, 2.1771732323757029, 1.6552314586266232,
+            2.2735038259867624, 1.6891018752136158, 2.2986757527032404, 1.7002672841220525,
+            2.3083510857954672, 1.7050122021201077, 2.3127052822765881, 1.7071744278422667,
+            2.3145903573355948, 1.7079538859038452, 2.3149308640975277, 1.707702660324611,
+            2.3138744002556706, 1.7063118536607125, 2.3109437572794862, 1.7030993314574545,
+            2.3045125783044771, 1.6959608795025516, 2.2893791780963464, 1.6773890548671535,
+            2.2434718070694188, 1.6063164305218154, 1.9901942085628028, 0.89712011020033311,
+            1.355382532984766,
+        },
+        { // order 29
+            1.216100608129751, 1.4685581865252113, 2.1774676054350257, 1.6554619206333574,
+            2.2738330781539293, 1.6893589368121931, 2.2990472813282836, 1.7005623449020095,
+            2.3087861182916605, 1.7053653540895084, 2.3132384353346658, 1.7076183903734581,
+            2.3152792478264743, 1.7085448423267788, 2.3158781012583924, 1.7085448423267784,
+            2.3152792478264748, 1.7076183903734585, 2.3132384353346653, 1.7053653540895088,
+            2.3087861182916609, 1.7005623449020104, 2.2990472813282823, 1.689358936812194,
+            2.2738330781539302, 1.655461920633359, 2.1774676054350266, 1.4685581865252082,
+            1.2161006081297594, 1,
+        },
+        { // order 30
+            1.2162446097917825, 1.4687336645136195, 2.1777325594565182, 1.6556689444540778,
+            2.2741280631355982, 1.6895884710551679, 2.2993776608720817, 1.700823436279038,
+            2.3091688414789076, 1.7056739526474844, 2.3137007068639517, 1.7079998899710391,
+            2.3158651455017019, 1.7090415325914554, 2.316663466210334, 1.7092321981667224,
+            2.3164050414199751, 1.7086431978740351, 2.3149932172066494, 1.707046277015845,
+            2.3118406823854869, 1.7037026708568788, 2.3052663772237345, 1.6964787467110782,
+            2.290038701600611, 1.6778496164677672, 2.2440647677183811, 1.606729101533281,
+            1.9906959544884695, 0.89734416682604068, 1.355382532984766,
+        },
+        { // order 31
+            1.2163749192347248, 1.468892364977411, 2.1779719008826786, 1.6558556249777738,
+            2.2743934268607249, 1.6897943314400297, 2.2996728690694566, 1.7010557023431032,
+            2.3095075459947236, 1.7059454149318973, 2.3141045317653135, 1.7083305085859746,
+            2.316368291871687, 1.7094636476836484, 2.317322998010134, 1.7098015751915736,
+            2.3173229980101335, 1.7094636476836489, 2.3163682918716866, 1.7083305085859752,
+            2.3141045317653135, 1.7059454149318978, 2.3095075459947214, 1.7010557023431032,
+            2.2996728690694566, 1.689794331440031, 2.2743934268607262, 1.6558556249777723,
+            2.1779719008826803, 1.4688923649774133, 1.2163749192347151, 1,
+        },
+        { // order 32
+            1.2164932183978809, 1.469036362415433, 2.1781888380043046, 1.6560245596280789,
+            2.2746330466152944, 1.6899797117263387, 2.2999378198183358, 1.701263331988488,
+            2.3098089112268805, 1.7061856454416999, 2.3144596777759796, 1.7086192100274626,
+            2.3168040965452428, 1.7098259049330233, 2.317883083342962, 1.7102793319887533,
+            2.3180827331024134, 1.7101320305778283, 2.3174681659910945, 1.7093359550999019,
+            2.3158326327934557, 1.7076062450643883, 2.3125342218610223, 1.7041749137347326,
+            2.3058626041846626, 1.6968920314721105, 2.2905689823725113, 1.6782221928197574,
+            2.2445467623136914, 1.6070657434308142, 1.991106225937354, 0.89752759002948679,
+            1.355382532984766,
+        },
+    },
+    { // 0.2 dB
+        { // order 1
+            0.43420496373668027, 1,
+        },
+        { // order 2
+            1.0378698568276545, 0.67456043167517299, 1.5385869198557283,
+        },
+        { // order 3
+            1.2275781076032535, 1.1525413239964664, 1.2275781076032535, 1,
+        },
+        { // order 4
+            1.3028765717534949, 1.2844245613566203, 1.9761988296447264, 0.84680075915091269,
+            1.5385869198557283,
+        },
+        { // order 5
+            1.3394775289351797, 1.3370082310936393, 2.1660862230003208, 1.3370082310936386,
+            1.3394775289351804, 1,
+        },
+        { // order 6
+            1.359845160444453, 1.3632099324771831, 2.2394980487079619, 1.4555551069665649,
+            2.0974169711268043, 0.8838273242125092, 1.5385869198557283,
+        },
+        { // order 7
+            1.3722953545331129, 1.3781932078355106, 2.2756885464235208, 1.500146640085483,
+            2.2756885464235208, 1.378193207835511, 1.3722953545331111, 1,
+        },
+        { // order 8
+            1.3804450498462135, 1.3875878322052992, 2.2963555543839389, 1.521784402915509,
+            2.3413975771662598, 1.4925094739524158, 2.1349244887820369, 0.89721616116147629,
+            1.5385869198557283,
+        },
+        { // order 9
+            1.3860641311330093, 1.3938782659441367, 2.3093552363419083, 1.5340342558656792,
+            2.3728309822999227, 1.5340342558656792, 2.3093552363419083, 1.3938782659441369,
+            1.3860641311330091, 1,
+        },
+        { // order 10
+            1.3900993283365823, 1.3983025928647208, 2.3181064581356279, 1.5417071822836803,
+            2.3904552195206512, 1.5536692718958001, 2.3720505049093017, 1.5066464092603844,
+            2.1514100793820088, 0.90349093079962717, 1.5385869198557283,
+        },
+        { // order 11
+            1.3930934897962377, 1.4015357116700282, 2.324300759145673, 1.5468653054759556,
+            2.4014248762752439, 1.564581615038859, 2.401424876275243, 1.5468653054759565,
+            2.324300759145673, 1.4015357116700287, 1.3930934897962388, 1,
+        },
+        { // order 12
+            1.395375691243361, 1.4039717613790414, 2.3288576082013948, 1.5505177077211905,
+            2.4087702719892978, 1.5713295751683092, 2.4176271311364181, 1.5655730858645067,
+            2.385606264104509, 1.5136340873220024, 2.1601325879046009, 0.9069202872036678,
+            1.5385869198557283,
+        },
+        { // order 13
+            1.3971547145098551, 1.4058538268130414, 2.3323139577727736, 1.5532085999041108,
+            2.4139598517365157, 1.5758269516628955, 2.4275862372986485, 1.5758269516628955,
+            2.4139598517365166, 1.5532085999041105, 2.3323139577727749, 1.4058538268130387,
+            1.3971547145098593, 1,
+        },
+        { // order 14
+            1.3985681455094126, 1.407338621393744, 2.3350015691443304, 1.5552540668145141,
+            2.4177793311912881, 1.5789939892873828, 2.4341928057689923, 1.5820963862069273,
+            2.4294194984483806, 1.571428497142042, 2.3928935642532356, 1.5176273364934632,
+            2.1653127946842079, 0.90899521337446376, 1.5385869198557283,
+        },
+        { // order 15
+            1.3997096116222452, 1.4085309532052774, 2.3371349614867576, 1.556848705471275,
+            2.42068219259221, 1.5813197800970664, 2.4388285313665423, 1.5862372605380544,
+            2.4388285313665419, 1.5813197800970666, 2.4206821925922091, 1.5568487054712743,
+            2.337134961486758, 1.4085309532052781, 1.3997096116222429, 1,
+        },
+        { // order 16
+            1.4006446044393546, 1.4095031180022086, 2.3388581365981782, 1.5581180711452043,
+            2.4229462373817254, 1.5830849848658519, 2.4422237795833066, 1.5891326430758341,
+            2.4450186985522415, 1.58731609379099, 2.4357138507346043, 1.574786712478305,
+            2.3973000838548497, 1.5201339010586998, 2.1686430608540643, 0.91034480169030108,
+            1.5385869198557283,
+        },
+        { // order 17
+            1.4014200405853019, 1.4103063199068193, 2.3402708397381913, 1.5591463547112223,
+            2.4247500165149694, 1.5844606969913324, 2.4447956221456173, 1.5912473143284132,
+            2.4493327174309849, 1.5912473143284127, 2.4447956221456182, 1.5844606969913317,
+            2.4247500165149707, 1.5591463547112219, 2.3402708397381899, 1.4103063199068189,
+            1.4014200405853015, 1,
+        },
+        { // order 18
+            1.4020702387316168, 1.4109776627040511, 2.3414440281666309, 1.5599918571011808,
+            2.426212908364425, 1.5855564329960812, 2.4467972094915855, 1.5928456198834526,
+            2.4524748803664225, 1.5939787663061569, 2.4507314361021688, 1.5902885809798901,
+            2.4395163885008744, 1.5769098755837145, 2.4001830664173198, 1.5218145936052712,
+            2.1709117760450574, 0.91127138846539124, 1.5385869198557283,
+        },
+        { // order 19
+            1.4026207688026986, 1.4115445746533801, 2.3424293517753227, 1.560696067778873,
+            2.4274174033834868, 1.5864451660785235, 2.4483899656525292, 1.594087417980832,
+            2.4548444447524584, 1.5959631047528418, 2.454844444752458, 1.5940874179808322,
+            2.4483899656525292, 1.5864451660785241, 2.4274174033834846, 1.5606960677788755,
+            2.3424293517753201, 1.4115445746533857, 1.4026207688026924, 1,
+        },
+        { // order 20
+            1.4030909965546448, 1.4120276913431624, 2.3432651649773808, 1.5612892122339008,
+            2.4284221165600868, 1.5871771797253047, 2.4496810935476265, 1.595074301890034,
+            2.4566821078847183, 1.5974562517873658, 2.4578252940417991, 1.5967132413390595,
+            2.4541604570860125, 1.5921629528589332, 2.4420100482188589, 1.5783457438906323,
+            2.402179160054934, 1.522998236067876, 2.1725273363746722, 0.91193482698150874,
+            1.5385869198557283,
+        },
+        { // order 21
+            1.4034958052038971, 1.412442782365515, 2.3439804531722777, 1.561793762175455,
+            2.42926970709691, 1.5877881226044166, 2.4507442507577792, 1.5958735363129324,
+            2.4581403965868001, 1.5986120959734309, 2.4600636116984593, 1.5986120959734305,
+            2.4581403965868005, 1.5958735363129317, 2.4507442507577792, 1.5877881226044164,
+            2.4292697070969114, 1.561793762175457, 2.3439804531722741, 1.4124427823655139,
+            1.4034958052039033, 1,
+        },
+        { // order 22
+            1.4038467846628493, 1.412802068317772, 2.3445974642921255, 1.562226724736677,
+            2.4299918727888263, 1.5883038922296182, 2.4516315279911809, 1.5965312126348383,
+            2.4593200291091386, 1.599527915189338, 2.4617931828681749, 1.6000351693481276,
+            2.4610127282544183, 1.5984277504060325, 2.4564020409013665, 1.5934306319340517,
+            2.4437435933404346, 1.5793660022903893, 2.4036216045289063, 1.5238641600514671,
+            2.1737187826588507, 0.91242604921825654, 1.5385869198557283,
+        },
+        { // order 23
+            1.4041530684727661, 1.4131151393433201, 2.345133513162418, 1.5626011753484341,
+            2.4306125980349531, 1.5887437042597488, 2.4523806875245788, 1.5970798481431145,
+            2.4602898509892226, 1.6002677962937986, 2.4631614833270303, 1.6011329103014598,
+            2.4631614833270303, 1.6002677962937988, 2.4602898509892217, 1.5970798481431152,
+            2.4523806875245775, 1.5887437042597503, 2.43061259803495, 1.5626011753484346,
+            2.3451335131624198, 1.4131151393433217, 1.4041530684727568, 1,
+        },
+        { // order 24
+            1.4044219328067282, 1.4133896074384904, 2.3456022440372761, 1.5629273083395125,
+            2.4311503237238932, 1.5891220825519599, 2.4530196985468553, 1.5975429654224174,
+            2.4610983239781183, 1.6008754506142182, 2.4642654765046133, 1.6020000575297264,
+            2.464816334123364, 1.6016420292560931, 2.4630860286331839, 1.5995835478757938,
+            2.4579587105064653, 1.5943328692647867, 2.4450024502683414, 1.5801189340358219,
+            2.4046995132964994, 1.5245172136633132, 2.1746227626648809, 0.91279986504656874,
+            1.5385869198557283,
+        },
+        { // order 25
+            1.4046592317925841, 1.4136315773057406, 2.3460145302001538, 1.5632131720360183,
+            2.4316194316425883, 1.5894501851189291, 2.4535696695251574, 1.5979379541384637,
+            2.461780433635802, 1.6013815853919759, 2.4651711720607477, 1.6026987936973727,
+            2.4661216910799464, 1.6026987936973729, 2.4651711720607468, 1.6013815853919764,
+            2.461780433635802, 1.5979379541384642, 2.453569669525157, 1.5894501851189284,
+            2.4316194316425905, 1.5632131720360189, 2.3460145302001529, 1.4136315773057371,
+            1.4046592317925881, 1,
+        },
+        { // order 26
+            1.4048697183287522, 1.4138459912946677, 2.3463791255313295, 1.563465192699679,
+            2.4320312815576597, 1.5897367091018515, 2.4540467970268929, 1.5982779168101502,
+            2.4623619966045105, 1.6018083274981323, 2.4659248586367086, 1.6032713807691845,
+            2.4671721997896752, 1.6035312454242219, 2.466772375430502, 1.602720539745609,
+            2.4645213408046089, 1.6004048681470673, 2.4590894970983603, 1.5950004288721003,
+            2.4459481066386028, 1.5806915099640304, 2.405527095137439, 1.5250221454835635,
+            2.1753249488964346, 0.91309090191699482, 1.5385869198557283,
+        },
+        { // order 27
+            1.4050572835549171, 1.4140368855336876, 2.3467031434706294, 1.5636885542199823,
+            2.4323949495304698, 1.5899885217502496, 2.4544636927138397, 1.5985728926792466,
+            2.4628624328601902, 1.6021719768345248, 2.4665598344624509, 1.6037474075874094,
+            2.4680320928500157, 1.6042003607844393, 2.4680320928500157, 1.6037474075874092,
+            2.4665598344624513, 1.6021719768345246, 2.4628624328601902, 1.598572892679246,
+            2.454463692713841, 1.5899885217502501, 2.4323949495304675, 1.5636885542199825,
+            2.3467031434706298, 1.4140368855336904, 1.4050572835549198, 1,
+        },
+        { // order 28
+            1.4052251377168035, 1.4142075824815612, 2.3469924138774223, 1.5638874774384501,
+            2.4327177624983403, 1.5902111088412532, 2.4548303066267372, 1.5988306892905191,
+            2.4632966002343468, 1.6024847753430869, 2.467100590256833, 1.6041481271086711,
+            2.4687462787009609, 1.6047474704979972, 2.4690434677797843, 1.6045543133386662,
+            2.4681213258804648, 1.6034847030209847, 2.465562114610818, 1.6010123110011412,
+            2.4599399856063098, 1.595509668610029, 2.4466780118724225, 1.5811376862130466,
+            2.4061768169129656, 1.5254207504230584, 2.1758812883669241, 0.91332190569290028,
+            1.5385869198557283,
+        },
+        { // order 29
+            1.4053759482571431, 1.4143608373345291, 2.3472517522117524, 1.564065428460961,
+            2.4330056912999622, 1.590408898873146, 2.4551545820949339, 1.5990574599360441,
+            2.4636760385574532, 1.6027560756374382, 2.4675654926607922, 1.6044891484863348,
+            2.4693469707229103, 1.6052014356947508, 2.4698695656002396, 1.6052014356947504,
+            2.4693469707229112, 1.6044891484863348, 2.4675654926607922, 1.6027560756374382,
+            2.4636760385574541, 1.5990574599360443, 2.4551545820949325, 1.5904088988731464,
+            2.4330056912999645, 1.5640654284609616, 2.3472517522117546, 1.4143608373345251,
+            1.4053759482571537, 1,
+        },
+        { // order 30
+            1.4055119463121175, 1.4144989505196734, 2.347485164887658, 1.5642252759591255,
+            2.4332636436647208, 1.5905855011093564, 2.45544292841157, 1.5992581125019076,
+            2.4640098320434984, 1.6029931322485893, 2.4679685543702004, 1.6047821619441731,
+            2.4698577975288076, 1.6055829341772572, 2.4705543773293837, 1.6057294816733787,
+            2.4703289012687129, 1.6052767417003644, 2.4690968435851053, 1.6040488337191996,
+            2.4663442658962476, 1.6014758738976822, 2.4605976133685967, 1.5959078403200078,
+            2.4472540469190269, 1.5814924800562358, 2.4066965492984291, 1.5257410124790183,
+            2.1763295834192293, 0.9135083160877977, 1.5385869198557283,
+        },
+        { // order 31
+            1.4056350096105625, 1.4146238549722625, 2.3476960075735094, 1.5643694113161721,
+            2.4334956854083578, 1.5907438828432721, 2.4557005673753065, 1.5994366040521326,
+            2.4643052188571528, 1.6032016492187089, 2.4683206309444077, 1.6050360751862431,
+            2.4702964337365954, 1.6059071157285094, 2.471129387457041, 1.6061668194541872,
+            2.471129387457041, 1.6059071157285094, 2.4702964337365958, 1.6050360751862434,
+            2.4683206309444086, 1.6032016492187087, 2.4643052188571519, 1.5994366040521319,
+            2.4557005673753074, 1.5907438828432729, 2.4334956854083596, 1.5643694113161704,
+            2.3476960075735125, 1.4146238549722641, 1.4056350096105503, 1,
+        },
+        { // order 32
+            1.4057467275664053, 1.4147371844614511, 2.3478871084009434, 1.5644998413625633,
+            2.433705209372639, 1.5908865031073196, 2.4559317910016842, 1.5995961564683605,
+            2.4645680296297541, 1.6033861665810973, 2.4686302479410855, 1.6052577808043469,
+            2.4706763313965108, 1.6061853001153894, 2.4716176396645366, 1.6065337332375698,
+            2.4717917882663181, 1.6064205458709451, 2.4712556936220871, 1.605808745357189,
+            2.4698286245422043, 1.6044788994908157, 2.4669489833792961, 1.6018386727614011,
+            2.461117723393718, 1.596225575108863, 2.4477171646559426, 1.5817794743769447,
+            2.4071189920368048, 1.5260022544719813, 2.1766961270459055, 0.91366091146687911,
+            1.5385869198557283,
+        },
+    },
+    { // 0.25 dB
+        { // order 1
+            0.48686741996636257, 1,
+        },
+        { // order 2
+            1.1131986569844341, 0.687326988639407, 1.6196056249559743,
+        },
+        { // order 3
+            1.3034391272306962, 1.1462759945623056, 1.3034391272306958, 1,
+        },
+        { // order 4
+            1.3782395577087847, 1.2693264223872296, 2.0558082136035991, 0.85097232096007924,
+            1.6196056249559743,
+        },
+        { // order 5
+            1.4144603799570969, 1.3179959561391668, 2.2414082521959515, 1.3179959561391665,
+            1.4144603799570972, 1,
+        },
+        { // order 6
+            1.4345781933117432, 1.3421692278763515, 2.3126034150708787, 1.4278805774916614,
+            2.1737848311113548, 0.88575772472433933, 1.6196056249559743,
+        },
+        { // order 7
+            1.4468623457116629, 1.3559703866331456, 2.3475915477988725, 1.4688950739902429,
+            2.3475915477988725, 1.3559703866331463, 1.4468623457116607, 1,
+        },
+        { // order 8
+            1.4548979083288083, 1.3646158983528434, 2.3675411034737492, 1.4887355140418341,
+            2.411164412613878, 1.461800988458599, 2.2101395848766145, 0.89830381292258055,
+            1.6196056249559743,
+        },
+        { // order 9
+            1.4604357979263758, 1.3704014301163345, 2.380078559349446, 1.4999506937934934,
+            2.4414823129652765, 1.4999506937934937, 2.3800785593494451, 1.3704014301163354,
+            1.4604357979263745, 1,
+        },
+        { // order 10
+            1.4644114344623929, 1.37446908158224, 2.3885140495797534, 1.5069694920460526,
+            2.4584552623831151, 1.5179345048582082, 2.4406962659548328, 1.4747504039106325,
+            2.2260978558586659, 0.90417778988770936, 1.6196056249559743,
+        },
+        { // order 11
+            1.4673607245175981, 1.3774407572933047, 2.3944827238080912, 1.5116853718907546,
+            2.469010504647545, 1.5279140279483641, 2.4690105046475446, 1.5116853718907555,
+            2.3944827238080912, 1.377440757293305, 1.4673607245175992, 1,
+        },
+        { // order 12
+            1.4696083375719318, 1.379679378316033, 2.3988724871713245, 1.5150234553658466,
+            2.4760746749974651, 1.5340798840541665, 2.4846044093459372, 1.5288133338415468,
+            2.4537405102507615, 1.4811460581563076, 2.2345364817564102, 0.90738653591171747,
+            1.6196056249559743,
+        },
+        { // order 13
+            1.4713601667348055, 1.3814086564185235, 2.4022014942606438, 1.5174821739919488,
+            2.4810638310152564, 1.5381871378499423, 2.4941814120621291, 1.5381871378499423,
+            2.4810638310152564, 1.5174821739919488, 2.4022014942606442, 1.3814086564185215,
+            1.4713601667348093, 1,
+        },
+        { // order 14
+            1.4727518474548553, 1.3827727582051843, 2.4047897300767378, 1.519350824721855,
+            2.4847349144539375, 1.5410784500107799, 2.5005311670762693, 1.5439136099223185,
+            2.495939326135892, 1.5341604623789089, 2.4607491420010135, 1.4847995666488909,
+            2.2395465372250052, 0.90932744660904286, 1.6196056249559743,
+        },
+        { // order 15
+            1.473875654959937, 1.3838680712815064, 2.4068440214500142, 1.5208074250797559,
+            2.4875245061571452, 1.5432012452582244, 2.5049851491873718, 1.5476938807745175,
+            2.5049851491873714, 1.5432012452582244, 2.4875245061571447, 1.520807425079755,
+            2.4068440214500151, 1.3838680712815072, 1.4738756549599341, 1,
+        },
+        { // order 16
+            1.4747961211867284, 1.3847610671870116, 2.4085031666294223, 1.5219667911979318,
+            2.4896999246204592, 1.5448121034565132, 2.508246505125773, 1.5503362086240122,
+            2.5109332440603684, 1.5486773239590075, 2.5019863722582381, 1.5372260297553222,
+            2.4649859760203641, 1.4870923695976261, 2.2427668136361207, 0.91058965124724023,
+            1.6196056249559743,
+        },
+        { // order 17
+            1.4755594672689709, 1.3854988160329924, 2.4098632849546853, 1.5229058913783651,
+            2.4914329214934092, 1.5460673635313706, 2.5107164999102127, 1.5522655969776524,
+            2.5150771280143633, 1.5522655969776522, 2.5107164999102136, 1.54606736353137,
+            2.4914329214934106, 1.5229058913783651, 2.4098632849546835, 1.3854988160329922,
+            1.4755594672689698, 1,
+        },
+        { // order 18
+            1.47619949832692, 1.3861154207270123, 2.410992742006786, 1.5236780134184573,
+            2.492838297734826, 1.5470670623001956, 2.512638575046529, 1.5537236109779129,
+            2.5180946494882828, 1.554757905682584, 2.5164194999667355, 1.551389138398942,
+            2.5056385162855106, 1.5391637688357562, 2.4677574811542744, 1.4886295187276373,
+            2.244960332247683, 0.91145614437283129, 1.6196056249559743,
+        },
+        { // order 19
+            1.4767413986726814, 1.3866360879798343, 2.4119412939545981, 1.5243210726363288,
+            2.4939953638490655, 1.54787783843506, 2.5141679092710896, 1.5548562646600101,
+            2.5203698272644894, 1.5565680792404932, 2.5203698272644894, 1.5548562646600099,
+            2.5141679092710905, 1.5478778384350602, 2.4939953638490637, 1.524321072636331,
+            2.4119412939545959, 1.3866360879798396, 1.4767413986726745, 1,
+        },
+        { // order 20
+            1.4772042401180467, 1.3870797799907588, 2.4127458845393535, 1.5248626868354089,
+            2.4949604656644531, 1.5485456008221479, 2.5154075304409234, 1.55575632086816,
+            2.5221340647556585, 1.5579299385617138, 2.5232320917818671, 1.5572519790576906,
+            2.5197116883388828, 1.553098786322936, 2.5080331655923804, 1.5404740680202766,
+            2.4696761848841091, 1.4897119689893263, 2.2465222139357293, 0.91207650637679349,
+            1.6196056249559743,
+        },
+        { // order 21
+            1.4776026787382126, 1.3874609862623604, 2.4134344302947395, 1.5253233866169331,
+            2.4957746052672767, 1.5491028912757778, 2.5164282127501063, 1.5564851814553635,
+            2.5235339489998427, 1.5589840179474561, 2.5253809943090273, 1.5589840179474561,
+            2.5235339489998423, 1.5564851814553637, 2.516428212750105, 1.5491028912757785,
+            2.4957746052672767, 1.525323386616936, 2.4134344302947341, 1.3874609862623601,
+            1.4776026787382179, 1,
+        },
+        { // order 22
+            1.4779481267421724, 1.3877909345361252, 2.4140283569364565, 1.5257187085403929,
+            2.4964682456870224, 1.5495733470760236, 2.5172799994621533, 1.5570849117510783,
+            2.5246662506356379, 1.5598191233249368, 2.5270412608543573, 1.5602818500479405,
+            2.5262918260509628, 1.5588154373718397, 2.5218634816061218, 1.5542549128468111,
+            2.5096977092061845, 1.5414050230622558, 2.4710626024525832, 1.4905038113843769,
+            2.2476740038376239, 0.91253580746383678, 1.6196056249559743,
+        },
+        { // order 23
+            1.4782495770709616, 1.3880784352340543, 2.4145443381932892, 1.5260605964612546,
+            2.4970644348558544, 1.5499745048567644, 2.5179991637171555, 1.5575851837944745,
+            2.5255971032754108, 1.5604937449832752, 2.5283546044900294, 1.5612828533194245,
+            2.5283546044900294, 1.5604937449832756, 2.5255971032754099, 1.5575851837944752,
+            2.5179991637171537, 1.5499745048567659, 2.4970644348558508, 1.5260605964612555,
+            2.4145443381932901, 1.3880784352340565, 1.4782495770709509, 1,
+        },
+        { // order 24
+            1.4785141935024795, 1.3883304810683459, 2.414995512321878, 1.5263583618276531,
+            2.4975808922364777, 1.5503196181800392, 2.518612568787614, 1.5580074590959891,
+            2.5263730520962859, 1.5610477689187303, 2.5294141756397823, 1.5620735064770035,
+            2.5299430376848604, 1.5617469689317338, 2.5282817473657526, 1.5598692750680936,
+            2.5233576444752317, 1.5550776868017329, 2.5109063740839916, 1.5420920091607906,
+            2.4720985885146582, 1.4911009662537584, 2.2485478564361245, 0.91288531647490756,
+            1.6196056249559743,
+        },
+        { // order 25
+            1.4787477394636455, 1.3885526798094485, 2.4153923488134561, 1.5266193555051035,
+            2.4980314360555598, 1.5506188683545192, 2.5191404866403344, 1.5583676018850301,
+            2.5270276946043055, 1.5615092105360178, 2.5302833753753098, 1.5627105560660517,
+            2.5311958815661768, 1.5627105560660519, 2.5302833753753089, 1.5615092105360182,
+            2.5270276946043055, 1.5583676018850305, 2.5191404866403335, 1.550618868354519,
+            2.4980314360555611, 1.5266193555051049, 2.4153923488134534, 1.3885526798094459,
+            1.4787477394636486, 1,
+        },
+        { // order 26
+            1.4789548940196355, 1.3887495712965858, 2.415743276072511, 1.5268494465613154,
+            2.4984269803095094, 1.5508801907011132, 2.5195984707944508, 1.5586775642295452,
+            2.5275858204755628, 1.5618982543884539, 2.5310066559358901, 1.5632325616871774,
+            2.5322040525275598, 1.5634695345025067, 2.5318202500228915, 1.5627302208243987,
+            2.5296591984164598, 1.5606180798145031, 2.5244429505188504, 1.5556864164774298,
+            2.5118142804923207, 1.5426144129237773, 2.4728939521116198, 1.4915626612115396,
+            2.2492266173271513, 0.91315742007246004, 1.6196056249559743,
+        },
+        { // order 27
+            1.4791394877232378, 1.3889248628106479, 2.4160551427779646, 1.5270533692018726,
+            2.4987762444699082, 1.5511098505815204, 2.5199986314009482, 1.5589465031878169,
+            2.528066075492335, 1.5622297679555388, 2.5316159903495286, 1.5636665157296772,
+            2.5330292399592182, 1.5640795463203481, 2.5330292399592178, 1.563666515729677,
+            2.531615990349529, 1.5622297679555386, 2.528066075492335, 1.5589465031878165,
+            2.519998631400949, 1.5511098505815213, 2.4987762444699051, 1.5270533692018735,
+            2.4160551427779642, 1.3889248628106512, 1.47913948772324, 1,
+        },
+        { // order 28
+            1.4793046807321537, 1.3890816060071229, 2.4163335616020785, 1.5272349779749985,
+            2.4990862673003247, 1.5513128527204276, 2.5203505222950024, 1.5591815397661843,
+            2.5284827240845571, 1.5625149163671075, 2.5321348921377429, 1.5640318036688361,
+            2.5337145673449069, 1.5645782990852739, 2.5339998138825557, 1.5644021781004778,
+            2.5331147068320807, 1.5634268325084253, 2.5306579476257767, 1.5611718588303201,
+            2.5252591921328253, 1.5561507588389099, 2.5125150223324972, 1.5430214792988657,
+            2.4735183609578151, 1.4919271237204847, 2.2497643826120171, 0.913373390372342,
+            1.6196056249559743,
+        },
+        { // order 29
+            1.4794530987938634, 1.3892223314389844, 2.4165831684614401, 1.5273974380819395,
+            2.4993627845840871, 1.5514932371051313, 2.5206617701374112, 1.5593882858694383,
+            2.5288468444845527, 1.5627622289303731, 2.5325809935301171, 1.5643426615787988,
+            2.5342909637081892, 1.5649921197173693, 2.5347925370692495, 1.5649921197173688,
+            2.5342909637081896, 1.5643426615787992, 2.5325809935301162, 1.5627622289303738,
+            2.5288468444845522, 1.5593882858694392, 2.520661770137409, 1.5514932371051326,
+            2.499362784584088, 1.5273974380819411, 2.4165831684614409, 1.3892223314389809,
+            1.4794530987938741, 1,
+        },
+        { // order 30
+            1.4795869381120688, 1.3893491519127887, 2.4168078202827696, 1.5275433690751772,
+            2.4996105106890547, 1.5516542962364757, 2.5209385284496317, 1.5595712173568013,
+            2.5291671570533065, 1.562978321140414, 2.5329677459023454, 1.5646097503945962,
+            2.5347811131817481, 1.5653398679443102, 2.5354496499351882, 1.5654734775350665,
+            2.5352332550904508, 1.5650607000396455, 2.534050752600054, 1.5639410649559797,
+            2.5314084806032637, 1.5615944511936688, 2.5258903161505124, 1.5565138139836707,
+            2.5130680261717013, 1.5433451651274688, 2.4740178329183573, 1.4922199472778825,
+            2.2501977014657686, 0.91354766574874646, 1.6196056249559743,
+        },
+        { // order 31
+            1.4797080469730495, 1.3894638426728525, 2.41701074744608, 1.5276749546078736,
+            2.499833351124515, 1.5517987368980362, 2.5211858104626383, 1.5597339428131525,
+            2.5294506097125002, 1.5631683942980432, 2.5333055693003437, 1.5648411929198027,
+            2.5352019824026337, 1.5656353600646993, 2.5360013801997532, 1.5658721277368837,
+            2.5360013801997532, 1.5656353600646993, 2.5352019824026337, 1.5648411929198029,
+            2.5333055693003437, 1.5631683942980434, 2.529450609712498, 1.5597339428131525,
+            2.5211858104626383, 1.5517987368980377, 2.4998333511245159, 1.5276749546078725,
+            2.4170107474460818, 1.3894638426728549, 1.4797080469730353, 1,
+        },
+        { // order 32
+            1.479817989835825, 1.3895679041711559, 2.4171946724290971, 1.5277940271405166,
+            2.5000345648736761, 1.5519288021693121, 2.5214077366278755, 1.559879400277788,
+            2.5297027990598289, 1.5633365880928289, 2.5336026468005453, 1.5650432740101097,
+            2.5355664836256242, 1.5658889185752387, 2.5364698493872724, 1.5662065703091874,
+            2.5366369711157652, 1.5661033836284806, 2.5361225005806851, 1.5655456146582276,
+            2.5347528898862888, 1.5643330745220243, 2.5319887317746277, 1.5619251749194141,
+            2.5263894509428582, 1.5568035191878367, 2.5135126175246056, 1.5436069907090084,
+            2.474423800130924, 1.4924588030464538, 2.2505519938538838, 0.91369032499874681,
+            1.6196056249559743,
+        },
+    },
+    { // 0.5 dB
+        { // order 1
+            0.69866068014103089, 1,
+        },
+        { // order 2
+            1.4029445212706784, 0.70708415248999335, 1.9841266648817057,
+        },
+        { // order 3
+            1.5963313676596731, 1.0966806948962542, 1.5963313676596727, 1,
+        },
+        { // order 4
+            1.6703569381390653, 1.1925497642784892, 2.366169786503344, 0.8418600322770482,
+            1.9841266648817057,
+        },
+        { // order 5
+            1.7058213827945443, 1.2296101340704062, 2.5408809032568787, 1.229610134070406,
+            1.7058213827945448, 1,
+        },
+        { // order 6
+            1.7254145985935831, 1.2478510497222519, 2.6064192337604246, 1.3136355051787072,
+            2.4758945415545481, 0.86960909761094041, 1.9841266648817057,
+        },
+        { // order 7
+            1.7373422467934556, 1.2582185672712796, 2.6383448949516395, 1.3443123879604177,
+            2.6383448949516399, 1.2582185672712802, 1.7373422467934529, 1,
+        },
+        { // order 8
+            1.7451298854968307, 1.2646965504519643, 2.6564697168155313, 1.3590230672564945,
+            2.6964739059329368, 1.3388609526972461, 2.5093181487356548, 0.8795456038089573,
+            1.9841266648817057,
+        },
+        { // order 9
+            1.750490171376375, 1.2690246691605296, 2.6678326719715049, 1.3673030272489619,
+            2.7239558273925009, 1.3673030272489619, 2.6678326719715044, 1.2690246691605302,
+            1.7504901713763739, 1,
+        },
+        { // order 10
+            1.7543349265421591, 1.2720644106963412, 2.6754663975869928, 1.3724724338163634,
+            2.7392756492897301, 1.3805951493792592, 2.7231591527501386, 1.3484352813465694,
+            2.5239369167096433, 0.88418494524227065, 1.9841266648817057,
+        },
+        { // order 11
+            1.7571853027459088, 1.2742834714478537, 2.6808623634458737, 1.3759405770880313,
+            2.7487800668588007, 1.3879398874780584, 2.7487800668588007, 1.3759405770880315,
+            2.6808623634458746, 1.2742834714478537, 1.7571853027459108, 1,
+        },
+        { // order 12
+            1.7593564955427432, 1.2759542192027011, 2.6848281432104248, 1.3783930638223225,
+            2.7551316058834026, 1.3924670213827002, 2.7628309470938217, 1.3885865527882832,
+            2.734906432617862, 1.3531536018999542, 2.5316547894883987, 0.88671581642578134,
+            1.9841266648817057,
+        },
+        { // order 13
+            1.7610481388247239, 1.2772442979298013, 2.6878340891601211, 1.3801982538227044,
+            2.7596131101817187, 1.3954782497169609, 2.771439768439202, 1.3954782497169609,
+            2.7596131101817192, 1.3801982538227044, 2.687834089160122, 1.2772442979297991,
+            1.761048138824729, 1,
+        },
+        { // order 14
+            1.7623916186036277, 1.2782616232080233, 2.6901702578492115, 1.3815695405216653,
+            2.7629084410995581, 1.3975959648170728, 2.7771392354407953, 1.3996783998698843,
+            2.7730074205246273, 1.3925060783678773, 2.7412089647374009, 1.3558460281111131,
+            2.5362329713020126, 0.88824551869459745, 1.9841266648817057,
+        },
+        { // order 15
+            1.7634762522505667, 1.2790782847891549, 2.6920239356644657, 1.3826380549224684,
+            2.7654112896586249, 1.3991497469452709, 2.7811332241611053, 1.4024470280402634,
+            2.7811332241611049, 1.3991497469452709, 2.7654112896586249, 1.3826380549224675,
+            2.6920239356644671, 1.2790782847891553, 1.7634762522505636, 1,
+        },
+        { // order 16
+            1.7643644659475775, 1.2797439648333981, 2.6935207072678962, 1.3834882868390241,
+            2.7673623889434751, 1.4003282476799657, 2.7840558057882618, 1.4043803757314341,
+            2.7864685511253304, 1.4031643518858941, 2.7784286158088962, 1.394750868442395,
+            2.7450160004688202, 1.3575346548898295, 2.5391741248473823, 0.88923983391592998,
+            1.9841266648817057,
+        },
+        { // order 17
+            1.7651009510306845, 1.280293825881585, 2.6947474871446691, 1.3841768310830111,
+            2.7689162552675497, 1.4012462636009648, 2.7862681649603087, 1.4057911363302369,
+            2.7901819593827017, 1.4057911363302364, 2.78626816496031, 1.4012462636009637,
+            2.7689162552675524, 1.3841768310830103, 2.6947474871446686, 1.2802938258815839,
+            1.7651009510306845, 1,
+        },
+        { // order 18
+            1.7657183808324204, 1.2807533327132108, 2.695766063061718, 1.3847428464579399,
+            2.7701760906753066, 1.4019771774955982, 2.787989139862574, 1.406856718158503,
+            2.7928842130939207, 1.4076138698838716, 2.7913819281662557, 1.4051467525783148,
+            2.7817003014246113, 1.3961689743434114, 2.7475052056613913, 1.3586663143919986,
+            2.5411768385723916, 0.88992220712768544, 1.9841266648817057,
+        },
+        { // order 19
+            1.7662410885001019, 1.281141300625861, 2.6966213857095074, 1.3852141817802055,
+            2.7712131501630211, 1.4025698359801135, 2.7893580904478514, 1.4076842164945473,
+            2.7949207050498379, 1.4089368472995958, 2.7949207050498375, 1.4076842164945473,
+            2.7893580904478514, 1.402569835980114, 2.7712131501630188, 1.3852141817802075,
+            2.6966213857095052, 1.2811413006258658, 1.7662410885000936, 1,
+        },
+        { // order 20
+            1.7666874961796168, 1.2814718795908602, 2.6973468196794657, 1.3856111144062144,
+            2.7720780325993752, 1.4030578708627863, 2.7904674733038846, 1.4083416035070537,
+            2.7964992953809258, 1.4099316940817248, 2.7974830698893864, 1.4094358716496831,
+            2.7943281287806041, 1.4063958328337134, 2.7838445339510089, 1.397127553227377,
+            2.7492279592498274, 1.3594630158555332, 2.5426025265923062, 0.89041064134126136,
+            1.9841266648817057,
+        },
+        { // order 21
+            1.7670717573829473, 1.2817558792773027, 2.6979675699306562, 1.3859487133293922,
+            2.7728075439784625, 1.403465110411154, 2.7913807639443857, 1.4088738384420143,
+            2.7977515313518695, 1.4107014311391943, 2.799405894983122, 1.4107014311391943,
+            2.797751531351869, 1.4088738384420143, 2.7913807639443844, 1.4034651104111542,
+            2.7728075439784634, 1.3859487133293942, 2.6979675699306522, 1.2817558792773016,
+            1.7670717573829544, 1,
+        },
+        { // order 22
+            1.7674048907806807, 1.2820016741968099, 2.6985029765469619, 1.3862383789783554,
+            2.7734290211814066, 1.4038088561384487, 2.792142824135472, 1.4093117043950318,
+            2.798764191629143, 1.4113110973124192, 2.800890962098137, 1.4116492720312925,
+            2.8002199806210313, 1.4105773795424528, 2.7962529318200668, 1.4072402097886922,
+            2.7853345838613848, 1.3978084515822771, 2.750472531613346, 1.3600457190105073,
+            2.5436537061968889, 0.89077220827837245, 1.9841266648817057,
+        },
+        { // order 23
+            1.7676955777007497, 1.2822158346460524, 2.6989680872028412, 1.3864888735497902,
+            2.773963141521206, 1.4041019401542878, 2.7927861591317673, 1.4096769052120723,
+            2.7995965474664928, 1.4118034981449326, 2.8020653956189792, 1.4123800706260898,
+            2.8020653956189792, 1.411803498144933, 2.799596547466491, 1.4096769052120735,
+            2.7927861591317642, 1.40410194015429, 2.7739631415212007, 1.3864888735497918,
+            2.6989680872028416, 1.2822158346460544, 1.7676955777007362, 1,
+        },
+        { // order 24
+            1.7679507326519999, 1.2824035745618387, 2.6993747568630182, 1.3867070267570341,
+            2.7744257984049243, 1.4043540580071934, 2.7933348343873483, 1.4099851332710081,
+            2.8002902953521795, 1.4122078073018718, 2.8030126964545139, 1.4129571427086518,
+            2.803485943183305, 1.4127186263189637, 2.8019991668217732, 1.4113465359426183,
+            2.7975891000097959, 1.4078409830523015, 2.7864163334269043, 1.3983108273837621,
+            2.7514023881674667, 1.3604850963604949, 2.5444511274277568, 0.89104731262577896,
+            1.9841266648817057,
+        },
+        { // order 25
+            1.7681759177887661, 1.2825690746632152, 2.6997324310062654, 1.3868982293892891,
+            2.7748293837207929, 1.4045726561451026, 2.7938070059044326, 1.4102479847639258,
+            2.8008755218297101, 1.412544506756781, 2.8037896659803905, 1.4134220057954106,
+            2.8046060660924916, 1.4134220057954106, 2.8037896659803905, 1.4125445067567808,
+            2.800875521829711, 1.4102479847639255, 2.7938070059044331, 1.4045726561451017,
+            2.7748293837207965, 1.3868982293892893, 2.6997324310062649, 1.2825690746632115,
+            1.768175917788771, 1,
+        },
+        { // order 26
+            1.7683756482513155, 1.2827157190971665, 2.700048712683603, 1.3870667849413978,
+            2.7751836833359573, 1.4047635372670959, 2.7942166007565739, 1.410474194022673,
+            2.801374419341855, 1.4128283479916519, 2.8044361113861336, 1.4138028555131141,
+            2.8055072443519316, 1.4139758786615535, 2.8051639445094718, 1.4134360275599291,
+            2.8032303981510109, 1.41189293452133, 2.7985594584879228, 1.4082853933738955,
+            2.7872287921451968, 1.3986928014504612, 2.7521161939739649, 1.3608247701487239,
+            2.5450704617236055, 0.89126147012229828, 1.9841266648817057,
+        },
+        { // order 27
+            1.7685536200172383, 1.2828462711023756, 2.7003297792188179, 1.3872161643409446,
+            2.7754965143472168, 1.4049312821926234, 2.7945744607513867, 1.410670451420319,
+            2.8018036759524572, 1.4130701933565148, 2.8049806542960329, 1.4141194205087713,
+            2.806244733759113, 1.4144209470335809, 2.806244733759113, 1.414119420508771,
+            2.8049806542960334, 1.4130701933565148, 2.8018036759524567, 1.4106704514203188,
+            2.7945744607513867, 1.4049312821926245, 2.7754965143472123, 1.3872161643409457,
+            2.700329779218817, 1.2828462711023785, 1.768553620017242, 1,
+        },
+        { // order 28
+            1.7687128819453144, 1.2829630050314749, 2.7005806925876281, 1.3873491932800386,
+            2.7757741863183139, 1.4050795495479631, 2.7948891377803022, 1.4108419588018566,
+            2.8021760557033106, 1.413278198191539, 2.8054443372886464, 1.4143858644583243,
+            2.8068571433508347, 1.4147847786890462, 2.8071122044656982, 1.4146562278664712,
+            2.8063207081035224, 1.413944173496559, 2.8041229579278037, 1.4122969593125132,
+            2.7992891503927, 1.4086243520883959, 2.787855800538086, 1.3989904150014589,
+            2.7526765278890442, 1.3610928880634956, 2.5455611083397165, 0.89143143593141705,
+            1.9841266648817057,
+        },
+        { // order 29
+            1.7688559671010642, 1.2830678067103027, 2.7008056334775259, 1.387468191882588,
+            2.7760218402755736, 1.4052112923532027, 2.795167457751278, 1.4109928149912578,
+            2.8025014698018285, 1.4134585912504127, 2.8058429357887786, 1.4146125856367473,
+            2.8073721543785086, 1.415086612604638, 2.8078205977990605, 1.4150866126046378,
+            2.8073721543785091, 1.4146125856367475, 2.8058429357887777, 1.4134585912504136,
+            2.8025014698018276, 1.4109928149912592, 2.7951674577512748, 1.4052112923532039,
+            2.7760218402755741, 1.3874681918825893, 2.7008056334775272, 1.2830678067102999,
+            1.7688559671010757, 1,
+        },
+        { // order 30
+            1.7689849940146245, 1.2831622505333471, 2.7010080798068397, 1.3875750801439215,
+            2.7762437013497245, 1.4053289170052259, 2.7954149274593862, 1.4111262886317475,
+            2.8027877187766048, 1.4136162028163222, 2.8061884821395586, 1.414807369060407,
+            2.8078100630032123, 1.415340226027705, 2.8084077269204593, 1.4154377221113006,
+            2.8082142823412752, 1.415136499448542, 2.8071570266238899, 1.4143192225617613,
+            2.8047936019166952, 1.4126052375510534, 2.7998532967898102, 1.4088893501292907,
+            2.788350577159401, 1.3992270506153621, 2.7531247160389265, 1.3613082912566312,
+            2.5459564366528395, 0.89156858043641718, 1.9841266648817057,
+        },
+        { // order 31
+            1.769101745487486, 1.2832476592663358, 2.7011909443113713, 1.3876714584471832,
+            2.7764432694643859, 1.4054344016358784, 2.7956360327929737, 1.4112450147057833,
+            2.8030410168541295, 1.4137548300252685, 2.8064902954945374, 1.4149761450800991,
+            2.8081860460608303, 1.4155557089678479, 2.8089006417493851, 1.4157284638014509,
+            2.8089006417493851, 1.4155557089678479, 2.8081860460608303, 1.4149761450800993,
+            2.8064902954945383, 1.4137548300252682, 2.8030410168541278, 1.4112450147057831,
+            2.7956360327929741, 1.4054344016358793, 2.7764432694643877, 1.3876714584471816,
+            2.701190944311374, 1.2832476592663375, 1.7691017454874689, 1,
+        },
+        { // order 32
+            1.7692077304611733, 1.2833251508550654, 2.7013566816118786, 1.3877586696983906,
+            2.7766234649443327, 1.4055293853670709, 2.7958344604403553, 1.4113511383472515,
+            2.8032663690607098, 1.4138774946023414, 2.8067556932705644, 1.4151235013800179,
+            2.8085116513242192, 1.4157405980844271, 2.8093191324335565, 1.4159723506117692,
+            2.8094684975840449, 1.4158970705638101, 2.8090086712148925, 1.4154901000192228,
+            2.8077842731888638, 1.4146050970177837, 2.8053120379166518, 1.412846477333056,
+            2.8002994271059367, 1.4091007947857201, 2.7887483317816049, 1.3994184514978381,
+            2.7534889809693466, 1.3614839865946418, 2.5462796515248702, 0.89168083962353728,
+            1.9841266648817057,
+        },
+    },
+    { // 1 dB
+        { // order 1
+            1.0177526330028934, 1,
+        },
+        { // order 2
+            1.8220103809989037, 0.68500212595653487, 2.6598609142338852,
+        },
+        { // order 3
+            2.0236704487879695, 0.9940829985672589, 2.0236704487879691, 1,
+        },
+        { // order 4
+            2.0991296207310608, 1.0644177836928255, 2.831203259260004, 0.78918773891441207,
+            2.6598609142338852,
+        },
+        { // order 5
+            2.1349600024218094, 1.091082844943452, 3.0010088500577523, 1.0910828449434518,
+            2.1349600024218094, 1,
+        },
+        { // order 6
+            2.1546683022275479, 1.1041080823810661, 3.0635066445644492, 1.1517544500806445,
+            2.9367739334151248, 0.81006803427094054, 2.6598609142338852,
+        },
+        { // order 7
+            2.1666360155192312, 1.1114836257637342, 3.0937276436028913, 1.1734916356965208,
+            3.0937276436028913, 1.1114836257637346, 2.1666360155192277, 1,
+        },
+        { // order 8
+            2.1744376482946657, 1.1160823894126142, 3.1108231765375316, 1.1838395092824523,
+            3.1488484394662182, 1.1695435501497027, 2.9686239246633748, 0.81750050788688244,
+            2.6598609142338852,
+        },
+        { // order 9
+            2.1798020067970949, 1.1191509049380899, 3.121519248864169, 1.189643170450575,
+            3.1747193364808459, 1.189643170450575, 3.121519248864169, 1.1191509049380901,
+            2.1798020067970936, 1,
+        },
+        { // order 10
+            2.1836468994732634, 1.1213041041445706, 3.1286960065237066, 1.1932593540161287,
+            3.1890900995617435, 1.1989687440030274, 3.1739039162914731, 1.1762630105134131,
+            2.9825129595841826, 0.82096281342673816, 2.6598609142338852,
+        },
+        { // order 11
+            2.1864958797437661, 1.1228750056144146, 3.1337647738058321, 1.1956824761981517,
+            3.1979880828602347, 1.2041035461627043, 3.1979880828602343, 1.1956824761981522,
+            3.1337647738058325, 1.1228750056144148, 2.1864958797437679, 1,
+        },
+        { // order 12
+            2.1886651547726093, 1.1240572170662728, 3.1374879317300688, 1.1973945978406391,
+            3.2039271317997859, 1.2072622778154922, 3.2111497459903968, 1.2045468673397188,
+            3.1849030897111157, 1.1795684183861752, 2.989835857037094, 0.82284947421884613,
+            2.6598609142338852,
+        },
+        { // order 13
+            2.1903547923396416, 1.1249697598864046, 3.140308795138711, 1.198654124891203,
+            3.2081142427731097, 1.2093607648666995, 3.2191978678233002, 1.2093607648666995,
+            3.2081142427731097, 1.1986541248912033, 3.1403087951387114, 1.1249697598864028,
+            2.1903547923396478, 1,
+        },
+        { // order 14
+            2.1916963602970445, 1.125689180863346, 3.1425004310504003, 1.199610518517082,
+            3.2111913959884526, 1.2108353982275994, 3.2245196746223503, 1.2122888296026204,
+            3.2206537493164107, 1.2072779365282595, 3.1907971305074287, 1.1814529151632454,
+            2.9941766537543746, 0.82398908475570487, 2.6598609142338852,
+        },
+        { // order 15
+            2.1927792446414522, 1.1262665792599087, 3.1442390044883264, 1.2003555197221702,
+            3.2135276014601439, 1.2119167505861801, 3.2282460462584823, 1.2142165995168819,
+            3.2282460462584819, 1.2119167505861801, 3.2135276014601435, 1.2003555197221694,
+            3.1442390044883273, 1.1262665792599091, 2.1927792446414487, 1,
+        },
+        { // order 16
+            2.1936658889500804, 1.1267371520428691, 3.1456425651944953, 1.2009481893417571,
+            3.215348250799956, 1.2127366007158955, 3.2309713007951224, 1.2155617019723088,
+            3.2332250599157648, 1.2147143798027242, 3.2257106835050786, 1.2088407456169803,
+            3.1943551488500979, 1.1826342303693451, 2.996964111334032, 0.82472954777859697,
+            2.6598609142338852,
+        },
+        { // order 17
+            2.1944009793143491, 1.1271257990358432, 3.1467927709674894, 1.201428063580176,
+            3.216797894580619, 1.2133750499648279, 3.233033468880552, 1.2165426817905276,
+            3.2366877223059261, 1.2165426817905274, 3.2330334688805529, 1.2133750499648275,
+            3.2167978945806213, 1.2014280635801757, 3.1467927709674877, 1.1271257990358428,
+            2.1944009793143477, 1,
+        },
+        { // order 18
+            2.1950171746178064, 1.127450546377099, 3.1477476488137452, 1.2018224845142789,
+            3.2179730182617483, 1.2138832610229977, 3.2346371389680999, 1.217283346750099,
+            3.239206124616719, 1.2178103401131037, 3.2378043955684017, 1.2160925865177301,
+            3.2287606404378399, 1.2098275518998767, 3.196680652406986, 1.1834256565706121,
+            2.9988616410400804, 0.82523757647306772, 2.6598609142338852,
+        },
+        { // order 19
+            2.1955387906802022, 1.1277247092660505, 3.1485493994443154, 1.2021508894709771,
+            3.218940206876308, 1.2142952688603501, 3.2359124922381199, 1.2178583554707696,
+            3.24110331128011, 1.2187299278468411, 3.24110331128011, 1.2178583554707696,
+            3.2359124922381204, 1.2142952688603501, 3.2189402068763062, 1.2021508894709785,
+            3.1485493994443137, 1.1277247092660545, 2.195538790680192, 1,
+        },
+        { // order 20
+            2.1959842323535206, 1.1279582989210515, 3.1492293377196137, 1.2024274266619217,
+            3.2197467247115052, 1.2146344958924571, 3.2369458429876459, 1.2183150553669746,
+            3.242573486963233, 1.2194211623679809, 3.2434906877722449, 1.2190763320033164,
+            3.2405485969933072, 1.21696056574446, 3.2307588207045272, 1.2104943937036199,
+            3.1982897143808788, 1.1839827116023016, 3.0002121921858476, 0.82560115102335241,
+            2.6598609142338852,
+        },
+        { // order 21
+            2.196367637142334, 1.1281589617085133, 3.1498111147596393, 1.2026626074665758,
+            3.2204269413335553, 1.2149175306239699, 3.2377964215195156, 1.2186847447799307,
+            3.243739460224023, 1.2199558302833053, 3.2452814928272105, 1.2199558302833053,
+            3.243739460224023, 1.2186847447799305, 3.2377964215195152, 1.2149175306239699,
+            3.2204269413335562, 1.2026626074665778, 3.149811114759633, 1.1281589617085128,
+            2.1963676371423411, 1,
+        },
+        { // order 22
+            2.1967000094432216, 1.1283326204240836, 3.1503128748838756, 1.2028643825072991,
+            3.2210063774138242, 1.2151564140936555, 3.238506073376854, 1.2189888432118088,
+            3.2446821963947672, 1.2203792163057037, 3.2466641903407067, 1.2206142708314649,
+            3.2460389779949197, 1.2198691213631854, 3.2423407789462657, 1.2175471491935639,
+            3.232147050528321, 1.2109679721135211, 3.1994519561552397, 1.1843900777012071,
+            3.0012078353211273, 0.82587025422565474, 2.6598609142338852,
+        },
+        { // order 23
+            2.1969900181070274, 1.1284839211564026, 3.1507487330885051, 1.20303886138056,
+            3.2215043323503303, 1.2153600745683777, 3.2391051090508993, 1.2192424469589582,
+            3.2454569702143994, 1.2207211069743684, 3.2477574221843288, 1.2211217888470911,
+            3.2477574221843288, 1.2207211069743686, 3.2454569702143985, 1.2192424469589587,
+            3.2391051090508975, 1.2153600745683788, 3.2215043323503258, 1.2030388613805609,
+            3.150748733088506, 1.1284839211564044, 2.1969900181070092, 1,
+        },
+        { // order 24
+            2.1972445668534899, 1.1286165503888639, 3.1511298079898049, 1.2031908054750307,
+            3.2219356377444996, 1.2155352565424444, 3.2396159634301549, 1.2194564676670081,
+            3.2461026521733656, 1.2210017935463353, 3.2486390714477662, 1.2215224586361786,
+            3.2490798435852533, 1.221356746160339, 3.2476949468633731, 1.2204031552184862,
+            3.2435845949571962, 1.2179644229116589, 3.2331547187505087, 1.2113173363700132,
+            3.2003201958486267, 1.1846972114695762, 3.0019630495368146, 0.82607498576155791,
+            2.6598609142338852,
+        },
+        { // order 25
+            2.1974692085595064, 1.1287334637424637, 3.1514649573041602, 1.203323972514607,
+            3.2223118558298802, 1.2156871390496027, 3.2400555588000288, 1.2196389666965664,
+            3.2466472812173413, 1.22123551664108, 3.2493620935061767, 1.2218451636530436,
+            3.2501223592328734, 1.2218451636530436, 3.2493620935061762, 1.22123551664108,
+            3.2466472812173417, 1.2196389666965666, 3.2400555588000284, 1.2156871390496022,
+            3.2223118558298829, 1.2033239725146079, 3.1514649573041571, 1.1287334637424611,
+            2.1974692085595109, 1,
+        },
+        { // order 26
+            2.1976684504072121, 1.1288370534544736, 3.1517613102152686, 1.2034413619595139,
+            3.2226421160923979, 1.2158197572789828, 3.2404368735891778, 1.2197960146586146,
+            3.2471115343120114, 1.221432529531471, 3.2499635865624761, 1.2221095103894117,
+            3.2509609532445718, 1.2222296796977212, 3.250641319598309, 1.2218547102108739,
+            3.2488406446745879, 1.2207824540507108, 3.2444877427287144, 1.2182730518909526,
+            3.2339114511397002, 1.2115829436219252, 3.2009866412485009, 1.1849346307354063,
+            3.0025495570225056, 0.82623434881376545, 2.6598609142338852,
+        },
+        { // order 27
+            2.197845981550925, 1.1289292726757145, 3.15202465850281, 1.2035453927393707,
+            3.222933710471406, 1.2159362963132736, 3.2407700096023575, 1.2199322607422685,
+            3.2475109567224445, 1.2216003804233715, 3.2504702165170816, 1.2223292126046803,
+            3.2516471308124832, 1.2225386062835373, 3.2516471308124837, 1.2223292126046799,
+            3.2504702165170829, 1.221600380423371, 3.2475109567224454, 1.2199322607422676,
+            3.2407700096023602, 1.2159362963132738, 3.2229337104714029, 1.2035453927393709,
+            3.1520246585028104, 1.128929272675717, 2.1978459815509304, 1,
+        },
+        { // order 28
+            2.1980048449944714, 1.1290117288722918, 3.1522597478227095, 1.2036380339363346,
+            3.2231925240671409, 1.2160392997416558, 3.2410629340046921, 1.2200513192119151,
+            3.2478574363490371, 1.2217447352719715, 3.2509015833081421, 1.2225141128250392,
+            3.2522168672046474, 1.2227911105556908, 3.2524542812397241, 1.2227018524919304,
+            3.2517175058026329, 1.2222073590056479, 3.2496710685209393, 1.2210628830133825,
+            3.2451668173312602, 1.2185084252565932, 3.2344954035551687, 1.2117898747331746,
+            3.2015097613525692, 1.1851220230929462, 3.0030141693390391, 0.82636081955719709,
+            2.6598609142338852,
+        },
+        { // order 29
+            2.1981475687711534, 1.1290857548163522, 3.152470497330027, 1.2037209022006812,
+            3.2234233516374431, 1.2161308203944046, 3.2413220052870124, 1.220156037586827,
+            3.2481602027231284, 1.2218699207844101, 3.2512723778384656, 1.2226714351926182,
+            3.2526959477598734, 1.2230005640192445, 3.2531133243787687, 1.2230005640192443,
+            3.2526959477598738, 1.2226714351926184, 3.2512723778384647, 1.2218699207844106,
+            3.2481602027231284, 1.2201560375868279, 3.2413220052870098, 1.2161308203944055,
+            3.223423351637444, 1.2037209022006823, 3.1524704973300288, 1.1290857548163493,
+            2.1981475687711685, 1,
+        },
+        { // order 30
+            2.1982762670766913, 1.1291524631137337, 3.1526601671636922, 1.2037953352820898,
+            3.223630133432561, 1.216212530967038, 3.2415523526630521, 1.2202486863976612,
+            3.2484265189518231, 1.2219792917521204, 3.2515938033416782, 1.2228065872096407,
+            3.2531032739650887, 1.2231765393519802, 3.2536594898905089, 1.2232442202067735,
+            3.2534794682302022, 1.2230351055412496, 3.2524954469866554, 1.2224676057087087,
+            3.2502949561346743, 1.2212768350285939, 3.2456917865943797, 1.2186924268544732,
+            3.2349561745206938, 1.2119543981347836, 3.201928161053905, 1.1852725645512723,
+            3.0033885028471423, 0.82646286326962359, 2.6598609142338852,
+        },
+        { // order 31
+            2.1983927189698815, 1.1292127884959129, 3.1528314875129921, 1.2038624481725309,
+            3.2238161331719195, 1.2162858063632791, 3.2417581540884015, 1.2203310958347211,
+            3.2486621705007899, 1.222075485082003, 3.2518745355600216, 1.2229236874205027,
+            3.2534529769202027, 1.2233260455855122, 3.2541179722121591, 1.2234459608741417,
+            3.2541179722121591, 1.2233260455855124, 3.2534529769202019, 1.2229236874205032,
+            3.2518745355600216, 1.2220754850820033, 3.2486621705007863, 1.2203310958347213,
+            3.2417581540884006, 1.2162858063632804, 3.2238161331719208, 1.20386244817253,
+            3.1528314875129948, 1.1292127884959147, 2.198392718969858, 1,
+        },
+        { // order 32
+            2.1984984301517718, 1.1292675209194212, 3.1529867590437863, 1.2039231764269831,
+            3.2239840739281624, 1.2163517857817778, 3.2419428429253903, 1.2204047557282045,
+            3.2488718166264752, 1.222160598973423, 3.2521213858564222, 1.2230259214471439,
+            3.2537558068995125, 1.2234543170174366, 3.2545071995741743, 1.223615174185861,
+            3.2546461758804601, 1.2235629247221607, 3.2542183181853939, 1.2232804315020678,
+            3.2530788455521416, 1.2226659553712502, 3.2507772081260828, 1.2214442489231583,
+            3.2461069093066044, 1.2188392353812838, 3.2353265729595386, 1.2120874654292808,
+            3.202268200718442, 1.1853953498737493, 3.003694540607357, 0.82654638758996812,
+            2.6598609142338852,
+        },
+    },
+    { // 2 dB
+        { // order 1
+            1.5296639600312838, 1,
+        },
+        { // order 2
+            2.4882580925153368, 0.60752728114419574, 4.0957141674840303,
+        },
+        { // order 3
+            2.7108149822133907, 0.83263808433293107, 2.7108149822133902, 1,
+        },
+        { // order 4
+            2.792591811428399, 0.88054821377334491, 3.6064737943042435, 0.68183269076705855,
+            4.0957141674840303,
+        },
+        { // order 5
+            2.8311491112428309, 0.89842940968940899, 3.7828803970495746, 0.89842940968940876,
+            2.8311491112428313, 1,
+        },
+        { // order 6
+            2.8522838573153821, 0.90711160572956284, 3.8468207420132243, 0.93923076286749274,
+            3.7152698550757588, 0.69640696119854573, 4.0957141674840303,
+        },
+        { // order 7
+            2.8650925680384218, 0.91201347660721332, 3.8775591290429254, 0.9536287207292834,
+            3.8775591290429254, 0.91201347660721366, 2.8650925680384178, 1,
+        },
+        { // order 8
+            2.8734322434752491, 0.91506479686441877, 3.8948981740119279, 0.96044317536103807,
+            3.9337007203895547, 0.9509692363138067, 3.7478438526834972, 0.70157050174240598,
+            4.0957141674840303,
+        },
+        { // order 9
+            2.8791619051788966, 0.91709868143459727, 3.9057294223376546, 0.96425439674629421,
+            3.9598991416102356, 0.96425439674629432, 3.9057294223376537, 0.91709868143459772,
+            2.8791619051788944, 1,
+        },
+        { // order 10
+            2.8832663015950475, 0.91852489043931895, 3.9129897760112753, 0.96662540680187292,
+            3.9744112469400044, 0.97038296238857313, 3.9590213732884467, 0.95538643958032787,
+            3.7620154069590357, 0.70397156239206493, 4.0957141674840303,
+        },
+        { // order 11
+            2.8863063174676968, 0.91956490209531072, 3.9181142680302523, 0.96821264159228615,
+            3.9833827673196875, 0.97374805791596208, 3.9833827673196862, 0.9682126415922867,
+            3.9181142680302519, 0.91956490209531128, 2.8863063174676986, 1,
+        },
+        { // order 12
+            2.8886203379700248, 0.92034730673987475, 3.9218766588187162, 0.96933343578381881,
+            3.9893651871405069, 0.97581492161376793, 3.9966589992958292, 0.97403408148258208,
+            3.9701126859557583, 0.95755624011914331, 3.7694795032202784, 0.70527879140171701,
+            4.0957141674840303,
+        },
+        { // order 13
+            2.8904222903300791, 0.92095108059487707, 3.9247263122950726, 0.97015758932468599,
+            3.9935802321560425, 0.97718672528971806, 4.0047646012628579, 0.97718672528971828,
+            3.9935802321560425, 0.9701575893246861, 3.9247263122950735, 0.9209510805948754,
+            2.890422290330088, 1,
+        },
+        { // order 14
+            2.8918527699918752, 0.92142697997833445, 3.9269397711164706, 0.9707831931329115,
+            3.9966765705877223, 0.97815010702645855, 4.0101193243029902, 0.97910136311254814,
+            4.0062232512742879, 0.97581921177933506, 3.9760504776698515, 0.95879243778595002,
+            3.7739015361992929, 0.70606801445041478, 4.0957141674840303,
+        },
+        { // order 15
+            2.8930072503176718, 0.92180886917549409, 3.9286953227435388, 0.97127040351094551,
+            3.999026605991876, 0.97885625226978545, 4.013866406208602, 0.98036072014165898,
+            4.0138664062086011, 0.97885625226978557, 3.9990266059918746, 0.97127040351094518,
+            3.9286953227435388, 0.92180886917549476, 2.893007250317666, 1,
+        },
+        { // order 16
+            2.8939524019135265, 0.92212006385054757, 3.9301123778902132, 0.97165792245749694,
+            4.0008576058279699, 0.97939146473159133, 4.0166056263162808, 0.98123888980582097,
+            4.0188740226640043, 0.98068504345449792, 4.0113074976141165, 0.97684004357307652,
+            3.9796331189572718, 0.9595670540418727, 3.7767402096339673, 0.70658065567384531,
+            4.0957141674840303,
+        },
+        { // order 17
+            2.8947359210711574, 0.92237705288916338, 3.9312735026307832, 0.97197164475456632,
+            4.0023152301418801, 0.9798081590691029, 4.0186777193544092, 0.98187906107081357,
+            4.0223544097026513, 0.98187906107081335, 4.0186777193544101, 0.97980815906910257,
+            4.0023152301418818, 0.97197164475456621, 3.9312735026307806, 0.92237705288916305,
+            2.8947359210711556, 1,
+        },
+        { // order 18
+            2.8953926578317715, 0.92259177006977366, 3.9322373506256025, 0.97222947150097538,
+            4.0034966573533568, 0.98013979260050788, 4.0202887362191175, 0.98236225716641878,
+            4.0248846145529802, 0.9827064218754884, 4.0234750142780955, 0.98158430296144183,
+            4.0143724346687621, 0.97748438822640682, 3.9819740204720553, 0.96008588241916903,
+            3.7786721834789398, 0.70693230519316097, 4.0957141674840303,
+        },
+        { // order 19
+            2.8959485539435033, 0.92277302840366981, 3.9330465672519215, 0.9724441245398554,
+            4.0044689250831551, 0.98040861139510793, 4.0215697065251073, 0.98273729588427017,
+            4.0267901027156316, 0.98330634999844568, 4.0267901027156316, 0.98273729588427017,
+            4.0215697065251081, 0.98040861139510815, 4.0044689250831516, 0.97244412453985674,
+            3.9330465672519179, 0.92277302840367337, 2.895948553943489, 1,
+        },
+        { // order 20
+            2.8964232414571423, 0.92292745282196376, 3.9337327905717738, 0.97262486163148631,
+            4.0052796044054917, 0.98062991913100084, 4.0226074655992852, 0.98303511755034967,
+            4.0282663719848211, 0.9837571637630097, 4.0291881529880627, 0.98353210386733658,
+            4.0262308580852917, 0.98215043850834693, 4.0163798528435573, 0.9779197084121497,
+            3.9835934254312715, 0.96045100554178586, 3.7800470440828655, 0.70718393008279645,
+            4.0957141674840303,
+        },
+        { // order 21
+            2.8968317982704961, 0.92306010250601089, 3.9343199115543257, 0.9727785593860917,
+            4.0059632794574851, 0.98081455111067928, 4.0234615790600721, 0.98327616515055372,
+            4.0294369725686119, 0.98410578680036487, 4.0309864087423621, 0.98410578680036487,
+            4.029436972568611, 0.98327616515055372, 4.0234615790600703, 0.98081455111067961,
+            4.005963279457486, 0.97277855938609348, 3.9343199115543173, 0.92306010250601045,
+            2.8968317982705054, 1,
+        },
+        { // order 22
+            2.897185959256563, 0.92317489571294831, 3.9348262557730469, 0.97291041825644764,
+            4.0065456250438709, 0.98097037040671309, 4.024174116855721, 0.98347442398781471,
+            4.0303833205164024, 0.98438180157518607, 4.0323745401699602, 0.98453514461118186,
+            4.031746490924947, 0.98404897307378159, 4.0280301316850915, 0.9825329484180626,
+            4.0177742439568371, 0.97822881705269482, 3.9847629837457488, 0.96071798345004566,
+            3.7810604994371313, 0.70737015347833232, 4.0957141674840303,
+        },
+        { // order 23
+            2.8974949676825084, 0.92327490572950111, 3.9352660774068422, 0.9730244339134132,
+            4.0070460538562793, 0.9811032062183791, 4.0247755447039113, 0.9836397478944553,
+            4.0311609778991455, 0.98460465722382262, 4.0334718760214532, 0.98486601246161731,
+            4.0334718760214532, 0.98460465722382273, 4.0311609778991455, 0.98363974789445541,
+            4.0247755447039104, 0.98110320621837976, 4.0070460538562749, 0.97302443391341342,
+            3.9352660774068453, 0.9232749057295021, 2.8974949676824844, 1,
+        },
+        { // order 24
+            2.8977661840138484, 0.92336257083869977, 3.9356506034781331, 0.97312371991799407,
+            4.0074794824515596, 0.98121746124617715, 4.0252884079406144, 0.9837792575530917,
+            4.0318090058668297, 0.98478759811232819, 4.0343567140128878, 0.98512717664958982,
+            4.034799334177273, 0.98501910754459732, 4.033408517551238, 0.98439706507730651,
+            4.0292786428371237, 0.98280501112540197, 4.0187862574086841, 0.97845682549505719,
+            3.9856366063828998, 0.96091925425933, 3.781829163108537, 0.70751181979916167,
+            4.0957141674840303,
+        },
+        { // order 25
+            2.8980055280037886, 0.92343984575118432, 3.9359887772179185, 0.97321073325676055,
+            4.007857537894095, 0.98131651581133494, 4.0257297093727189, 0.9838982125896969,
+            4.0323555742432484, 0.98493991658505198, 4.0350822721911239, 0.98533749316776076,
+            4.0358456372598877, 0.98533749316776098, 4.035082272191123, 0.9849399165850522,
+            4.0323555742432484, 0.98389821258969723, 4.0257297093727171, 0.98131651581133483,
+            4.0078575378940977, 0.97321073325676144, 3.9359887772179141, 0.92343984575118243,
+            2.8980055280037922, 1,
+        },
+        { // order 26
+            2.8982178042664235, 0.92350831246011034, 3.9362877960424538, 0.9732874349469175,
+            4.0081893999142801, 0.98140300334365049, 4.0261124873878726, 0.9840005731245427,
+            4.0328214524818407, 0.98506830157902159, 4.0356858220461049, 0.98550975712583755,
+            4.0366871628723837, 0.98558810449218681, 4.0363662744540427, 0.98534361945604121,
+            4.0345581987166348, 0.9846442616768768, 4.030185088158599, 0.98300621643748187,
+            4.0195461848059724, 0.97863015728377378, 3.9863071363462765, 0.96107482970680314,
+            3.7824260791321476, 0.70762208634466095, 4.0957141674840303,
+        },
+        { // order 27
+            2.8984069451485048, 0.92356926250203841, 3.9365535067405588, 0.97335540633493578,
+            4.0084823999304993, 0.98147900226905438, 4.0264468892734913, 0.98408937160940435,
+            4.033222252865416, 0.9851776763764859, 4.0361941477956371, 0.98565291550182654,
+            4.0373756644114005, 0.98578942229885125, 4.0373756644114005, 0.98565291550182632,
+            4.036194147795638, 0.9851776763764859, 4.0332222528654151, 0.98408937160940424,
+            4.0264468892734913, 0.98147900226905516, 4.008482399930493, 0.97335540633493667,
+            3.936553506740557, 0.92356926250204063, 2.8984069451485128, 1,
+        },
+        { // order 28
+            2.8985761940629442, 0.92362375876295866, 3.9367906997356199, 0.97341593459526621,
+            4.0087424544471952, 0.98154617226163321, 4.0267409172650224, 0.98416696518927571,
+            4.033569912927943, 0.9852717359791463, 4.036626932578617, 0.98577338815996374,
+            4.0379472802210623, 0.98595395357519411, 4.0381855761448167, 0.98589577179931565,
+            4.0374460318155005, 0.98557339880441108, 4.0353914078713764, 0.98482700403034606,
+            4.0308665824954808, 0.9831596524077314, 4.02013256377169, 0.97876518978611771,
+            3.9868334341765372, 0.9611976174973087, 3.7828989141903131, 0.70770958995986621,
+            4.0957141674840303,
+        },
+        { // order 29
+            2.8987282453969772, 0.92367268244910639, 3.9370033309296351, 0.97347007645540595,
+            4.0089743834812728, 0.98160585267682954, 4.0270009572906114, 0.9842352107704101,
+            4.0338736996701492, 0.98535330163070944, 4.0369989273145528, 0.98587588620727939,
+            4.0384279065586925, 0.9860904210528787, 4.0388468021086501, 0.9860904210528787,
+            4.0384279065586925, 0.98587588620727984, 4.0369989273145501, 0.98535330163071033,
+            4.0338736996701474, 0.9842352107704111, 4.027000957290606, 0.98160585267683087,
+            4.0089743834812719, 0.9734700764554074, 3.9370033309296351, 0.92367268244910461,
+            2.898728245396994, 1,
+        },
+        { // order 30
+            2.8988653523635195, 0.92371676916136103, 3.9371946908635214, 0.9735187062912376,
+            4.0091821478038518, 0.98165913478102251, 4.0272321603099632, 0.98429558887018309,
+            4.0341409049678925, 0.98542456058437811, 4.0373213795025054, 0.98596393550120509,
+            4.0388365226281824, 0.9862050679151767, 4.0393947285003033, 0.9862491773886819,
+            4.0392140687047462, 0.9861128871473972, 4.0382264592606028, 0.98574295334251749,
+            4.036017333772171, 0.98496641611248748, 4.0313933883276496, 0.98327959316161428,
+            4.0205952259627562, 0.97887254428857318, 3.9872543576677519, 0.96129625502702076,
+            3.7832798581967726, 0.70778019017481231, 4.0957141674840303,
+        },
+        { // order 31
+            2.8989894109226686, 0.92375663687221565, 3.9373675350623096, 0.97356255284513726,
+            4.0093690279582619, 0.98170691550866618, 4.027438721715912, 0.98434929278982497,
+            4.0343773367096407, 0.9854872318798229, 4.0376029981759043, 0.98604022110235023,
+            4.0391873154012838, 0.98630246450640091, 4.0398546559270958, 0.98638061176754244,
+            4.0398546559270958, 0.98630246450640091, 4.0391873154012847, 0.98604022110235023,
+            4.0376029981759061, 0.98548723187982268, 4.0343773367096381, 0.98434929278982464,
+            4.0274387217159129, 0.98170691550866696, 4.0093690279582646, 0.97356255284513626,
+            3.9373675350623141, 0.92375663687221665, 2.8989894109226362, 1,
+        },
+        { // order 32
+            2.899102025653991, 0.92379280781992579, 3.9375241854476069, 0.97360222755561066,
+            4.0095377609252028, 0.98174993799068877, 4.0276240890009545, 0.98439729384939101,
+            4.0345876718647373, 0.98554268324977434, 4.0378506201708646, 0.98610681962387892,
+            4.039491076230747, 0.98638602339490855, 4.0402450868090218, 0.98649084659416642,
+            4.0403845364890429, 0.98645679888616744, 4.0399552106267622, 0.98627270142539714,
+            4.0388116717861413, 0.98587217150734119, 4.0365011304463279, 0.98507549767398828,
+            4.0318099428518916, 0.98337528555492393, 4.0209671299550322, 0.9789593699572624,
+            3.9875964368935297, 0.96137670365468919, 3.7835912908079137, 0.70783797577233831,
+            4.0957141674840303,
+        },
+    },
+    { // 3 dB
+        { // order 1
+            1.9953982082151065, 1,
+        },
+        { // order 2
+            3.1014453441927343, 0.53385922386765217, 5.8094816115073966,
+        },
+        { // order 3
+            3.3489310762912901, 0.71166752793726196, 3.3489310762912896, 1,
+        },
+        { // order 4
+            3.4391073438264042, 0.74830682379396674, 4.3472747325965528, 0.59198179352426838,
+            5.8094816115073966,
+        },
+        { // order 5
+            3.4814879225249173, 0.76188274252022081, 4.5377806810661392, 0.76188274252022059,
+            3.4814879225249182, 1,
+        },
+        { // order 6
+            3.5046816065625452, 0.76845639235884899, 4.6063435628110456, 0.79290096274456257,
+            4.464333280654043, 0.60326924860567488, 5.8094816115073966,
+        },
+        { // order 7
+            3.5187255587036526, 0.77216282778396972, 4.6392159979535528, 0.80377000024072665,
+            4.6392159979535528, 0.77216282778397016, 3.5187255587036472, 1,
+        },
+        { // order 8
+            3.5278644104808041, 0.774468267847785, 4.6577348696560978, 0.80890058844080925,
+            4.6992930940843918, 0.80174707161996683, 4.4992591607576884, 0.60725976023279471,
+            5.8094816115073966,
+        },
+        { // order 9
+            3.5341408185853096, 0.77600425693836095, 4.6692947727520435, 0.81176637674570884,
+            4.7272539586293894, 0.81176637674570895, 4.6692947727520426, 0.77600425693836128,
+            3.5341408185853069, 1,
+        },
+        { // order 10
+            3.5386357142006868, 0.7770809923804467, 4.6770401066903826, 0.81354795039921268,
+            4.7427225915419573, 0.8163762119751945, 4.7262918579237576, 0.80507012836156022,
+            4.5144377358861227, 0.60911385056996725, 5.8094816115073966,
+        },
+        { // order 11
+            3.5419643398788998, 0.77786599066061179, 4.6825052978780475, 0.81474007512532787,
+            4.7522786631042369, 0.81890417978431673, 4.752278663104236, 0.8147400751253282,
+            4.6825052978780493, 0.77786599066061179, 3.5419643398789038, 1,
+        },
+        { // order 12
+            3.5444976916634734, 0.77845645323994417, 4.6865170058781827, 0.81558162812093915,
+            4.7586481072584599, 0.82045577527905533, 4.7664227395387133, 0.81911750918232618,
+            4.7381064712518546, 0.80670140974285121, 4.5224284504567205, 0.61012288680672533,
+            5.8094816115073966,
+        },
+        { // order 13
+            3.546470227401147, 0.77891205239700856, 4.6895550404864723, 0.8162003237526837,
+            4.7631345591223528, 0.82148514266663053, 4.7750520904090736, 0.82148514266663053,
+            4.7631345591223537, 0.81620032375268359, 4.6895550404864732, 0.77891205239700723,
+            3.5464702274011577, 1,
+        },
+        { // order 14
+            3.5480359924163807, 0.77927112586226432, 4.6919145596451406, 0.81666989945072732,
+            4.7664296206498058, 0.82220783494563565, 4.7807503458364033, 0.82292202050639429,
+            4.776601297953972, 0.82045695974120825, 4.7444287635305873, 0.80763050361523114,
+            4.5271612760754874, 0.61073194299960643, 5.8094816115073966,
+        },
+        { // order 15
+            3.5492995705816117, 0.77955924601262283, 4.6937857940547589, 0.81703555812538675,
+            4.7689301255965315, 0.82273745419111166, 4.7847366904572555, 0.82386672149547591,
+            4.7847366904572546, 0.82273745419111155, 4.7689301255965315, 0.81703555812538609,
+            4.6937857940547607, 0.77955924601262316, 3.5492995705816051, 1,
+        },
+        { // order 16
+            3.550333981839692, 0.77979401610764543, 4.6952961239022679, 0.81732637276731102,
+            4.7708781551836461, 0.82313881460969474, 4.7876502471576723, 0.82452528977851314,
+            4.7900645091910805, 0.82410971706568692, 4.7820098071930186, 0.82122269665739345,
+            4.7482425331917346, 0.80821258037926236, 4.5301989973408689, 0.61112750142924999,
+            5.8094816115073966,
+        },
+        { // order 17
+            3.5511914574728163, 0.77998788328876234, 4.6965336096725085, 0.81756179116490735,
+            4.7724288186182973, 0.82345126439804761, 4.7898539070861128, 0.82500528126556416,
+            4.7937663941918984, 0.82500528126556394, 4.7898539070861146, 0.82345126439804717,
+            4.7724288186183008, 0.81756179116490701, 4.6965336096725068, 0.77998788328876179,
+            3.5511914574728158, 1,
+        },
+        { // order 18
+            3.5519101566841385, 0.78014985500697331, 4.6975607990774026, 0.81775525522404346,
+            4.7736855753970922, 0.8236999130628796, 4.7915670354321991, 0.82536752396140967,
+            4.7964570993248916, 0.82562566164665863, 4.794957453189201, 0.82478392322321537,
+            4.7852694983390398, 0.82170594463048097, 4.7507341179376121, 0.80860240434748831,
+            4.5322662368831672, 0.61139881218464232, 5.8094816115073966,
+        },
+        { // order 19
+            3.5525184817817586, 0.78028658251555705, 4.6984231633847919, 0.81791631641050599,
+            4.7747197836934827, 0.82390145247479851, 4.7929290887772371, 0.82564865377377139,
+            4.7984831746489425, 0.82607541813615404, 4.7984831746489425, 0.82564865377377117,
+            4.7929290887772389, 0.82390145247479862, 4.7747197836934792, 0.81791631641050699,
+            4.6984231633847875, 0.78028658251556005, 3.5525184817817403, 1,
+        },
+        { // order 20
+            3.5530379251754844, 0.78040306527564041, 4.6991544338759557, 0.81805192458928122,
+            4.7755820735254328, 0.8240673634602671, 4.7940324670634178, 0.82587188370010411,
+            4.8000527043228729, 0.8264133384734117, 4.8010330933657199, 0.82624458175664983,
+            4.7978875218167252, 0.82520830388161015, 4.787404194665803, 0.82203239340081236,
+            4.7524576131596632, 0.80887672052664594, 4.5337372572828389, 0.61159293767926659,
+            5.8094816115073966,
+        },
+        { // order 21
+            3.5534849924377654, 0.78050312088893525, 4.6997800801211191, 0.81816724159536047,
+            4.7763092487635381, 0.82420577356032343, 4.7949405422770051, 0.82605254780377391,
+            4.8012971560721871, 0.82667463154269338, 4.8029449639561488, 0.82667463154269338,
+            4.8012971560721862, 0.82605254780377413, 4.7949405422770015, 0.82420577356032387,
+            4.7763092487635372, 0.81816724159536225, 4.6997800801211076, 0.78050312088893525,
+            3.5534849924377747, 1,
+        },
+        { // order 22
+            3.5538725288262834, 0.78058970584625587, 4.7003196372290761, 0.81826617077395758,
+            4.7769286296037707, 0.82432258020113702, 4.795698066689015, 0.82620113454875288,
+            4.802303144883199, 0.82688148821636598, 4.8044206442849875, 0.82699644573595221,
+            4.8037528006888461, 0.82663195548649637, 4.7998002985675257, 0.82549500753900584,
+            4.7888868716288373, 0.82226417932740359, 4.753702272429873, 0.80907728977379012,
+            4.5348215422458047, 0.61173660000692442, 5.8094816115073966,
+        },
+        { // order 23
+            3.5542106517209113, 0.78066513894983014, 4.7007882993106183, 0.81835171099046367,
+            4.777460871238266, 0.82442215497656934, 4.7963374449341298, 0.82632503296033821,
+            4.8031297709790257, 0.82704849490230847, 4.805587095780175, 0.82724441341978749,
+            4.8055870957801758, 0.82704849490230847, 4.8031297709790248, 0.82632503296033855,
+            4.7963374449341272, 0.82442215497657023, 4.7774608712382589, 0.81835171099046411,
+            4.7007882993106209, 0.78066513894983103, 3.5542106517208816, 1,
+        },
+        { // order 24
+            3.5545074172955919, 0.78073125980592284, 4.7011980331115071, 0.81842619893102264,
+            4.7779218439315718, 0.82450779943265051, 4.796882655044227, 0.82642958199845062,
+            4.8038185773888031, 0.82718558293039512, 4.8065276068169185, 0.82744012637186348,
+            4.8069981987807022, 0.82735912224873287, 4.8055194333381621, 0.82689281051745034,
+            4.8011274598257465, 0.82569891357304226, 4.7899628993484136, 0.82243514369121729,
+            4.7546319530656795, 0.80922849016328569, 4.5356438973715063, 0.61184588488150526,
+            5.8094816115073966,
+        },
+        { // order 25
+            3.5547693045886484, 0.78078954312221427, 4.701558370701914, 0.81849147844304249,
+            4.7783239174630374, 0.82458204828186765, 4.7973517789631108, 0.82651872488620937,
+            4.8043995205860046, 0.82729971927766388, 4.8072987782364018, 0.82759772497223982,
+            4.8081103422658753, 0.82759772497223993, 4.8072987782364001, 0.82729971927766421,
+            4.8043995205860037, 0.82651872488620981, 4.797351778963109, 0.82458204828186765,
+            4.7783239174630401, 0.81849147844304315, 4.7015583707019086, 0.7807895431222126,
+            3.5547693045886528, 1,
+        },
+        { // order 26
+            3.5550015719666783, 0.78084118237255473, 4.7018769831019283, 0.81854902111239358,
+            4.7786768574901499, 0.82464687607881226, 4.7977586817334839, 0.82659543036817607,
+            4.8048946853663859, 0.82739591847076244, 4.8079402455008351, 0.82772680289054468,
+            4.8090047667809896, 0.82778552173318443, 4.8086636407444248, 0.82760228313267892,
+            4.8067413737921667, 0.8270780435639683, 4.8020909528799605, 0.82584970614763664,
+            4.7907708625668821, 0.82256510598545785, 4.7553454862698219, 0.80934535945315234,
+            4.5362824905010539, 0.61193094490994893, 5.8094816115073966,
+        },
+        { // order 27
+            3.5552085230232922, 0.78088715187702573, 4.7021601016254913, 0.81860001356976997,
+            4.7789884630685346, 0.82470384116258844, 4.7981141534243754, 0.82666197161184607,
+            4.8053206715334227, 0.82747787104703585, 4.8084804886236565, 0.82783406762645595,
+            4.8097365119026305, 0.82793637080548288, 4.8097365119026305, 0.82783406762645573,
+            4.8084804886236583, 0.82747787104703563, 4.8053206715334236, 0.82666197161184563,
+            4.7981141534243772, 0.82470384116258877, 4.7789884630685293, 0.8186000135697703,
+            4.7021601016254913, 0.78088715187702729, 3.5552085230233033, 1,
+        },
+        { // order 28
+            3.555393707283407, 0.78092825344254146, 4.702412831599287, 0.81864542167083121,
+            4.7792650278678179, 0.82475418785575927, 4.7984267027873173, 0.82672011547252855,
+            4.8056901709229924, 0.82754834661224375, 4.8089404351291885, 0.82792433161024859,
+            4.8103440056777398, 0.8280596493479877, 4.8105973061183915, 0.82801604813576424,
+            4.8098111802092856, 0.82777444817170343, 4.8076269022771738, 0.82721497240027519,
+            4.8028153087009207, 0.8259646942134421, 4.7913942883617411, 0.82266634916290626,
+            4.7559055235414034, 0.80943759633988299, 4.5367883282810402, 0.61199844410229209,
+            5.8094816115073966,
+        },
+        { // order 29
+            3.5555600733600192, 0.78096515180654347, 4.7026393888621918, 0.8186860383289275,
+            4.7795116790133694, 0.82479892029078727, 4.7987031196929895, 0.82677125377674299,
+            4.8060130355794399, 0.82760945971361999, 4.8093357673707073, 0.82800112605620479,
+            4.8108547822529255, 0.82816189641840376, 4.8113000387572331, 0.82816189641840354,
+            4.8108547822529264, 0.82800112605620491, 4.8093357673707064, 0.8276094597136201,
+            4.8060130355794408, 0.82677125377674332, 4.7987031196929868, 0.82479892029078761,
+            4.7795116790133729, 0.81868603832892783, 4.7026393888621971, 0.78096515180654091,
+            3.555560073360045, 1,
+        },
+        { // order 30
+            3.5557100870133018, 0.78099840185711678, 4.7028432800917974, 0.81872251961404463,
+            4.7797326295234708, 0.8248388565797522, 4.7989488807387772, 0.8268164961891642,
+            4.8062970173824322, 0.82766284963191827, 4.8096784423349934, 0.82806709358405073,
+            4.8112890194974209, 0.82824779177598917, 4.8118823365378587, 0.82828084471538721,
+            4.8116903160942179, 0.82817871563053735, 4.8106405532709173, 0.82790148312166134,
+            4.8082921054644414, 0.82731943033645905, 4.8033752307019197, 0.82605457795632631,
+            4.7918861697568538, 0.82274683855712782, 4.756353422624791, 0.80951169047104365,
+            4.5371958542055859, 0.61205290330382933, 5.8094816115073966,
+        },
+        { // order 31
+            3.5558458230113157, 0.7810284697422839, 4.7030274417475741, 0.81875541231103621,
+            4.7799313687835543, 0.8248746691280241, 4.7991684464122715, 0.82685673707247953,
+            4.8065482903697561, 0.82770980467871091, 4.8099777179409902, 0.82812424651735606,
+            4.8116617993094071, 0.82832076096214147, 4.8123710992175726, 0.82837931809256071,
+            4.8123710992175726, 0.82832076096214158, 4.8116617993094071, 0.82812424651735628,
+            4.809977717940991, 0.82770980467871103, 4.8065482903697516, 0.82685673707247964,
+            4.7991684464122715, 0.82487466912802487, 4.7799313687835561, 0.81875541231103555,
+            4.7030274417475786, 0.78102846974228501, 3.5558458230112744, 1,
+        },
+        { // order 32
+            3.5559690372314199, 0.78105574938905742, 4.7031943481685987, 0.81878517518111826,
+            4.7801108079505061, 0.82490691502586821, 4.7993654819467864, 0.8268927043960681,
+            4.8067718261964725, 0.82775134984398679, 4.8102408615949246, 0.82817414109794951,
+            4.8119845930809824, 0.82838336156611769, 4.8127859970059044, 0.82846190562588595,
+            4.8129342065679648, 0.82843639395858537, 4.8124779062970493, 0.82829844637934957,
+            4.811262443834476, 0.82799829369746392, 4.8088062458190723, 0.82740116031613442,
+            4.8038179608785834, 0.82612628852120329, 4.7922815540480794, 0.82281193531658248,
+            4.7567174189895765, 0.80957212066090889, 4.5375290136378483, 0.61209747702579231,
+            5.8094816115073966,
+        },
+    },
+};
+
+static const double afc_chebyshev_f3db[9][32] = {
+    { // 0.01 dB
+        20.827738086151747, 3.3036145421455987, 1.8771803784003811, 1.4669039747279982,
+        1.291217442865584, 1.1994124349864772, 1.1452682454938548, 1.110608836343381,
+        1.0870642565161526, 1.0703311270035978, 1.0580083749497544, 1.0486687835027981,
+        1.0414200006445733, 1.0356805119084396, 1.0310580426761067, 1.0272801069677591,
+        1.0241526021298308, 1.0215342031758292, 1.0193200184547708, 1.0174308642368772,
+        1.0158060527195574, 1.014398436254156, 1.0131709352481846, 1.0120940626994108,
+        1.0111441311658367, 1.0103019352264384, 1.0095517705331938, 1.008880694608743,
+        1.0082779635969346, 1.0077345986608048, 1.0072430489991488, 1.0067969276293405,
+    },
+    { // 0.05 dB
+        9.2930003652741657, 2.2685899106354772, 1.5120982771858746, 1.2783954612394939,
+        1.1753684382441527, 1.1207359807701978, 1.088242445183716, 1.0673320620218185,
+        1.0530771120283087, 1.0429210032989442, 1.0354282595650366, 1.0297417105202153,
+        1.0253235814548267, 1.0218225005312116, 1.0190009515768665, 1.0166936760946776,
+        1.0147827960127567, 1.0131823903000656, 1.0118286296057581, 1.0106732912516647,
+        1.0096793922335559, 1.0088181847005526, 1.0080670487113916, 1.0074079884833689,
+        1.0068265423312641, 1.0063109811223434, 1.0058517111377789, 1.0054408238507158,
+        1.0050717527066091, 1.0047390087920511, 1.0044379753251864, 1.0041647464671017,
+    },
+    { // 0.1 dB
+        6.5522032168027744, 1.9432193927607317, 1.3889948262996681, 1.213099211268545,
+        1.1347180020503873, 1.092930653403881, 1.0680005501910472, 1.0519266160879628,
+        1.0409547305564022, 1.0331306795489106, 1.0273546694194857, 1.022968878657577,
+        1.0195600856091169, 1.0168580407783201, 1.0146799271985627, 1.0128984687736384,
+        1.0114228360418098, 1.0101867972202967, 1.0091411334436013, 1.0082486497756669,
+        1.0074808138552609, 1.0068154422284865, 1.0062350770183233, 1.0057258271163112,
+        1.0052765279275646, 1.0048781233585287, 1.0045232053059454, 1.0042056663797312,
+        1.0039204351158684, 1.0036632720186991, 1.0034306109679696, 1.0032194348131516,
+    },
+    { // 0.2 dB
+        4.6063609933814167, 1.6742701385053453, 1.2834553823984352, 1.1563455665382527,
+        1.0991539311040341, 1.0685165844287199, 1.0501884363860907, 1.0383509923282812,
+        1.0302616985076702, 1.0244886361263443, 1.0202242800513408, 1.0169849026481956,
+        1.0144663041436868, 1.0124693665454996, 1.0108593017318606, 1.0095422210904013,
+        1.0084510929517909, 1.0075370212820147, 1.0067636592261695, 1.0061035324772358,
+        1.0055355609635166, 1.0050433523115658, 1.0046140040864828, 1.0042372485245197,
+        1.0039048322182937, 1.0036100597701496, 1.0033474536794653, 1.0031124978150505,
+        1.0029014417914428, 1.0027111502650852, 1.0025389857360152, 1.0023827166033943,
+    },
+    { // 0.25 dB
+        4.1081110091495736, 1.5981412655252938, 1.2528879876641033, 1.1397677977389284,
+        1.088723795065369, 1.0613406587105063, 1.044945973620794, 1.0343519221567987,
+        1.0271098824218063, 1.0219402612348163, 1.0181209928810449, 1.0152193503648623,
+        1.0129631166708435, 1.0111740635570103, 1.0097315198798955, 1.0085514171713803,
+        1.0075737271813012, 1.0067546579037532, 1.0060616537212568, 1.0054701042882419,
+        1.004961125773921, 1.0045200328716808, 1.0041352662467558, 1.0037976266072914,
+        1.0034997191436896, 1.0032355447926582, 1.0030001955908534, 1.0027896248857511,
+        1.0026004720942936, 1.0024299276956707, 1.0022756282360217, 1.0021355739547868,
+    },
+    { // 0.5 dB
+        2.86277516124319, 1.3897437104090793, 1.1674852111905913, 1.0931019418172028,
+        1.0592591471595489, 1.0410295892025816, 1.0300899820112581, 1.0230107384131417,
+        1.0181667615652252, 1.0147066440995518, 1.0121490969369886, 1.0102053229919603,
+        1.008693476579932, 1.0074944123942471, 1.0065274165225722, 1.0057362324220853,
+        1.0050806760605835, 1.004531423491875, 1.0040666694483253, 1.0036699268433702,
+        1.0033285426826954, 1.0030326756733772, 1.0027745783640081, 1.0025480843809838,
+        1.0023482364193101, 1.0021710124973513, 1.0020131218904758, 1.0018718511851321,
+        1.0017449468617032, 1.0016305248250406, 1.0015270000389618, 1.0014330313161448,
+    },
+    { // 1 dB
+        1.9652267283602713, 1.2176261183877979, 1.0948680223998142, 1.0530019274407332,
+        1.0338146209290064, 1.0234422363767812, 1.0172051054586344, 1.0131638385376605,
+        1.0103962817421495, 1.0084182220014191, 1.006955517179364, 1.0058434859302865,
+        1.0049783484781634, 1.0042920654517375, 1.0037385214897148, 1.0032855621750121,
+        1.0029102123186782, 1.0025957016021336, 1.0023295569214141, 1.0021023455719029,
+        1.0019068273156524, 1.0017373700674654, 1.0015895395225005, 1.0014598059658426,
+        1.0013453315233893, 1.0012438135834256, 1.0011533680567277, 1.0010724412977658,
+        1.0009997429179374, 1.0009341940132015, 1.0008748868928452, 1.0008210534793451,
+    },
+    { // 2 dB
+        1.3075602715790791, 1.0741415808865884, 1.0327294885219422, 1.0183667268932612,
+        1.0117418044871744, 1.0081491676636802, 1.0059849900161768, 1.0045811880811977,
+        1.0036191246829109, 1.002931155286138, 1.0024222371245506, 1.0020352208539578,
+        1.001734065701076, 1.0014951297974886, 1.0013023823614429, 1.0011446419177394,
+        1.0010139167791512, 1.0009043722261659, 1.0008116677989303, 1.0007325205283721,
+        1.0006644101724953, 1.000605376041062, 1.0005538742710756, 1.0005086758379353,
+        1.0004687925366236, 1.0004334224977383, 1.0004019095608541, 1.0003737126188115,
+        1.0003483822311374, 1.0003255426013682, 1.0003048775569685, 1.0002861195472372,
+    },
+    { // 3 dB
+        1.0023772930076007, 1.0005941467467219, 1.0002640506956357, 1.0001485256567451,
+        1.000095055573246, 1.0000660104952162, 1.0000484973651353, 1.000037130724841,
+        1.0000293378185603, 1.0000237636109568, 1.0000196393343987, 1.000016502487638,
+        1.0000140612855208, 1.0000121242677849, 1.0000105615816308, 1.0000092826381266,
+        1.0000082226814553, 1.0000073344277431, 1.0000065826988671, 1.0000059408850921,
+        1.0000053885574107, 1.0000049098215464, 1.0000044921615558, 1.0000041256133991,
+        1.0000038021651037, 1.0000035153152014, 1.0000032597434498, 1.0000030310623527,
+        1.0000028256275899, 1.0000026403919218, 1.0000024727915331, 1.0000023206568389,
+    },
+};
+
+// Bessel ladder g-values normalized to unit group delay, g[n-1][0..n] (g(n+1) last)
+static const double afc_bessel_delay_g[32][33] = {
+    { // order 1
+        2, 1,
+    },
+    { // order 2
+        0.42264973081037421, 1.5773502691896257, 1,
+    },
+    { // order 3
+        0.19218932359870558, 0.55278640450004202, 1.2550242719012523, 1,
+    },
+    { // order 4
+        0.11041858721918617, 0.31814143850175763, 0.51161693977158662, 1.0598230345074695,
+        1,
+    },
+    { // order 5
+        0.0718128912256768, 0.20896366259124155, 0.33122172956320128, 0.45770300407542513,
+        0.93029871254445518, 1,
+    },
+    { // order 6
+        0.050489248332427523, 0.14803231819366056, 0.23642693276119886, 0.31581986569057185,
+        0.41157247432860999, 0.83765916069353119, 1,
+    },
+    { // order 7
+        0.037456930126815974, 0.11040609995549804, 0.17782592757739046, 0.23783036431161614,
+        0.29441349825066054, 0.37441343762027124, 0.76765374215774762, 1,
+    },
+    { // order 8
+        0.028904598105640469, 0.085516800341437424, 0.13867144915138049, 0.18668054402960554,
+        0.22966810130617105, 0.27346070538490413, 0.34455696168964683, 0.71254083999121409,
+        1,
+    },
+    { // order 9
+        0.02298719326536933, 0.068193431183475706, 0.11114994720397019, 0.15059696609844858,
+        0.18592341315352287, 0.2183962294900538, 0.25470271377408099, 0.32027774819168892,
+        0.66777235763938958, 1,
+    },
+    { // order 10
+        0.018721695297229394, 0.055650602723598348, 0.09106063852804519, 0.12404238933444928,
+        0.15394534124535239, 0.18082399386513925, 0.20663362840148736, 0.23839515697676103,
+        0.3002229626573239, 0.63050359097061381, 1,
+    },
+    { // order 11
+        0.015544805962389132, 0.046277347227904587, 0.075950563266888177, 0.10390632800720251,
+        0.12959935161754046, 0.15277400497236371, 0.17392597458049563, 0.19543032756834908,
+        0.22433407226811675, 0.28339410198818776, 0.59886312254056218, 1,
+    },
+    { // order 12
+        0.013114680755676851, 0.039088680083324293, 0.064302706686646491, 0.088274093501065187,
+        0.11057313565151415, 0.13089828218014662, 0.14926776185804541, 0.16648381539562937,
+        0.1851649722046356, 0.21220169791294369, 0.26906232878640673, 0.57156784498396562,
+        1,
+    },
+    { // order 13
+        0.011214004971203194, 0.033454665340372121, 0.055136589376622372, 0.075899944880172279,
+        0.095411386910033286, 0.1133980448887235, 0.12973150772973255, 0.14463119823378881,
+        0.15911581284812021, 0.17592320123962468, 0.20168349880415737, 0.25669294541731857,
+        0.54770719936013101, 1,
+    },
+    { // order 14
+        0.009699219171044637, 0.02895714905415674, 0.047795429810218927, 0.065941309567322165,
+        0.083136028707605766, 0.099151042507093834, 0.11382662998286314, 0.12716468355923163,
+        0.1395382790321591, 0.15211595705409467, 0.16766499561038459, 0.19250400997804379,
+        0.24588932795584861, 0.52661593800993245, 1,
+    },
+    { // order 15
+        0.0084723716975549351, 0.025309701640083702, 0.041825895712602146, 0.05781091599124781,
+        0.073062476123519196, 0.087394173631454214, 0.10065403578269523, 0.1127683719113947,
+        0.12384197001799115, 0.13436710142252933, 0.14560937561769494, 0.16030104775976137,
+        0.18443341258470686, 0.23635334946647701, 0.5077958006402874, 1,
+    },
+    { // order 16
+        0.0074647598727659746, 0.022310777181127183, 0.036906959598382201, 0.051089178873968029,
+        0.064697783143388712, 0.077581857817169364, 0.089608504065080682, 0.10068427170621756,
+        0.11080420358530867, 0.12015703810524703, 0.1293266868183951, 0.13963266015832759,
+        0.15372801706387859, 0.1772840184123789, 0.22785778382602517, 0.49086549977233923,
+        1,
+    },
+    { // order 17
+        0.0066270337651827384, 0.01981521777574765, 0.03280617291791936, 0.045469915553594267,
+        0.057679143078669691, 0.06931155732248441, 0.080254684226201647, 0.090416694311939966,
+        0.099750981253588625, 0.10830979708525908, 0.11635138097587187, 0.12452760676318254,
+        0.1341765988395022, 0.14784452688044855, 0.17090390595606808, 0.2202270283516457,
+        0.47552775494269361, 1,
+    },
+    { // order 18
+        0.0059229995886173918, 0.01771632645127948, 0.029351907874091192, 0.040725536201966131,
+        0.051734662059263935, 0.062279707862092616, 0.072266659298773711, 0.081612699418897289,
+        0.090258828902992208, 0.098197587476533052, 0.10553020613768949, 0.11257223973439674,
+        0.12002242667466502, 0.12920939886250224, 0.14255792350726645, 0.16517040124084878,
+        0.21332353501093726, 0.46154695369718696, 1,
+    },
+    { // order 19
+        0.0053256216487071592, 0.015934254439849267, 0.026415234678077743, 0.036684084461872164,
+        0.046657381295483621, 0.056253525394074244, 0.065394177834417408, 0.074007280443655191,
+        0.08203369584818801, 0.089441767996496835, 0.096257933521028793, 0.10262593181451475,
+        0.10890752985794735, 0.11582943945933601, 0.12468945719229554, 0.13778656499890729,
+        0.15998431642803781, 0.20703816368593697, 0.44873363900117386, 1,
+    },
+    { // order 20
+        0.0048143740523603918, 0.014408282894768457, 0.023897794438599955, 0.033213726786477639,
+        0.042287587084199878, 0.051052033296430259, 0.059441695705101334, 0.067394839645033219,
+        0.074856943045187738, 0.081788482210492203, 0.088181455466328634, 0.094092390437877024,
+        0.099701883116179474, 0.10540735904107619, 0.1119468889514576, 0.12057237729770781,
+        0.13345997630407372, 0.15526516211459299, 0.20128324803142417, 0.43693350008063131,
+        1,
+    },
+    { // order 21
+        0.004373445175716229, 0.013091574753889747, 0.021723504695403469, 0.030212052078875447,
+        0.038500494229606962, 0.046532854266473002, 0.054254382902648918, 0.061612496759696565,
+        0.068558749737337527, 0.075053074387620961, 0.081072801246447265, 0.08663104432639869,
+        0.091811389406355137, 0.096825908453753204, 0.10209755447256327, 0.10836163923379633,
+        0.1168147469298302, 0.12951803952099059, 0.15094728754277745, 0.19598755432989942,
+        0.42601940554991963, 1,
+    },
+    { // order 22
+        0.0039904947653851119, 0.011947532827165123, 0.01983277421486641, 0.027598551112522889,
+        0.035197509512703097, 0.042582790222357288, 0.049708318327517716, 0.056529344675626432,
+        0.063003555041622639, 0.069093423575355112, 0.074771202031095427, 0.080029202791065859,
+        0.084899815491555924, 0.08949097896476832, 0.094040856458666652, 0.098988328373155132,
+        0.1050545200548532, 0.11337606356184449, 0.12590980922492387, 0.1469768181956492,
+        0.19109257454420528, 0.4158855360330948, 1,
+    },
+    { // order 23
+        0.003655777404765392, 0.010947225852487991, 0.018178396169366902, 0.025309241605008841,
+        0.03229993338829959, 0.039110978102589095, 0.045703395470392108, 0.052039037185489252,
+        0.058081222856670597, 0.063796068927274227, 0.069155288373523152, 0.074141986804793933,
+        0.078762174030513138, 0.083066052694662246, 0.087183252443650328, 0.091372555953132165,
+        0.096079925210477563, 0.10200363684138573, 0.1102195929647715, 0.12259224811394687,
+        0.14330924634140713, 0.18654976941924367, 0.40644299384614857, 1,
+    },
+    { // order 24
+        0.0033615138718150047, 0.01006753901423805, 0.016722585829527983, 0.023292768056142901,
+        0.02974435342546089, 0.036043841380862925, 0.042158074495772711, 0.048054429605842691,
+        0.053701188567646184, 0.059068300785681649, 0.064128976925823061, 0.068862988823153337,
+        0.073263301509817691, 0.077348706053980781, 0.081185903480811686, 0.084923431350794845,
+        0.088835182097906307, 0.093366356844103729, 0.099186408065218501, 0.10731261669315492,
+        0.11952902510380563, 0.13990754269114597, 0.18231849512849979, 0.39761647019879276,
+        1,
+    },
+    { // order 25
+        0.0031014333523467987, 0.009289824905316801, 0.015434812502916184, 0.021507532264364908,
+        0.027479230786535649, 0.033321317604441042, 0.03900543632111738, 0.044503581013022625,
+        0.049788315506745839, 0.054833217142467951, 0.059613796371515267, 0.064109396406290403,
+        0.068307034602568081, 0.072208863675798929, 0.075845742650967135, 0.079299544163187546,
+        0.08273474171426369, 0.086434922723925334, 0.090837901224949627, 0.096580792839827095,
+        0.10462633815458695, 0.11668943757432909, 0.13674067792894043, 0.1783644268298854,
+        0.38934168173968986, 1,
+    },
+    { // order 26
+        0.0028704354056455533, 0.0085989059398646692, 0.014290191518428707, 0.019919555185847752,
+        0.025462340370527078, 0.030894006930256814, 0.036190177340394571, 0.04132670856696679,
+        0.046279823290671228, 0.051026371240346903, 0.055544366311239601, 0.059814092376586102,
+        0.063820345116214316, 0.067556839938967966, 0.071034454260921004, 0.074295478724312039,
+        0.077435514782220549, 0.080631816956497848, 0.084172521807786879, 0.088482784694940836,
+        0.094165996845216371, 0.10213560886860039, 0.11404747736207631, 0.13378246392857604,
+        0.17465834718585688, 0.38156337505103682, 1,
+    },
+    { // order 27
+        0.002664337159732915, 0.007982327334267297, 0.013268276930618378, 0.018500865014091535,
+        0.023658829899537791, 0.028720994328676121, 0.033666295935330597, 0.038473832140435107,
+        0.043122939388934634, 0.047593348463808839, 0.051865501430137941, 0.055921202079488974,
+        0.059744935479939282, 0.063326481559796949, 0.06666589438345763, 0.069782431758112662,
+        0.072729161774258727, 0.075613800011633245, 0.078623106086100375, 0.082045068613765509,
+        0.086288314141598099, 0.091922840433871972, 0.099818572056389568, 0.11158103863110189,
+        0.13101064318946073, 0.17117520568226088, 0.37423375609319237, 1,
+    },
+    { // order 28
+        0.0024796820234783564, 0.007429791221974868, 0.012352144824057477, 0.017228268778628299,
+        0.02203973323033866, 0.026768170375878576, 0.031395294850569806, 0.035902932037580625,
+        0.040273066188678305, 0.044487933276154835, 0.048530209465018598, 0.052383397169485542,
+        0.056032608446038135, 0.059466123425838922, 0.062678396215824606, 0.065675586011846282,
+        0.068485032930737044, 0.071169842412673462, 0.073848043293738619, 0.076712602721746306,
+        0.080047270605068749, 0.084241631514951412, 0.089833908961853531, 0.097656281345300425,
+        0.10927125556451105, 0.12840617063584345, 0.16789338090743863, 0.36731124156474543,
+        1,
+    },
+    { // order 29
+        0.0023135933773280877, 0.0069327233882444557, 0.01152768998892722, 0.016082406795979005,
+        0.020580820758128199, 0.025006925001075573, 0.029344772652801412, 0.033578494822281466,
+        0.037692329877750334, 0.041670679061640417, 0.045498219075785884, 0.049160132814525533,
+        0.052642578113458342, 0.055933623107350616, 0.059025065120109008, 0.0619158377052638,
+        0.064618046231848317, 0.067166803105857889, 0.069634381401744286, 0.072147157140385262,
+        0.07490110448773879, 0.07817236590996203, 0.082330205264926654, 0.087883565189623203,
+        0.095632327931950076, 0.10710195379187905, 0.12595264449751395, 0.16479409645942733,
+        0.3607594569264938, 1,
+    },
+    { // order 30
+        0.0021636615449793931, 0.0064839382549119161, 0.010783081071590823, 0.015047018038801343,
+        0.019261702597338871, 0.023413122947672612, 0.027487311542099595, 0.031470356555438735,
+        0.035348419644187147, 0.039107769146256015, 0.042734847362230141, 0.046216409032616666,
+        0.049539803611195171, 0.052693540330615067, 0.055668393405569401, 0.058459497838355037,
+        0.061070151830679188, 0.063518279287664695, 0.065846397563122216, 0.068134927308701673,
+        0.070516509487688936, 0.073187142838798208, 0.076412778851186636, 0.08054213681118487,
+        0.086057877490776036, 0.093732494249078632, 0.10505919874596978, 0.12363585290585397,
+        0.1618609542705628, 0.35454642543487441, 1,
+    },
+    { // order 31
+        0.0020278556639317402, 0.0060773774514235514, 0.010108334688438149, 0.014108364403025035,
+        0.018065123158799698, 0.021966293963989275, 0.025799592863555567, 0.029552776269900317,
+        0.033213651629461785, 0.03677009703068633, 0.04021010120412645, 0.043521846667815639,
+        0.04669388041806203, 0.049715457250532287, 0.052577214617552534, 0.055272463635028829,
+        0.057799571327246682, 0.060166135386496365, 0.062395765290897458, 0.064537925698237131,
+        0.066680015117928884, 0.068958809844187563, 0.071567677514668207, 0.07476058868361897,
+        0.078866336705854176, 0.08434450015313559, 0.09194444263804917, 0.10313092510646782,
+        0.12144341055297495, 0.15907955852255931, 0.34864390654134852, 1,
+    },
+    { // order 32
+        0.0019044543759118113, 0.0057079040616402265, 0.0094949797326238563, 0.013254775832823595,
+        0.016976401966641453, 0.020648988056362297, 0.024261688969193371, 0.027803689193169966,
+        0.031264209117182841, 0.034632516360512393, 0.03789794924077354, 0.041049966463449571,
+        0.044078250450064811, 0.046972916799781779, 0.049724928353619142, 0.052326892811831505,
+        0.054774552561914179, 0.057069453991665839, 0.059223452191034226, 0.061265673368833137,
+        0.063251961069148224, 0.065275392092842097, 0.067474780624291297, 0.070038619477231223,
+        0.073207860265655358, 0.077292609609501253, 0.082732530101646981, 0.090257441682561876,
+        0.1013066332167506, 0.11936446570922976, 0.1564372100938059, 0.34302685215830586,
+        1,
+    },
+};
+
+// -3 dB frequency of the unit-delay Bessel prototype
+static const double afc_bessel_w3db[32] = {
+    1,
+    1.3616541287161306,
+    1.7556723686812106,
+    2.1139176749042159,
+    2.4274107021526281,
+    2.7033950612029218,
+    2.9517221470387227,
+    3.1796172375106515,
+    3.39169313891166,
+    3.5909805945691633,
+    3.7796074164396201,
+    3.9591508211442852,
+    4.130825499383536,
+    4.2955934095336374,
+    4.4542330216243773,
+    4.6073854654726478,
+    4.7555865489611477,
+    4.8992896772844876,
+    5.0388826814882073,
+    5.1747004417427078,
+    5.3070345313609169,
+    5.436140703250036,
+    5.5622447837878779,
+    5.6855473712959634,
+    5.8062276237754187,
+    5.9244463434718631,
+    6.0403485119624376,
+    6.1540653911555943,
+    6.2657162779330431,
+    6.3754099799018507,
+    6.4832460646906265,
+    6.589315923935545,
+};
+
+#endif
@@ -0,0 +1,272 @@
+/*
+ * Analog Filter Calculator - time-domain response
+ * The frequency response goes straight into the transform buffers, a
+ * block of sweep points at a time, and is tapered towards the Nyquist
+ * frequency so the record does not ring with the truncation. A real
+ * inverse FFT gives the baseband impulse response, a complex one the
+ * envelope. The step response is its running sum (trapezoidal), and the
+ * figures are gathered from it block by block.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "afc_time.h"
+#include "afc_fft.h"
+#include "afc_response.h"
+
+#define TIME_SPAN       16      // first record length, in 1 / bandwidth
+#define TIME_MIN_POINTS 1024
+#define RATE_LOWPASS    32      // sample rate in cutoffs
+#define RATE_HIGHPASS   64
+#define RATE_ENVELOPE   16      // in bandwidths
+#define TAPER_START     0.75    // taper from this fraction of Nyquist on
+#define TAIL_FRACTION   4       // 5/8 to 7/8 of the record (the end holds the
+                                // taper's pre-ringing, wrapped round) ...
+#define TAIL_LEVEL      1e-6    // ... must stay below this, relative to the peak
+#define SWEEP_BLOCK     65536
+
+typedef double complex cplx;
+
+typedef struct {
+    int envelope;
+    double f0;              // carrier (envelope) or 0
+    double fs, base;        // sample rate, bandwidth that sets the duration
+} time_plan;
+
+static void plan_for(const afc_spec *spec, time_plan *p) {
+    memset(p, 0, sizeof *p);
+    switch (spec->type) {
+    case AFC_LOWPASS:
+        p->base = spec->freq;
+        p->fs = RATE_LOWPASS * spec->freq;
+        break;
+    case AFC_HIGHPASS:
+        p->base = spec->freq;
+        p->fs = RATE_HIGHPASS * spec->freq;
+        break;
+    default:
+        p->base = spec->bw;
+        p->fs = RATE_ENVELOPE * spec->bw;
+        // the envelope spectrum must stay clear of 0 Hz
+        if (p->fs / 2 < spec->freq) {
+            p->envelope = 1;
+            p->f0 = spec->freq;
+        } else {
+            p->fs = RATE_LOWPASS * (spec->freq + spec->bw);
+        }
+        break;
+    }
+}
+
+// Raised-cosine roll-off over the top of the band, x = |f| / Nyquist.
+static double taper(double x) {
+    if (x <= TAPER_START)
+        return 1;
+    double c = cos(AFC_M_PI / 2 * (x - TAPER_START) / (1 - TAPER_START));
+    return c * c;
+}
+
+// Spectrum of the record into re/im: bins 0..N/2 at baseband, all N
+// around the carrier otherwise.
+static int fill_spectrum(const time_plan *p, const afc_element *el, int n, double Rs, double RL,
+                         long N, int threads, double *re, double *im, double *freq) {
+    double df = p->fs / N, nyquist = p->fs / 2;
+    long bins = p->envelope ? N : N / 2 + 1;
+
+    for (long k0 = 0; k0 < bins; k0 += SWEEP_BLOCK) {
+        long count = bins - k0 < SWEEP_BLOCK ? bins - k0 : SWEEP_BLOCK;
+        for (long i = 0; i < count; i++) {
+            long k = k0 + i;
+            double off = (p->envelope && k >= N / 2 ? k - N : k) * df;
+            // at baseband 0 Hz is approached rather than evaluated
+            freq[i] = p->envelope ? p->f0 + off : (k ? off : df * 1e-6);
+        }
+        afc_response out = { .s21_re = re + k0, .s21_im = im + k0 };
+        int err = afc_ladder_response_mt(el, n, Rs, RL, freq, count, &out, threads);
+        if (err != AFC_OK)
+            return err;
+        for (long i = 0; i < count; i++) {
+            long k = k0 + i;
+            double w = taper(fabs((p->envelope && k >= N / 2 ? k - N : k) * df) / nyquist);
+            re[k] *= w;
+            im[k] *= w;
+        }
+    }
+    return AFC_OK;
+}
+
+// Sample m of the impulse response times dt.
+static cplx impulse_at(const time_plan *p, const double *re, const double *im, long m) {
+    if (p->envelope)
+        return re[m] + I * im[m];
+    return m & 1 ? im[m / 2] : re[m / 2];
+}
+
+typedef struct {
+    double final, target, band, dt;
+    double prev, prev2, low;
+    long count;
+    double t10, t50, t90;
+    afc_step_metrics *m;
+} step_stats;
+
+// First time the step reaches level * final, interpolated between samples.
+static double crossing(const step_stats *s, double y, double level, double found) {
+    double r = y / s->final, q = s->prev / s->final;
+    if (!isnan(found) || r < level)
+        return found;
+    double t = s->count * s->dt;
+    if (s->count == 0 || q >= level)
+        return t;
+    return t - s->dt * (r - level) / (r - q);
+}
+
+static void stats_add(step_stats *s, double y) {
+    afc_step_metrics *m = s->m;
+    double t = s->count * s->dt;
+
+    if (s->count == 0 || y > m->peak) {
+        m->peak = y;
+        m->peak_time = t;
+        s->low = y;
+    }
+    if (y < s->low)
+        s->low = y;
+    if (s->final != 0) {
+        s->t10 = crossing(s, y, 0.1, s->t10);
+        s->t50 = crossing(s, y, 0.5, s->t50);
+        s->t90 = crossing(s, y, 0.9, s->t90);
+    }
+    // an extremum at the previous sample
+    if (s->count >= 2 && (s->prev - s->prev2) * (y - s->prev) < 0 &&
+        fabs(s->prev - s->target) > s->band)
+        m->ringing++;
+    if (fabs(y - s->target) > s->band)
+        m->settling_time = t + s->dt;
+    s->prev2 = s->prev;
+    s->prev = y;
+    s->count++;
+}
+
+int afc_step_response(const afc_spec *spec, const afc_element *el, int n,
+                      const afc_step_config *cfg, afc_step_metrics *m) {
+    time_plan p;
+    long cap = cfg->max_points > 0 ? cfg->max_points : AFC_TIME_MAX_POINTS;
+    double tol = cfg->settle_tol > 0 ? cfg->settle_tol : 0.01;
+    double Rs = spec->R, RL = afc_load_impedance(spec);
+
+    memset(m, 0, sizeof *m);
+    if (!(RL > 0))
+        return AFC_ERR_IMPEDANCE;
+    if (!(spec->freq > 0) || ((spec->type == AFC_BANDPASS || spec->type == AFC_BANDREJECT) &&
+        !(spec->bw > 0)))
+        return AFC_ERR_FREQ;
+    if (cap < TIME_MIN_POINTS || !(cfg->duration >= 0))
+        return AFC_ERR_ARGUMENT;
+    plan_for(spec, &p);
+
+    double span = cfg->duration > 0 ? cfg->duration : TIME_SPAN / p.base;
+    long N = TIME_MIN_POINTS;
+    while (N < p.fs * span && N < cap)
+        N *= 2;
+    if (N > cap)
+        N /= 2;
+
+    double *re = NULL, *im = NULL, *freq = malloc(SWEEP_BLOCK * sizeof *freq);
+    int err = freq ? AFC_OK : AFC_ERR_MEMORY;
+    cplx final = 0;
+    while (err == AFC_OK) {
+        free(re);
+        free(im);
+        re = malloc(N * sizeof *re);
+        im = malloc(N * sizeof *im);
+        if (!re || !im) {
+            err = AFC_ERR_MEMORY;
+            break;
+        }
+        if ((err = fill_spectrum(&p, el, n, Rs, RL, N, cfg->threads, re, im, freq)) != AFC_OK)
+            break;
+        final = re[0] + I * im[0];
+        err = p.envelope ? afc_fft(re, im, N, 1) : afc_real_ifft(re, im, N);
+        if (err != AFC_OK)
+            break;
+
+        // decayed if the last part of the impulse response is negligible
+        double top = 0, tail = 0;
+        for (long k = 0; k < N; k++) {
+            double a = cabs(impulse_at(&p, re, im, k));
+            top = fmax(top, a);
+            if (k >= N / 2 + N / (2 * TAIL_FRACTION) && k < N - N / (2 * TAIL_FRACTION))
+                tail = fmax(tail, a);
+        }
+        m->truncated = !(tail <= TAIL_LEVEL * top);
+        if (!m->truncated || cfg->duration > 0 || N * 2 > cap)
+            break;
+        N *= 2;
+    }
+    free(freq);
+    if (err != AFC_OK) {
+        free(re);
+        free(im);
+        return err;
+    }
+
+    m->envelope = p.envelope;
+    // The end of the record is negative time: the pre-ringing of the taper,
+    // wrapped round. It is left out, and the step starts from its sum so
+    // that it settles on the final value.
+    long len = N - N / (2 * TAIL_FRACTION);
+    m->points = len;
+    m->dt = 1 / p.fs;
+    m->duration = len * m->dt;
+    m->final = p.envelope ? cabs(final) : creal(final);
+
+    cplx pre = 0;
+    for (long k = len; k < N; k++)
+        pre += impulse_at(&p, re, im, k);
+
+    // the peak of the step sets the band when the final value is 0
+    cplx acc = pre;
+    double peak = 0;
+    for (long k = 0; k < len; k++) {
+        cplx x = impulse_at(&p, re, im, k);
+        peak = fmax(peak, cabs(acc + x / 2));
+        acc += x;
+    }
+    step_stats s = { .final = m->final, .dt = m->dt, .m = m, .t10 = NAN, .t50 = NAN, .t90 = NAN };
+    int zero = !(fabs(m->final) > 1e-6 * peak);
+    if (zero)
+        s.final = 0;
+    s.target = s.final;
+    s.band = tol * (zero ? peak : fabs(m->final));
+
+    double step[AFC_TIME_BLOCK], impulse[AFC_TIME_BLOCK];
+    acc = pre;
+    for (long k0 = 0; k0 < len; k0 += AFC_TIME_BLOCK) {
+        long count = len - k0 < AFC_TIME_BLOCK ? len - k0 : AFC_TIME_BLOCK;
+        for (long i = 0; i < count; i++) {
+            cplx x = impulse_at(&p, re, im, k0 + i);
+            cplx y = acc + x / 2;
+            acc += x;
+            step[i] = p.envelope ? cabs(y) : creal(y);
+            impulse[i] = (p.envelope ? cabs(x) : creal(x)) / m->dt;
+            stats_add(&s, step[i]);
+        }
+        if (cfg->sink)
+            cfg->sink(cfg->ctx, k0 * m->dt, m->dt, step, impulse, count);
+    }
+    free(re);
+    free(im);
+
+    m->delay = s.t50;
+    m->rise_time = s.t90 - s.t10;
+    m->overshoot_pct = zero ? NAN : fmax(0, 100 * (m->peak - m->final) / fabs(m->final));
+    m->undershoot_pct = zero ? NAN : fmax(0, 100 * (m->final - s.low) / fabs(m->final));
+    return AFC_OK;
+}
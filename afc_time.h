@@ -0,0 +1,61 @@
+/*
+ * Analog Filter Calculator - time-domain response
+ * Step and impulse response of a designed ladder, from its frequency
+ * response on a uniform grid through an inverse FFT (afc_fft.h), with the
+ * usual figures: delay, rise time, overshoot, ringing and settling time.
+ *
+ * LP and HP designs are transformed at baseband. BP and BR designs are
+ * analysed as the envelope of a carrier at the centre frequency switched
+ * on at t = 0, so the sample rate follows the bandwidth rather than the
+ * centre frequency and a narrow band-pass that rings for thousands of
+ * carrier cycles still needs only a short transform. The record grows
+ * until the response has decayed inside it (or max_points is reached),
+ * and the samples are handed out in blocks.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_TIME_H
+#define AFC_TIME_H
+
+#include "afc.h"
+
+#define AFC_TIME_MAX_POINTS (1L << 22)
+#define AFC_TIME_BLOCK      4096
+
+// Receives count samples from t0 on, dt apart: the step response and the
+// impulse response (1/s), envelope magnitudes for BP/BR.
+typedef void (*afc_time_sink)(void *ctx, double t0, double dt, const double *step,
+                              const double *impulse, long count);
+
+typedef struct {
+    double settle_tol;     // settling band, fraction of the final value
+                           // (of the peak if that is 0); 0 = 1 %
+    double duration;       // record length in s, 0 = until the tail decays
+    long max_points;       // transform length cap, 0 = AFC_TIME_MAX_POINTS
+    int threads;           // for the frequency sweep, 0 = all cores
+    afc_time_sink sink;    // NULL = figures only
+    void *ctx;
+} afc_step_config;
+
+typedef struct {
+    int envelope;          // BP/BR: carrier envelope
+    long points;           // samples in the record
+    double dt, duration;
+    double final;          // steady-state value
+    double peak, peak_time;
+    double delay;          // first 50 % crossing
+    double rise_time;      // 10 % to 90 %, NaN when the final value is 0
+    double overshoot_pct;  // peak above the final value
+    double undershoot_pct; // dip below it after the peak
+    int ringing;           // extrema outside the settling band
+    double settling_time;  // last time outside the band
+    int truncated;         // the response had not decayed within max_points
+} afc_step_metrics;
+
+// Step response of the n elements el designed for spec.
+int afc_step_response(const afc_spec *spec, const afc_element *el, int n,
+                      const afc_step_config *cfg, afc_step_metrics *m);
+
+#endif
@@ -0,0 +1,566 @@
+/*
+ * Analog Filter Calculator - Touchstone files
+ * A chunk is cut into blocks of FORMAT_BLOCK points; workers format whole
+ * blocks into collect-only writers (one per block of the chunk) and the
+ * blocks are then appended to the file in order. The reader walks the
+ * mapped file line by line and parses numbers with a bounded scanner, as
+ * the mapping has no terminating NUL.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "afc_parallel.h"
+#include "afc_response.h"
+#include "afc_touchstone.h"
+#include "afc_writer.h"
+
+#define FORMAT_BLOCK   2048    // points a worker formats at a time
+#define BLOCKS         (AFC_TS_CHUNK / FORMAT_BLOCK)
+#define PAIRS_PER_LINE 4       // for 3 and more ports
+#define MAX_VALUES     (1 + 2 * AFC_TS_MAX_PORTS * AFC_TS_MAX_PORTS)
+#define NUMBER_MAX     64      // longest number the reader takes
+
+static const char *unit_name(double unit) {
+    return unit == 1 ? "Hz" : unit == 1e3 ? "kHz" : unit == 1e6 ? "MHz" : unit == 1e9 ? "GHz" : NULL;
+}
+
+static const char *format_name(afc_ts_format f) {
+    return f == AFC_TS_RI ? "RI" : f == AFC_TS_MA ? "MA" : f == AFC_TS_DB ? "DB" : NULL;
+}
+
+afc_ts_format afc_ts_format_from_name(const char *name) {
+    for (afc_ts_format f = AFC_TS_RI; f <= AFC_TS_DB; f++)
+        if (!strcasecmp(name, format_name(f)))
+            return f;
+    return 0;
+}
+
+// Position in the file of each matrix entry i * ports + j: row by row,
+// except 2-ports, which go S11 S21 S12 S22.
+static int file_order(int ports, int i, int j) {
+    return ports == 2 ? j * 2 + i : i * ports + j;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Writing                                                                */
+/* ---------------------------------------------------------------------- */
+
+struct afc_ts_writer {
+    afc_writer w;
+    afc_ts_options opt;
+    int ports;
+    long count, written;
+    double last;           // last frequency written
+    int err;
+    afc_writer block[BLOCKS];
+};
+
+typedef struct {
+    afc_ts_writer *t;
+    const double *freq;
+    const double *const *re, *const *im;
+    long count;
+} format_job;
+
+// The points [begin, end) of a write as text.
+static void format_points(const afc_ts_writer *t, afc_writer *w, const double *freq,
+                          const double *const *re, const double *const *im, long begin, long end) {
+    int ports = t->ports, decimals = t->opt.digits - 1;
+    double unit = t->opt.unit;
+    for (long k = begin; k < end; k++) {
+        afc_write_exp(w, freq[k] / unit, decimals, 0);
+        for (int p = 0; p < ports * ports; p++) {
+            // p runs in file order; (i, j) is the entry written there
+            int i = ports == 2 ? p % 2 : p / ports, j = ports == 2 ? p / 2 : p % ports;
+            double a = re[i * ports + j][k], b = im[i * ports + j][k];
+            if (ports > 2 && p > 0 && (j == 0 || j % PAIRS_PER_LINE == 0))
+                afc_write_char(w, '\n');
+            if (t->opt.format != AFC_TS_RI) {
+                double mag = hypot(a, b);
+                b = atan2(b, a) * (180 / AFC_M_PI);
+                a = t->opt.format == AFC_TS_DB ? 20 * log10(mag) : mag;
+            }
+            afc_write_char(w, ' ');
+            afc_write_exp(w, a, decimals, 0);
+            afc_write_char(w, ' ');
+            afc_write_exp(w, b, decimals, 0);
+        }
+        afc_write_char(w, '\n');
+    }
+}
+
+static void format_blocks(void *ctx, long begin, long end, int tid) {
+    const format_job *job = ctx;
+    (void)tid;
+    for (long b = begin; b < end; b++) {
+        long from = b * FORMAT_BLOCK, to = from + FORMAT_BLOCK < job->count ? from + FORMAT_BLOCK : job->count;
+        afc_writer_reset(&job->t->block[b]);
+        format_points(job->t, &job->t->block[b], job->freq, job->re, job->im, from, to);
+    }
+}
+
+afc_ts_writer *afc_ts_begin(FILE *out, int ports, const double *R, long count,
+                            const afc_ts_options *opt, const char *comment, int *err) {
+    afc_ts_options o = opt ? *opt : (afc_ts_options){ 0 };
+    if (!o.version)  o.version = 1;
+    if (!o.format)   o.format = AFC_TS_RI;
+    if (!o.unit)     o.unit = 1e9;
+    if (!o.digits)   o.digits = AFC_TS_DIGITS;
+
+    *err = AFC_OK;
+    if ((o.version != 1 && o.version != 2) || !format_name(o.format) || !unit_name(o.unit) ||
+        o.digits < 1 || o.digits > 15 || ports < 1 || ports > AFC_TS_MAX_PORTS || count < 1)
+        *err = AFC_ERR_ARGUMENT;
+    for (int p = 0; *err == AFC_OK && p < ports; p++)
+        if (!(R[p] > 0) || (o.version == 1 && R[p] != R[0]))
+            *err = AFC_ERR_IMPEDANCE;
+    afc_ts_writer *t = *err == AFC_OK ? calloc(1, sizeof *t) : NULL;
+    if (*err == AFC_OK && !t)
+        *err = AFC_ERR_MEMORY;
+    if (*err != AFC_OK)
+        return NULL;
+    t->opt = o;
+    t->ports = ports;
+    t->count = count;
+    afc_writer_init(&t->w, out);
+    for (int b = 0; b < BLOCKS; b++)
+        afc_writer_init(&t->block[b], NULL);
+
+    char line[128];
+    for (const char *c = comment; c && *c;) {
+        size_t len = strcspn(c, "\n");
+        afc_write_str(&t->w, "! ");
+        afc_write(&t->w, c, len);
+        afc_write_char(&t->w, '\n');
+        c += len + (c[len] == '\n');
+    }
+    if (o.version == 2)
+        afc_write_str(&t->w, "[Version] 2.0\n");
+    snprintf(line, sizeof line, "# %s S %s R %.12g\n", unit_name(o.unit), format_name(o.format), R[0]);
+    afc_write_str(&t->w, line);
+    if (o.version == 2) {
+        snprintf(line, sizeof line, "[Number of Ports] %d\n", ports);
+        afc_write_str(&t->w, line);
+        if (ports == 2)
+            afc_write_str(&t->w, "[Two-Port Data Order] 21_12\n");
+        snprintf(line, sizeof line, "[Number of Frequencies] %ld\n", count);
+        afc_write_str(&t->w, line);
+        afc_write_str(&t->w, "[Reference]");
+        for (int p = 0; p < ports; p++) {
+            snprintf(line, sizeof line, " %.12g", R[p]);
+            afc_write_str(&t->w, line);
+        }
+        afc_write_str(&t->w, "\n[Network Data]\n");
+    }
+    return t;
+}
+
+int afc_ts_write(afc_ts_writer *t, const double *freq, const double *const *re,
+                 const double *const *im, long count, int threads) {
+    if (t->err != AFC_OK)
+        return t->err;
+    if (count > t->count - t->written)
+        return t->err = AFC_ERR_ARGUMENT;
+    for (long k = 0; k < count; k++) {
+        if (!(freq[k] > t->last))
+            return t->err = AFC_ERR_FREQ;
+        t->last = freq[k];
+    }
+
+    threads = afc_thread_count(threads);
+    for (long at = 0; at < count && t->err == AFC_OK; at += AFC_TS_CHUNK) {
+        long m = count - at < AFC_TS_CHUNK ? count - at : AFC_TS_CHUNK;
+        const double *r[AFC_TS_MAX_PORTS * AFC_TS_MAX_PORTS], *i[AFC_TS_MAX_PORTS * AFC_TS_MAX_PORTS];
+        for (int p = 0; p < t->ports * t->ports; p++) {
+            r[p] = re[p] + at;
+            i[p] = im[p] + at;
+        }
+        if (threads == 1 || m <= FORMAT_BLOCK) {
+            format_points(t, &t->w, freq + at, r, i, 0, m);
+        } else {
+            format_job job = { t, freq + at, r, i, m };
+            long blocks = (m + FORMAT_BLOCK - 1) / FORMAT_BLOCK;
+            afc_parallel_for(blocks, 1, threads, format_blocks, &job);
+            for (long b = 0; b < blocks; b++) {
+                if (t->block[b].error && !t->w.error)
+                    t->w.error = t->block[b].error;
+                afc_write(&t->w, t->block[b].data, t->block[b].len);
+            }
+        }
+        t->err = t->w.error;
+    }
+    t->written += count;
+    return t->err;
+}
+
+int afc_ts_end(afc_ts_writer *t) {
+    if (t->err == AFC_OK && t->written != t->count)
+        t->err = AFC_ERR_ARGUMENT;
+    if (t->err == AFC_OK && t->opt.version == 2)
+        afc_write_str(&t->w, "[End]\n");
+    int err = afc_writer_free(&t->w);
+    if (t->err == AFC_OK)
+        t->err = err;
+    for (int b = 0; b < BLOCKS; b++)
+        afc_writer_free(&t->block[b]);
+    err = t->err;
+    free(t);
+    return err;
+}
+
+int afc_ts_write_ladder(FILE *out, const afc_element *el, int n, double Rs, double RL,
+                        double fstart, double fstop, long count, int log_sweep,
+                        const afc_ts_options *opt, const char *comment, int threads) {
+    int version = opt && opt->version ? opt->version : 1;
+    double R[2] = { Rs, version == 1 ? Rs : RL };
+    afc_element rev[AFC_MAX_ORDER];
+    int err;
+
+    if (n < 1 || n > AFC_MAX_ORDER)
+        return AFC_ERR_ORDER;
+    if (!(fstart > 0) || !(fstop >= fstart) || (count > 1 && !(fstop > fstart)))
+        return AFC_ERR_FREQ;
+    for (int e = 0; e < n; e++)
+        rev[e] = el[n - 1 - e];
+
+    afc_ts_writer *t = afc_ts_begin(out, 2, R, count, opt, comment, &err);
+    if (!t)
+        return err;
+    long chunk = count < AFC_TS_CHUNK ? count : AFC_TS_CHUNK;
+    // freq, then S11, S21 and S22 re and im
+    double *buf = malloc(7 * (size_t)chunk * sizeof *buf);
+    if (!buf) {
+        afc_ts_end(t);
+        return AFC_ERR_MEMORY;
+    }
+    double *freq = buf, *s11r = buf + chunk, *s11i = s11r + chunk, *s21r = s11i + chunk,
+           *s21i = s21r + chunk, *s22r = s21i + chunk, *s22i = s22r + chunk;
+    const double *re[4] = { s11r, s21r, s21r, s22r }, *im[4] = { s11i, s21i, s21i, s22i };
+    afc_response fwd = { .s21_re = s21r, .s21_im = s21i, .s11_re = s11r, .s11_im = s11i };
+    afc_response back = { .s11_re = s22r, .s11_im = s22i };
+
+    err = AFC_OK;
+    for (long at = 0; at < count && err == AFC_OK; at += chunk) {
+        long m = count - at < chunk ? count - at : chunk;
+        for (long k = 0; k < m; k++) {
+            double u = count > 1 ? (double)(at + k) / (count - 1) : 0;
+            freq[k] = log_sweep ? fstart * pow(fstop / fstart, u) : fstart + (fstop - fstart) * u;
+        }
+        if ((err = afc_ladder_response_mt(el, n, R[0], R[1], freq, m, &fwd, threads)) == AFC_OK &&
+            (err = afc_ladder_response_mt(rev, n, R[1], R[0], freq, m, &back, threads)) == AFC_OK)
+            err = afc_ts_write(t, freq, re, im, m, threads);
+    }
+    free(buf);
+    int end = afc_ts_end(t);
+    return err != AFC_OK ? err : end;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Reading                                                                */
+/* ---------------------------------------------------------------------- */
+
+void afc_touchstone_free(afc_touchstone *ts) {
+    free(ts->freq);
+    free(ts->re);
+    free(ts->im);
+    memset(ts, 0, sizeof *ts);
+}
+
+static const double exact_powers[] = { 1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                       1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+                                       1e21, 1e22 };
+
+// The number at p (before end) into *out; returns the end of it, or p if
+// there is none. Up to 2^53 in the digits and a power of ten that is
+// exact, one multiply or divide rounds correctly; anything else is copied
+// out for strtod().
+static const char *scan_number(const char *p, const char *end, double *out) {
+    const char *s = p;
+    uint64_t m = 0;
+    int digits = 0, scale = 0, neg = 0, any = 0;
+
+    if (s < end && (*s == '-' || *s == '+'))
+        neg = *s++ == '-';
+    for (; s < end && *s >= '0' && *s <= '9'; s++, any = 1)
+        if (digits < 19) {
+            m = m * 10 + (uint64_t)(*s - '0');
+            digits += m > 0;
+        } else {
+            scale++;
+        }
+    if (s < end && *s == '.')
+        for (s++; s < end && *s >= '0' && *s <= '9'; s++, any = 1)
+            if (digits < 19) {
+                m = m * 10 + (uint64_t)(*s - '0');
+                digits += m > 0;
+                scale--;
+            }
+    if (!any)
+        return p;
+    if (s < end && (*s == 'e' || *s == 'E')) {
+        const char *e = s + 1;
+        int eneg = 0, ev = 0, edigits = 0;
+        if (e < end && (*e == '-' || *e == '+'))
+            eneg = *e++ == '-';
+        for (; e < end && *e >= '0' && *e <= '9'; e++, edigits++)
+            if (ev < 10000)
+                ev = ev * 10 + (*e - '0');
+        if (edigits) {
+            s = e;
+            scale += eneg ? -ev : ev;
+        }
+    }
+
+    if (m <= (1ULL << 53) && scale >= -22 && scale <= 22) {
+        double v = (double)m;
+        v = scale >= 0 ? v * exact_powers[scale] : v / exact_powers[-scale];
+        *out = neg ? -v : v;
+        return s;
+    }
+    char buf[NUMBER_MAX];
+    if (s - p >= NUMBER_MAX)
+        return p;
+    memcpy(buf, p, s - p);
+    buf[s - p] = '\0';
+    *out = strtod(buf, NULL);
+    return s;
+}
+
+static const char *skip_blanks(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == ','))
+        p++;
+    return p;
+}
+
+// Option line "# <unit> <parameter> <format> R <ohm>", in any order and
+// case, any of them left out.
+static int parse_options(const char *p, const char *end, double *unit, afc_ts_format *format, double *R) {
+    while ((p = skip_blanks(p, end)) < end) {
+        const char *tok = p;
+        while (p < end && !isspace((unsigned char)*p))
+            p++;
+        size_t len = (size_t)(p - tok);
+        char word[8] = "";
+        if (len < sizeof word)
+            memcpy(word, tok, len);
+        if (!strcasecmp(word, "hz"))        *unit = 1;
+        else if (!strcasecmp(word, "khz"))  *unit = 1e3;
+        else if (!strcasecmp(word, "mhz"))  *unit = 1e6;
+        else if (!strcasecmp(word, "ghz"))  *unit = 1e9;
+        else if (!strcasecmp(word, "ri"))   *format = AFC_TS_RI;
+        else if (!strcasecmp(word, "ma"))   *format = AFC_TS_MA;
+        else if (!strcasecmp(word, "db"))   *format = AFC_TS_DB;
+        else if (!strcasecmp(word, "r")) {
+            const char *v = skip_blanks(p, end), *after = scan_number(v, end, R);
+            if (after == v || !(*R > 0))
+                return AFC_ERR_FORMAT;
+            p = after;
+        } else if (strcasecmp(word, "s")) {
+            return AFC_ERR_FORMAT;   // Y, Z, H and G data are not supported
+        }
+    }
+    return AFC_OK;
+}
+
+// Keyword "[name] value" of a 2.0 file: 1 if the line is [name], with p
+// past it.
+static int keyword(const char **p, const char *end, const char *name) {
+    size_t len = strlen(name);
+    if ((size_t)(end - *p) < len + 2 || strncasecmp(*p + 1, name, len) || (*p)[len + 1] != ']')
+        return 0;
+    *p = skip_blanks(*p + len + 2, end);
+    return 1;
+}
+
+// Positive whole number at q (before stop) that fits an int, or 0.
+static long count_value(const char *q, const char *stop) {
+    double v;
+    const char *n = scan_number(q, stop, &v);
+    return n != q && v >= 1 && v <= INT_MAX && v == floor(v) ? (long)v : 0;
+}
+
+// 1 if the text at q (before stop) starts with word, in any case.
+static int starts_with(const char *q, const char *stop, const char *word) {
+    size_t len = strlen(word);
+    return (size_t)(stop - q) >= len && !strncasecmp(q, word, len);
+}
+
+typedef struct {
+    afc_touchstone *ts;
+    long cap;
+    afc_ts_format format;
+    double unit;
+    int order_12_21;       // 2-port data in S11 S12 S21 S22 order
+} reader;
+
+static int push_point(reader *r, const double *v) {
+    afc_touchstone *ts = r->ts;
+    int nn = ts->ports * ts->ports;
+    if (ts->count == r->cap) {
+        long cap = r->cap ? 2 * r->cap : 1024;
+        double *pf = realloc(ts->freq, cap * sizeof *pf);
+        if (pf)
+            ts->freq = pf;
+        double *pr = realloc(ts->re, (size_t)cap * nn * sizeof *pr);
+        if (pr)
+            ts->re = pr;
+        double *pi = realloc(ts->im, (size_t)cap * nn * sizeof *pi);
+        if (pi)
+            ts->im = pi;
+        if (!pf || !pr || !pi)
+            return AFC_ERR_MEMORY;
+        r->cap = cap;
+    }
+    double *re = ts->re + (size_t)ts->count * nn, *im = ts->im + (size_t)ts->count * nn;
+    for (int i = 0; i < ts->ports; i++)
+        for (int j = 0; j < ts->ports; j++) {
+            int at = r->order_12_21 ? i * 2 + j : file_order(ts->ports, i, j);
+            double a = v[1 + 2 * at], b = v[2 + 2 * at];
+            if (r->format != AFC_TS_RI) {
+                double mag = r->format == AFC_TS_DB ? pow(10, a / 20) : a, rad = b * (AFC_M_PI / 180);
+                a = mag * cos(rad);
+                b = mag * sin(rad);
+            }
+            re[i * ts->ports + j] = a;
+            im[i * ts->ports + j] = b;
+        }
+    ts->freq[ts->count++] = v[0] * r->unit;
+    return AFC_OK;
+}
+
+static int parse(const char *p, const char *end, const char *path, afc_touchstone *ts) {
+    reader r = { .ts = ts, .format = AFC_TS_MA, .unit = 1e9 };
+    const char *dot = strrchr(path, '.');
+    double v[MAX_VALUES], R = 50;
+    long announced = 0;
+    int have = 0, options = 0, data = 0, refs = -1, err = AFC_OK;
+
+    // 1.x: the port count is in the extension
+    ts->version = 1;
+    if (dot && tolower((unsigned char)dot[1]) == 's' && isdigit((unsigned char)dot[2]))
+        ts->ports = (int)count_value(dot + 2, dot + strlen(dot));
+
+    while (p < end && err == AFC_OK) {
+        const char *eol = memchr(p, '\n', (size_t)(end - p));
+        const char *line_end = eol ? eol : end, *bang = memchr(p, '!', (size_t)(line_end - p));
+        const char *q = skip_blanks(p, bang ? bang : line_end), *stop = bang ? bang : line_end;
+        p = eol ? eol + 1 : end;
+        if (q == stop)
+            continue;
+
+        if (refs >= 0 && refs < ts->ports && *q != '[') {
+            // [Reference] values may run over several lines
+            for (const char *n; refs < ts->ports && (n = scan_number(q, stop, &ts->R[refs])) != q; q = skip_blanks(n, stop))
+                if (!(ts->R[refs++] > 0))
+                    return AFC_ERR_FORMAT;
+            if (q != stop)
+                return AFC_ERR_FORMAT;
+            continue;
+        }
+        if (*q == '#') {
+            if (!options++)
+                err = parse_options(q + 1, stop, &r.unit, &r.format, &R);
+            continue;
+        }
+        if (*q == '[') {
+            if (keyword(&q, stop, "Version")) {
+                if (q == stop || *q != '2')
+                    return AFC_ERR_FORMAT;
+                ts->version = 2;
+                ts->ports = 0;
+            } else if (keyword(&q, stop, "Number of Ports")) {
+                ts->ports = (int)count_value(q, stop);
+            } else if (keyword(&q, stop, "Two-Port Data Order")) {
+                r.order_12_21 = starts_with(q, stop, "12_21");
+                if (!r.order_12_21 && !starts_with(q, stop, "21_12"))
+                    return AFC_ERR_FORMAT;
+            } else if (keyword(&q, stop, "Number of Frequencies")) {
+                if (!(announced = count_value(q, stop)))
+                    return AFC_ERR_FORMAT;
+            } else if (keyword(&q, stop, "Reference")) {
+                if (ts->ports < 1 || ts->ports > AFC_TS_MAX_PORTS)
+                    return AFC_ERR_FORMAT;
+                refs = 0;
+                p = q < stop ? q : p;   // values on the same line are read as the next line
+            } else if (keyword(&q, stop, "Matrix Format")) {
+                if (!starts_with(q, stop, "Full"))
+                    return AFC_ERR_FORMAT;
+            } else if (keyword(&q, stop, "Network Data")) {
+                data = 1;
+            } else if (keyword(&q, stop, "Noise Data") || keyword(&q, stop, "End")) {
+                break;
+            }
+            continue;
+        }
+
+        // network data
+        if (ts->ports < 1 || ts->ports > AFC_TS_MAX_PORTS || (ts->version == 2 && !data))
+            return AFC_ERR_FORMAT;
+        int per = 1 + 2 * ts->ports * ts->ports;
+        while (q < stop) {
+            const char *n = scan_number(q, stop, &v[have]);
+            if (n == q || (n < stop && !isspace((unsigned char)*n) && *n != ','))
+                return AFC_ERR_FORMAT;
+            q = skip_blanks(n, stop);
+            if (++have < per)
+                continue;
+            have = 0;
+            if (ts->count && !(v[0] * r.unit > ts->freq[ts->count - 1])) {
+                // 1.x two-ports: noise data starts where the frequency drops
+                if (ts->version == 1 && ts->ports == 2)
+                    goto done;
+                return AFC_ERR_FORMAT;
+            }
+            if (!(v[0] > 0))
+                return AFC_ERR_FORMAT;
+            if ((err = push_point(&r, v)) != AFC_OK)
+                return err;
+        }
+    }
+done:
+    if (err != AFC_OK)
+        return err;
+    if (have || ts->count < 1 || (announced && announced != ts->count) ||
+        (refs >= 0 && refs < ts->ports))
+        return AFC_ERR_FORMAT;
+    if (refs < 0)
+        for (int i = 0; i < ts->ports; i++)
+            ts->R[i] = R;
+    return AFC_OK;
+}
+
+int afc_touchstone_load(const char *path, afc_touchstone *ts) {
+    struct stat st;
+    memset(ts, 0, sizeof *ts);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return AFC_ERR_IO;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return st.st_size == 0 ? AFC_ERR_FORMAT : AFC_ERR_IO;
+    }
+    size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return AFC_ERR_IO;
+    madvise(map, size, MADV_SEQUENTIAL);
+    int err = parse(map, (const char *)map + size, path, ts);
+    munmap(map, size);
+    if (err != AFC_OK)
+        afc_touchstone_free(ts);
+    return err;
+}
@@ -0,0 +1,106 @@
+/*
+ * Analog Filter Calculator - Touchstone files
+ * Writes the S-parameters of a designed ladder as a Touchstone 1.1 or 2.0
+ * file, and reads any S-parameter Touchstone file back, e.g. a measured
+ * filter to compare against its design.
+ *
+ * The writer streams: points are computed, formatted and handed to the
+ * file AFC_TS_CHUNK at a time, so memory stays bounded whatever the sweep
+ * length. A chunk is formatted by several workers into buffers of their
+ * own, appended in order. S12 of the reciprocal ladder is S21, and S22 is
+ * S11 of the same ladder turned around.
+ *
+ * Version 1.1 has a single reference impedance, so a ladder between
+ * unequal terminations is written referenced to Rs at both ports; that is
+ * the same network, only the numbers differ. Version 2.0 writes Rs and RL
+ * in its [Reference] line.
+ *
+ * The reader maps the file and parses the numbers in place. Options,
+ * keywords and comments follow the specification; noise data and the
+ * Y/Z/H/G parameter types are not supported (only S), nor are the Lower
+ * and Upper matrix formats of 2.0.
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_TOUCHSTONE_H
+#define AFC_TOUCHSTONE_H
+
+#include <stdio.h>
+
+#include "afc.h"
+
+#define AFC_TS_MAX_PORTS  4
+#define AFC_TS_CHUNK      16384   // points computed and written at a time
+#define AFC_TS_DIGITS     10      // significant digits written by default
+
+typedef enum {
+    AFC_TS_RI = 1,         // real, imaginary
+    AFC_TS_MA = 2,         // magnitude, angle in degrees
+    AFC_TS_DB = 3          // 20 log10 magnitude, angle in degrees
+} afc_ts_format;
+
+// Zeroed fields take the defaults: version 1, RI, GHz, AFC_TS_DIGITS.
+typedef struct {
+    int version;           // 1 or 2
+    afc_ts_format format;
+    double unit;           // Hz of the frequency unit: 1, 1e3, 1e6 or 1e9
+    int digits;            // significant digits, 1..15
+} afc_ts_options;
+
+// "ri", "ma" or "db" (any case); 0 if unknown.
+afc_ts_format afc_ts_format_from_name(const char *name);
+
+/* ---------------------------------------------------------------------- */
+/* Writing                                                                */
+/* ---------------------------------------------------------------------- */
+
+typedef struct afc_ts_writer afc_ts_writer;
+
+// Start a file of count points with ports ports, referenced to R[port]
+// (all equal for version 1) on out, after an optional comment line; with
+// out NULL the text is formatted and dropped (timing runs). Returns NULL
+// and the error in *err on failure.
+afc_ts_writer *afc_ts_begin(FILE *out, int ports, const double *R, long count,
+                            const afc_ts_options *opt, const char *comment, int *err);
+
+// Append count points: freq in Hz, ascending, and per point the complex
+// matrix as planes re[i * ports + j][k], im[...][k] for S(i+1)(j+1) at
+// freq[k]. The sweep is split across threads for formatting (0 = all
+// cores).
+int afc_ts_write(afc_ts_writer *t, const double *freq, const double *const *re,
+                 const double *const *im, long count, int threads);
+
+// Close the file structure (the point count must be what afc_ts_begin()
+// announced), flush it and release the writer. Returns the first error of
+// any call.
+int afc_ts_end(afc_ts_writer *t);
+
+// Stream the S-parameters of the n-element ladder el between Rs and RL to
+// out: count points from fstart to fstop Hz, logarithmically spaced if
+// log_sweep. Each chunk is computed and formatted across threads (0 = all
+// cores).
+int afc_ts_write_ladder(FILE *out, const afc_element *el, int n, double Rs, double RL,
+                        double fstart, double fstop, long count, int log_sweep,
+                        const afc_ts_options *opt, const char *comment, int threads);
+
+/* ---------------------------------------------------------------------- */
+/* Reading                                                                */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    int version;           // 1 or 2
+    int ports;
+    double R[AFC_TS_MAX_PORTS];   // reference impedance per port
+    long count;
+    double *freq;          // Hz, ascending
+    double *re, *im;       // S(i+1)(j+1) at freq[k] in [(k * ports + i) * ports + j]
+} afc_touchstone;
+
+// Read a Touchstone file; the port count of a 1.x file comes from its
+// extension (.s<n>p). Free it with afc_touchstone_free().
+int afc_touchstone_load(const char *path, afc_touchstone *ts);
+void afc_touchstone_free(afc_touchstone *ts);
+
+#endif
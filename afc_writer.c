@@ -0,0 +1,251 @@
+/*
+ * Analog Filter Calculator - buffered text writer
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "afc.h"
+#include "afc_writer.h"
+
+static const double powers_of_ten[] = { 1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+                                        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+                                        1e20, 1e21, 1e22 };   // all exact
+
+/* ---------------------------------------------------------------------- */
+/* Buffer                                                                 */
+/* ---------------------------------------------------------------------- */
+
+void afc_writer_init(afc_writer *w, FILE *out) {
+    memset(w, 0, sizeof *w);
+    w->out = out;
+}
+
+int afc_writer_flush(afc_writer *w) {
+    if (w->out && w->len) {
+        if (!w->error && fwrite(w->data, 1, w->len, w->out) != w->len)
+            w->error = AFC_ERR_IO;
+        w->len = 0;
+    }
+    if (w->out && !w->error && fflush(w->out) != 0)
+        w->error = AFC_ERR_IO;
+    return w->error;
+}
+
+int afc_writer_free(afc_writer *w) {
+    int err = afc_writer_flush(w);
+    free(w->data);
+    w->data = NULL;
+    w->len = w->cap = 0;
+    return err;
+}
+
+void afc_writer_reset(afc_writer *w) {
+    w->len = 0;
+}
+
+// Room for n more bytes; 0 if the buffer cannot grow.
+static int reserve(afc_writer *w, size_t n) {
+    if (w->len + n <= w->cap)
+        return 1;
+    size_t cap = w->cap ? w->cap : 4096;
+    while (cap < w->len + n)
+        cap *= 2;
+    char *p = realloc(w->data, cap);
+    if (!p) {
+        if (!w->error)
+            w->error = AFC_ERR_MEMORY;
+        return 0;
+    }
+    w->data = p;
+    w->cap = cap;
+    return 1;
+}
+
+// Hand a full chunk to the stream before the buffer grows past it.
+static void spill(afc_writer *w) {
+    if (w->out && w->len >= AFC_WRITER_CHUNK) {
+        if (!w->error && fwrite(w->data, 1, w->len, w->out) != w->len)
+            w->error = AFC_ERR_IO;
+        w->len = 0;
+    }
+}
+
+void afc_write(afc_writer *w, const char *s, size_t n) {
+    if (!reserve(w, n))
+        return;
+    memcpy(w->data + w->len, s, n);
+    w->len += n;
+    spill(w);
+}
+
+void afc_write_str(afc_writer *w, const char *s) {
+    afc_write(w, s, strlen(s));
+}
+
+void afc_write_char(afc_writer *w, char c) {
+    if (w->len < w->cap || reserve(w, 1)) {
+        w->data[w->len++] = c;
+        spill(w);
+    }
+}
+
+static void write_padded(afc_writer *w, const char *s, size_t n, int width) {
+    size_t pad = (size_t)abs(width) > n ? (size_t)abs(width) - n : 0;
+    if (!reserve(w, n + pad))
+        return;
+    if (width > 0) {
+        memset(w->data + w->len, ' ', pad);
+        w->len += pad;
+    }
+    memcpy(w->data + w->len, s, n);
+    w->len += n;
+    if (width < 0) {
+        memset(w->data + w->len, ' ', pad);
+        w->len += pad;
+    }
+    spill(w);
+}
+
+void afc_write_pad(afc_writer *w, const char *s, int width) {
+    write_padded(w, s, strlen(s), width);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Numbers                                                                */
+/* ---------------------------------------------------------------------- */
+
+// Decimal digits of v, most significant first; returns the count.
+static int put_digits(char *p, uint64_t v, int min_digits) {
+    char tmp[24];
+    int n = 0;
+    do {
+        tmp[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    while (n < min_digits)
+        tmp[n++] = '0';
+    for (int i = 0; i < n; i++)
+        p[i] = tmp[n - 1 - i];
+    return n;
+}
+
+void afc_write_int(afc_writer *w, long v, int width) {
+    char buf[24];
+    int n = 0;
+    if (v < 0)
+        buf[n++] = '-';
+    n += put_digits(buf + n, v < 0 ? -(uint64_t)v : (uint64_t)v, 1);
+    write_padded(w, buf, (size_t)n, width);
+}
+
+// x * 10^decimals is scaled in double precision and rounded; the result is
+// exact unless the fraction lands within a few ulps of one half, where the
+// rounding of the product could flip the decision. Those values, very large
+// ones and non-finite ones are left to snprintf.
+int afc_format_fixed(char *buf, double x, int decimals) {
+    double s = fabs(x) * powers_of_ten[decimals];
+    if (!(s < 0x1p52))
+        return snprintf(buf, AFC_FIXED_MAX, "%.*f", decimals, x);
+    double fl = floor(s), frac = s - fl;
+    if (fabs(frac - 0.5) <= s * 0x1p-50 + 0x1p-60)
+        return snprintf(buf, AFC_FIXED_MAX, "%.*f", decimals, x);
+
+    uint64_t q = (uint64_t)fl + (frac > 0.5);
+    uint64_t scale = (uint64_t)powers_of_ten[decimals];
+    int n = 0;
+    if (signbit(x))
+        buf[n++] = '-';
+    n += put_digits(buf + n, q / scale, 1);
+    if (decimals > 0) {
+        buf[n++] = '.';
+        n += put_digits(buf + n, q % scale, decimals);
+    }
+    buf[n] = '\0';
+    return n;
+}
+
+void afc_write_fixed(afc_writer *w, double x, int decimals, int width) {
+    char buf[AFC_FIXED_MAX];
+    int n = afc_format_fixed(buf, x, decimals);
+    write_padded(w, buf, (size_t)n, width);
+}
+
+// Scaled the same way to decimals + 1 significant digits, when the power of
+// ten is exact (|k| <= 22) and the digits fit a double's integers; the
+// rest, half-way cases and values that round across a decade boundary the
+// scaling cannot settle go to snprintf.
+int afc_format_exp(char *buf, double x, int decimals) {
+    double a = fabs(x);
+    int e = 0;
+    uint64_t q = 0;
+    if (!isfinite(x) || decimals > 14)
+        return snprintf(buf, AFC_EXP_MAX, "%.*e", decimals, x);
+    if (a > 0) {
+        // the decade from the binary exponent, one short at most
+        int b;
+        frexp(a, &b);
+        e = (int)floor((b - 1) * 0.30102999566398120);
+        int k = decimals - e;
+        if (k < -21 || k > 22)
+            return snprintf(buf, AFC_EXP_MAX, "%.*e", decimals, x);
+        double s = k >= 0 ? a * powers_of_ten[k] : a / powers_of_ten[-k];
+        if (s >= 10 * powers_of_ten[decimals]) {
+            e++, k--;
+            s = k >= 0 ? a * powers_of_ten[k] : a / powers_of_ten[-k];
+        }
+        double fl = floor(s), frac = s - fl;
+        if (fabs(frac - 0.5) <= s * 0x1p-50 + 0x1p-60)
+            return snprintf(buf, AFC_EXP_MAX, "%.*e", decimals, x);
+        uint64_t low = (uint64_t)powers_of_ten[decimals];
+        q = (uint64_t)fl + (frac > 0.5);
+        if (q == 10 * low) {          // rounded up into the next decade
+            q = low;
+            e++;
+        } else if (q < low || q > 10 * low) {
+            return snprintf(buf, AFC_EXP_MAX, "%.*e", decimals, x);
+        }
+    }
+
+    char digits[24];
+    int n = 0, nd = put_digits(digits, q, decimals + 1);
+    if (signbit(x))
+        buf[n++] = '-';
+    buf[n++] = digits[0];
+    if (decimals > 0) {
+        buf[n++] = '.';
+        memcpy(buf + n, digits + 1, nd - 1);
+        n += nd - 1;
+    }
+    buf[n++] = 'e';
+    buf[n++] = e < 0 ? '-' : '+';
+    n += put_digits(buf + n, (uint64_t)abs(e), 2);
+    buf[n] = '\0';
+    return n;
+}
+
+void afc_write_exp(afc_writer *w, double x, int decimals, int width) {
+    char buf[AFC_EXP_MAX];
+    int n = afc_format_exp(buf, x, decimals);
+    write_padded(w, buf, (size_t)n, width);
+}
+
+void afc_write_spice_value(afc_writer *w, double x) {
+    static const char *suffix[] = { "f", "p", "n", "u", "m", "", "k", "meg", "g" };
+    double a = fabs(x), scale = 1e-15;
+    int p = 0;
+    if (a == 0 || !isfinite(x)) {
+        afc_write_fixed(w, x, 6, 0);
+        return;
+    }
+    // largest prefix that keeps the rounded mantissa at 1 or above
+    while (p < 8 && a >= scale * 1000 * (1 - 5e-10))
+        scale *= 1000, p++;
+    afc_write_fixed(w, x / scale, 6, 0);
+    afc_write_str(w, suffix[p]);
+}
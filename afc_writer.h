@@ -0,0 +1,68 @@
+/*
+ * Analog Filter Calculator - buffered text writer
+ * Appends text and numbers to a growing buffer. A writer bound to a FILE
+ * hands the buffer to it in AFC_WRITER_CHUNK sized writes; an unbound
+ * writer just collects text, e.g. one per worker, to be appended in order
+ * to a bound writer later.
+ *
+ * Numbers are formatted without printf: afc_write_fixed() gives the same
+ * bytes as "%*.*f", afc_write_exp() as "%*.*e" and afc_write_int() as
+ * "%*ld".
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#ifndef AFC_WRITER_H
+#define AFC_WRITER_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#define AFC_WRITER_CHUNK (1 << 20)
+#define AFC_FIXED_MAX    352      // "%.9f" of the largest double
+#define AFC_EXP_MAX      32       // "%.17e" of any double
+
+typedef struct {
+    char *data;
+    size_t len, cap;
+    FILE *out;             // NULL: collect only
+    int error;             // first AFC_ERR_MEMORY / AFC_ERR_IO, sticky
+} afc_writer;
+
+void afc_writer_init(afc_writer *w, FILE *out);
+
+// Write out what is buffered (bound writers only). Returns w->error.
+int afc_writer_flush(afc_writer *w);
+
+// Flush and release the buffer. Returns w->error.
+int afc_writer_free(afc_writer *w);
+
+// Drop the buffered text of a collect-only writer, keeping the memory.
+void afc_writer_reset(afc_writer *w);
+
+void afc_write(afc_writer *w, const char *s, size_t n);
+void afc_write_str(afc_writer *w, const char *s);
+void afc_write_char(afc_writer *w, char c);
+
+// s padded with spaces to |width| characters: right-aligned for width > 0,
+// left-aligned for width < 0 (like "%*s").
+void afc_write_pad(afc_writer *w, const char *s, int width);
+
+// Integer and fixed-point numbers with the same width convention.
+void afc_write_int(afc_writer *w, long v, int width);
+void afc_write_fixed(afc_writer *w, double x, int decimals, int width);
+void afc_write_exp(afc_writer *w, double x, int decimals, int width);
+
+// x as a SPICE value: six decimals and a scale suffix, e.g. 3.183099n.
+void afc_write_spice_value(afc_writer *w, double x);
+
+// Format x like "%.*f" into buf of AFC_FIXED_MAX bytes and return the
+// length. decimals must be 0..9.
+int afc_format_fixed(char *buf, double x, int decimals);
+
+// Format x like "%.*e" into buf of AFC_EXP_MAX bytes and return the length.
+// decimals must be 0..17.
+int afc_format_exp(char *buf, double x, int decimals);
+
+#endif
@@ -0,0 +1,223 @@
+/*
+ * Batch Filter Design Engine
+ * Non-interactive front-end that reads a stream of design specs (CSV or
+ * JSON Lines) and writes the component values of every design in input order.
+ * Records are designed in parallel across all cores, block by block, so the
+ * memory use stays bounded however long the input is.
+ *
+ * Record formats are described in afc_spec.h and output formats in
+ * afc_table.h; by default the output follows the input format. Even-order
+ * Chebyshev designs also report the load impedance they need.
+ *
+ * With --stats the time spent in each stage (parsing, prototypes,
+ * denormalization, formatting) is reported on stderr at the end, as a
+ * table or with --stats=json as one JSON line (see afc_stats.h).
+ *
+ * Usage: filter_batch [-j threads] [-f csv|jsonl] [-o csv|json|md|spice] [--stats[=json]]
+ *                     [input [output]]
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_parallel.h"
+#include "afc_spec.h"
+#include "afc_stats.h"
+#include "afc_table.h"
+#include "afc_writer.h"
+
+#define BLOCK_SIZE  65536   // records designed per parallel block
+#define CHUNK_SIZE  256     // records claimed by a worker at a time
+
+enum { FMT_CSV = 1, FMT_JSONL = 2 };
+
+/* ---------------------------------------------------------------------- */
+/* Design                                                                 */
+/* ---------------------------------------------------------------------- */
+
+// Design one record and append its output to w.
+static void design_record(char *line, int fmt, afc_out_format out, long index, afc_writer *w) {
+    afc_spec s;
+    afc_element el[AFC_MAX_ORDER];
+    const char *err = fmt == FMT_CSV ? afc_spec_from_csv(line, &s) : afc_spec_from_jsonl(line, &s);
+    int n = 0;
+
+    if (!err && (n = afc_design(&s, el, AFC_MAX_ORDER)) < 0)
+        err = afc_strerror(n);
+    if (err)
+        afc_write_error(w, out, index, err);
+    else
+        afc_write_design(w, out, index, &s, el, n);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Parallel block processing                                              */
+/* ---------------------------------------------------------------------- */
+
+typedef struct {
+    char **lines;
+    long first_index;     // design number of lines[0]
+    int fmt;
+    afc_out_format out;
+    afc_writer *chunks;   // one collect-only writer per chunk, written in order
+} block_job;
+
+static void design_chunk(void *ctx, long begin, long end, int tid) {
+    block_job *job = ctx;
+    afc_writer *w = &job->chunks[begin / CHUNK_SIZE];
+    (void)tid;
+    afc_writer_reset(w);
+    for (long i = begin; i < end; i++)
+        design_record(job->lines[i], job->fmt, job->out, job->first_index + i, w);
+}
+
+// Design a block and append the chunks in input order, so the output is
+// the same for any thread count.
+static void run_block(block_job *job, int count, int threads, afc_writer *out) {
+    afc_parallel_for(count, CHUNK_SIZE, threads, design_chunk, job);
+    for (int c = 0; c < (count + CHUNK_SIZE - 1) / CHUNK_SIZE; c++) {
+        afc_write(out, job->chunks[c].data, job->chunks[c].len);
+        if (job->chunks[c].error && !out->error)
+            out->error = job->chunks[c].error;
+    }
+}
+
+static int detect_format(const char *line) {
+    while (isspace((unsigned char)*line))
+        line++;
+    return *line == '{' ? FMT_JSONL : FMT_CSV;
+}
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_batch [-j threads] [-f csv|jsonl] [-o csv|json|md|spice] [--stats[=json]]\n"
+                    "                    [input [output]]\n");
+}
+
+int main(int argc, char **argv) {
+    int threads = 0;
+    int fmt = 0, stats = 0;
+    afc_out_format outFmt = 0;
+    const char *inPath = NULL, *outPath = NULL;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-j") && a + 1 < argc) {
+            threads = atoi(argv[++a]);
+        } else if (!strcmp(argv[a], "-f") && a + 1 < argc) {
+            a++;
+            if (!strcasecmp(argv[a], "csv"))
+                fmt = FMT_CSV;
+            else if (!strcasecmp(argv[a], "jsonl"))
+                fmt = FMT_JSONL;
+            else {
+                usage();
+                return 1;
+            }
+        } else if (!strcmp(argv[a], "-o") && a + 1 < argc) {
+            if (!(outFmt = afc_out_format_from_name(argv[++a]))) {
+                usage();
+                return 1;
+            }
+        } else if (!strncmp(argv[a], "--stats", 7)) {
+            if ((stats = afc_stats_option(argv[a])) < 0) {
+                usage();
+                return 1;
+            }
+            afc_stats_enable();
+        } else if (argv[a][0] == '-' && argv[a][1] != '\0') {
+            usage();
+            return 1;
+        } else if (!inPath) {
+            inPath = argv[a];
+        } else if (!outPath) {
+            outPath = argv[a];
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    threads = afc_thread_count(threads);
+
+    FILE *in = (inPath && strcmp(inPath, "-")) ? fopen(inPath, "r") : stdin;
+    FILE *out = (outPath && strcmp(outPath, "-")) ? fopen(outPath, "w") : stdout;
+    if (!in || !out) {
+        perror("filter_batch");
+        return 1;
+    }
+
+    char **lines = calloc(BLOCK_SIZE, sizeof *lines);
+    size_t *caps = calloc(BLOCK_SIZE, sizeof *caps);
+    afc_writer *chunks = calloc((BLOCK_SIZE + CHUNK_SIZE - 1) / CHUNK_SIZE, sizeof *chunks);
+    if (!lines || !caps || !chunks) {
+        fprintf(stderr, "filter_batch: out of memory\n");
+        return 1;
+    }
+
+    block_job job = { .lines = lines, .chunks = chunks, .fmt = fmt };
+    afc_writer w;
+    afc_writer_init(&w, out);
+    long designs = 0;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    for (;;) {
+        int count = 0;
+        while (count < BLOCK_SIZE && getline(&lines[count], &caps[count], in) > 0) {
+            char *l = afc_trim(lines[count]);
+            // skip blank lines, comments and a CSV header row
+            if (*l == '\0' || *l == '#' || !strncasecmp(l, "family", 6))
+                continue;
+            if (!fmt)
+                fmt = detect_format(l);
+            memmove(lines[count], l, strlen(l) + 1);
+            count++;
+        }
+        if (count == 0)
+            break;
+        // results follow the input format unless -o says otherwise
+        if (!outFmt)
+            outFmt = fmt == FMT_CSV ? AFC_OUT_CSV : AFC_OUT_JSON;
+        if (designs == 0)
+            afc_write_preamble(&w, outFmt);
+        job.fmt = fmt;
+        job.out = outFmt;
+        job.first_index = designs + 1;
+        run_block(&job, count, threads, &w);
+        designs += count;
+        if (count < BLOCK_SIZE)
+            break;
+    }
+
+    int err = afc_writer_free(&w);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    fprintf(stderr, "Processed %ld designs in %.3f s (%.0f designs/s, %d threads)\n",
+            designs, secs, secs > 0 ? designs / secs : 0.0, threads);
+
+    if (out != stdout && fclose(out) != 0)
+        err = AFC_ERR_IO;
+    if (err)
+        fprintf(stderr, "filter_batch: %s\n", afc_strerror(err));
+    if (stats) {
+        afc_stats st;
+        afc_stats_collect(&st);
+        afc_stats_print(stderr, &st, stats == 2);
+    }
+    if (in != stdin)
+        fclose(in);
+    for (int i = 0; i < BLOCK_SIZE; i++)
+        free(lines[i]);
+    for (int c = 0; c < (BLOCK_SIZE + CHUNK_SIZE - 1) / CHUNK_SIZE; c++)
+        afc_writer_free(&chunks[c]);
+    free(lines);
+    free(caps);
+    free(chunks);
+    return err ? 1 : 0;
+}
@@ -0,0 +1,506 @@
+/*
+ * Analog Filter Calculator - microbenchmarks
+ * Times each stage of the design pipeline on its own: prototype generation
+ * per family, denormalization per filter type, table formatting, the
+ * response sweep with ideal and with lossy parts, the element
+ * sensitivities, incremental updates, rescaling, the step response, a
+ * multiplexer design and a fit to a measured sweep.
+ * Every stage is calibrated to ~2 ms per sample, warmed up
+ * and then sampled repeatedly; the median, p10/p90 and minimum time per
+ * operation are reported.
+ *
+ * Usage: filter_bench [-r reps] [-s stage] [-save file] [-compare file [-threshold pct]]
+ *   -save     store the medians as a baseline
+ *   -compare  exit with status 1 if a stage is slower than the baseline
+ *             by more than the threshold (default 10 %)
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_fit.h"
+#include "afc_mux.h"
+#include "afc_parasitic.h"
+#include "afc_response.h"
+#include "afc_table.h"
+#include "afc_time.h"
+#include "afc_touchstone.h"
+#include "afc_writer.h"
+
+#define MAX_REPS        1001
+#define WARMUP_SAMPLES  3
+#define SAMPLE_NS       2e6
+#define BENCH_ORDER     7
+#define SWEEP_POINTS    1024
+#define TREE_ORDER      31
+#define MUX_CHANNELS    32
+#define FIT_STARTS      8
+
+typedef struct {
+    const char *name;
+    void (*run)(long iterations);
+} bench_stage;
+
+typedef struct {
+    double median, p10, p90, min;   // ns per operation
+} bench_result;
+
+static volatile double sink;       // keeps the work observable
+
+/* ---------------------------------------------------------------------- */
+/* Stages                                                                 */
+/* ---------------------------------------------------------------------- */
+
+static void run_prototype(afc_family family, double ripple_dB, long iterations) {
+    double g[AFC_MAX_ORDER + 1], acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        afc_prototype(family, 1 + (int)(i % 10), ripple_dB, AFC_NORM_3DB, g);
+        acc += g[0];
+    }
+    sink = acc;
+}
+
+// Orders 1-10; 0.1 dB Chebyshev comes from the generated table, 0.15 dB
+// from the memo cache (filled during the warm-up)
+static void proto_butterworth(long iterations)     { run_prototype(AFC_BUTTERWORTH, 0, iterations); }
+static void proto_chebyshev(long iterations)       { run_prototype(AFC_CHEBYSHEV, 0.15, iterations); }
+static void proto_chebyshev_table(long iterations) { run_prototype(AFC_CHEBYSHEV, 0.1, iterations); }
+static void proto_bessel(long iterations)          { run_prototype(AFC_BESSEL, 0, iterations); }
+
+// The Chebyshev recurrence itself, bypassing table and cache
+static void synth_chebyshev(long iterations) {
+    double g[AFC_MAX_ORDER + 1], f3dB, acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        afc_chebyshev_synthesize(1 + (int)(i % 10), 0.15, g, &f3dB);
+        acc += g[0];
+    }
+    sink = acc;
+}
+
+// Elliptic designs of orders 3-10 through the prototype cache
+static void proto_elliptic(long iterations) {
+    afc_spec spec = { .family = AFC_ELLIPTIC, .type = AFC_LOWPASS, .ripple_dB = 0.1,
+                      .stop_dB = 60, .freq = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_element el[AFC_MAX_ORDER];
+    double acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        spec.order = 3 + (int)(i % 8);
+        afc_design(&spec, el, AFC_MAX_ORDER);
+        acc += el[0].C;
+    }
+    sink = acc;
+}
+
+// The same orders synthesized from scratch every time
+static void synth_elliptic(long iterations) {
+    double g[AFC_MAX_ORDER + 1], gz[AFC_MAX_ORDER + 1], f3dB, ws, acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        afc_elliptic_synthesize(3 + (int)(i % 8), 0.1, 60, g, gz, &f3dB, &ws);
+        acc += g[0];
+    }
+    sink = acc;
+}
+
+static void run_denormalize(afc_type type, long iterations) {
+    afc_spec spec = { .family = AFC_BUTTERWORTH, .type = type, .order = BENCH_ORDER,
+                      .freq = 10e6, .bw = 1e6, .topology = AFC_PI, .R = 50 };
+    double g[AFC_MAX_ORDER + 1];
+    afc_element el[AFC_MAX_ORDER];
+    double acc = 0;
+    afc_prototype(spec.family, spec.order, 0, AFC_NORM_3DB, g);
+    for (long i = 0; i < iterations; i++) {
+        spec.topology = (i & 1) ? AFC_TEE : AFC_PI;
+        afc_denormalize(&spec, g, el, AFC_MAX_ORDER);
+        acc += el[0].C + el[0].L;
+    }
+    sink = acc;
+}
+
+static void denorm_lowpass(long iterations)   { run_denormalize(AFC_LOWPASS, iterations); }
+static void denorm_highpass(long iterations)  { run_denormalize(AFC_HIGHPASS, iterations); }
+static void denorm_bandpass(long iterations)  { run_denormalize(AFC_BANDPASS, iterations); }
+static void denorm_bandreject(long iterations){ run_denormalize(AFC_BANDREJECT, iterations); }
+
+// Element table of a 7th-order design, formatted into memory.
+static void table_format(long iterations) {
+    afc_spec spec = { .family = AFC_CHEBYSHEV, .type = AFC_LOWPASS, .order = BENCH_ORDER,
+                      .ripple_dB = 0.1, .freq = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_element el[AFC_MAX_ORDER];
+    double sens[AFC_MAX_ORDER];
+    afc_writer w;
+    int n = afc_design(&spec, el, AFC_MAX_ORDER);
+
+    afc_pass_band_sensitivity(&spec, el, n, sens);
+    afc_writer_init(&w, NULL);
+    for (long i = 0; i < iterations; i++) {
+        afc_writer_reset(&w);
+        afc_write_table_rows(&w, spec.type, el, n, sens);
+    }
+    sink = w.len;
+    afc_writer_free(&w);
+}
+
+// One call evaluates SWEEP_POINTS frequencies of a 7th-order band-pass.
+static void response_sweep(long iterations) {
+    static double freq[SWEEP_POINTS], il[SWEEP_POINTS], gd[SWEEP_POINTS];
+    afc_spec spec = { .family = AFC_CHEBYSHEV, .type = AFC_BANDPASS, .order = BENCH_ORDER,
+                      .ripple_dB = 0.1, .freq = 10e6, .bw = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_element el[AFC_MAX_ORDER];
+    afc_response resp = { .il_dB = il, .gd = gd };
+    int n = afc_design(&spec, el, AFC_MAX_ORDER);
+    for (int i = 0; i < SWEEP_POINTS; i++)
+        freq[i] = 5e6 + 10e6 * i / SWEEP_POINTS;
+    for (long i = 0; i < iterations; i++)
+        afc_ladder_response(el, n, spec.R, spec.R, freq, SWEEP_POINTS, &resp);
+    sink = il[SWEEP_POINTS / 2];
+}
+
+// The same sweep with Q = 50 inductors and 0.1 ohm ESR capacitors, from a
+// part table built once.
+static void parasitic_sweep(long iterations) {
+    static double freq[SWEEP_POINTS], il[SWEEP_POINTS], gd[SWEEP_POINTS];
+    static afc_part_table parts;
+    afc_spec spec = { .family = AFC_CHEBYSHEV, .type = AFC_BANDPASS, .order = BENCH_ORDER,
+                      .ripple_dB = 0.1, .freq = 10e6, .bw = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_response resp = { .il_dB = il, .gd = gd };
+
+    if (!parts.z) {
+        afc_element el[AFC_MAX_ORDER];
+        afc_parasitics para = { .L = { .Q = 50 }, .C = { .ESR = 0.1 } };
+        int n = afc_design(&spec, el, AFC_MAX_ORDER);
+        for (int i = 0; i < SWEEP_POINTS; i++)
+            freq[i] = 5e6 + 10e6 * i / SWEEP_POINTS;
+        afc_part_table_init(&parts, el, n, &para, freq, SWEEP_POINTS);
+    }
+    for (long i = 0; i < iterations; i++)
+        afc_part_table_response(&parts, spec.R, spec.R, NULL, NULL, &resp, 1);
+    sink = il[SWEEP_POINTS / 2];
+}
+
+// Step response figures of the band-pass envelope, on one thread.
+static void step_response(long iterations) {
+    afc_spec spec = { .family = AFC_CHEBYSHEV, .type = AFC_BANDPASS, .order = BENCH_ORDER,
+                      .ripple_dB = 0.1, .freq = 10e6, .bw = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_element el[AFC_MAX_ORDER];
+    afc_step_config cfg = { .threads = 1 };
+    afc_step_metrics m;
+    int n = afc_design(&spec, el, AFC_MAX_ORDER);
+    for (long i = 0; i < iterations; i++)
+        afc_step_response(&spec, el, n, &cfg, &m);
+    sink = m.settling_time;
+}
+
+// A 32-channel Tee filter bank with the junction correction, on one thread.
+static void mux_design(long iterations) {
+    static afc_mux_channel plan[MUX_CHANNELS];
+    afc_mux_config cfg = { .channels = MUX_CHANNELS, .plan = plan, .threads = 1,
+                           .base = { .family = AFC_CHEBYSHEV, .order = BENCH_ORDER, .ripple_dB = 0.1,
+                                     .topology = AFC_TEE, .R = 50 } };
+    afc_mux mux;
+    for (int c = 0; c < MUX_CHANNELS; c++) {
+        plan[c].freq = 1e9 + 20e6 * c;
+        plan[c].bw = 15e6;
+    }
+    for (long i = 0; i < iterations; i++) {
+        afc_mux_init(&mux, &cfg);
+        sink = mux.el[0][0].L;
+        afc_mux_free(&mux);
+    }
+}
+
+// A shunt-first (PI) diplexer, whose correction runs into its limit and
+// ends with the match check failing, on one thread.
+static void mux_diplexer_pi(long iterations) {
+    static const afc_mux_channel plan[2] = { { 10e6, 1e6 }, { 15e6, 1e6 } };
+    afc_mux_config cfg = { .channels = 2, .plan = plan, .threads = 1,
+                           .base = { .family = AFC_CHEBYSHEV, .order = 3, .ripple_dB = 0.1,
+                                     .topology = AFC_PI, .R = 50 } };
+    afc_mux mux;
+    for (long i = 0; i < iterations; i++) {
+        afc_mux_init(&mux, &cfg);
+        sink = mux.converged ? mux.el[0][0].L : mux.centre_rl_dB;
+        afc_mux_free(&mux);
+    }
+}
+
+// Fit of the low-pass ladder to its own response with one capacitor 10 %
+// high, from FIT_STARTS starts on one thread.
+static void ladder_fit(long iterations) {
+    static double freq[SWEEP_POINTS], il[SWEEP_POINTS], rl[SWEEP_POINTS];
+    afc_spec spec = { .family = AFC_CHEBYSHEV, .type = AFC_LOWPASS, .order = BENCH_ORDER,
+                      .ripple_dB = 0.1, .freq = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_element el[AFC_MAX_ORDER], built[AFC_MAX_ORDER];
+    afc_fit_target target = { .count = SWEEP_POINTS, .freq = freq, .il_dB = il, .rl_dB = rl };
+    afc_fit_config cfg = { .starts = FIT_STARTS, .threads = 1 };
+    afc_fit_result fit;
+    int n = afc_design(&spec, el, AFC_MAX_ORDER);
+    memcpy(built, el, n * sizeof *el);
+    built[2].C *= 1.1;
+    for (int i = 0; i < SWEEP_POINTS; i++)
+        freq[i] = 1e4 + 3e6 * i / SWEEP_POINTS;
+    afc_response resp = { .il_dB = il, .rl_dB = rl };
+    afc_ladder_response(built, n, spec.R, spec.R, freq, SWEEP_POINTS, &resp);
+    for (long i = 0; i < iterations; i++)
+        afc_fit(el, n, spec.R, spec.R, &target, &cfg, &fit);
+    sink = fit.el[2].C;
+}
+
+// S-parameters of the same band-pass at SWEEP_POINTS frequencies as a
+// Touchstone file in dB/angle, formatted into memory on one thread.
+static void touchstone_write(long iterations) {
+    afc_spec spec = { .family = AFC_CHEBYSHEV, .type = AFC_BANDPASS, .order = BENCH_ORDER,
+                      .ripple_dB = 0.1, .freq = 10e6, .bw = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_ts_options opt = { .format = AFC_TS_DB };
+    afc_element el[AFC_MAX_ORDER];
+    int n = afc_design(&spec, el, AFC_MAX_ORDER);
+    for (long i = 0; i < iterations; i++)
+        sink = afc_ts_write_ladder(NULL, el, n, spec.R, spec.R, 5e6, 15e6, SWEEP_POINTS, 0,
+                                   &opt, NULL, 1);
+}
+
+// Loss and delay sensitivities of every element of the same band-pass at
+// SWEEP_POINTS frequencies, on one thread.
+static void sensitivity(long iterations) {
+    static double freq[SWEEP_POINTS], il_C[SWEEP_POINTS * BENCH_ORDER], il_L[SWEEP_POINTS * BENCH_ORDER];
+    static double gd_C[SWEEP_POINTS * BENCH_ORDER], gd_L[SWEEP_POINTS * BENCH_ORDER];
+    afc_spec spec = { .family = AFC_CHEBYSHEV, .type = AFC_BANDPASS, .order = BENCH_ORDER,
+                      .ripple_dB = 0.1, .freq = 10e6, .bw = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_element el[AFC_MAX_ORDER];
+    afc_sensitivity sens = { il_C, il_L, gd_C, gd_L };
+    int n = afc_design(&spec, el, AFC_MAX_ORDER);
+    for (int i = 0; i < SWEEP_POINTS; i++)
+        freq[i] = 5e6 + 10e6 * i / SWEEP_POINTS;
+    for (long i = 0; i < iterations; i++)
+        afc_ladder_sensitivity(el, n, spec.R, spec.R, freq, SWEEP_POINTS, &sens, 1);
+    sink = il_C[SWEEP_POINTS / 2 * BENCH_ORDER];
+}
+
+// One element of a 31st-order low-pass retuned in an afc_ladder_tree of
+// SWEEP_POINTS frequencies (loss only), cycling through the elements.
+static void tree_update(long iterations) {
+    static double freq[SWEEP_POINTS];
+    static afc_ladder_tree tree;
+    static afc_element el[AFC_MAX_ORDER];
+    afc_spec spec = { .family = AFC_CHEBYSHEV, .type = AFC_LOWPASS, .order = TREE_ORDER,
+                      .ripple_dB = 0.1, .freq = 10e6, .topology = AFC_PI, .R = 50 };
+
+    if (!tree.nodes) {
+        afc_design(&spec, el, AFC_MAX_ORDER);
+        for (int i = 0; i < SWEEP_POINTS; i++)
+            freq[i] = 20e6 * i / SWEEP_POINTS + 1e3;
+        afc_tree_init(&tree, el, TREE_ORDER, spec.R, spec.R, freq, SWEEP_POINTS, 0, 1);
+    }
+    for (long i = 0; i < iterations; i++) {
+        int k = (int)(i % TREE_ORDER);
+        afc_element e = el[k];
+        e.C *= (i & 1) ? 1.01 : 1;
+        e.L *= (i & 1) ? 1.01 : 1;
+        afc_tree_set(&tree, k, &e);
+    }
+    sink = tree.nodes[0];
+}
+
+// A designed elliptic low-pass moved to a new cutoff and impedance.
+static void rescale(long iterations) {
+    afc_spec from = { .family = AFC_ELLIPTIC, .type = AFC_LOWPASS, .order = BENCH_ORDER,
+                      .ripple_dB = 0.1, .stop_dB = 60, .freq = 1e6, .topology = AFC_PI, .R = 50 };
+    afc_spec to = from;
+    afc_element el[AFC_MAX_ORDER], out[AFC_MAX_ORDER];
+    int n = afc_design(&from, el, AFC_MAX_ORDER);
+    double acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        to.freq = 1e6 + (double)(i & 1023);
+        to.R = (i & 1) ? 75 : 50;
+        afc_rescale(&from, el, n, &to, out, AFC_MAX_ORDER);
+        acc += out[0].C;
+    }
+    sink = acc;
+}
+
+static const bench_stage stages[] = {
+    { "proto_butterworth", proto_butterworth },
+    { "proto_chebyshev",   proto_chebyshev },
+    { "proto_cheb_table",  proto_chebyshev_table },
+    { "synth_chebyshev",   synth_chebyshev },
+    { "proto_bessel",      proto_bessel },
+    { "proto_elliptic",    proto_elliptic },
+    { "synth_elliptic",    synth_elliptic },
+    { "denorm_lowpass",    denorm_lowpass },
+    { "denorm_highpass",   denorm_highpass },
+    { "denorm_bandpass",   denorm_bandpass },
+    { "denorm_bandreject", denorm_bandreject },
+    { "table_format",      table_format },
+    { "response_sweep",    response_sweep },
+    { "parasitic_sweep",   parasitic_sweep },
+    { "sensitivity",       sensitivity },
+    { "tree_update",       tree_update },
+    { "rescale",           rescale },
+    { "step_response",     step_response },
+    { "mux_design",        mux_design },
+    { "mux_diplexer_pi",   mux_diplexer_pi },
+    { "ladder_fit",        ladder_fit },
+    { "touchstone_write",  touchstone_write },
+};
+
+#define NSTAGES (int)(sizeof stages / sizeof stages[0])
+
+/* ---------------------------------------------------------------------- */
+/* Measurement                                                            */
+/* ---------------------------------------------------------------------- */
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile(const double *sorted, int n, double p) {
+    double pos = p / 100 * (n - 1);
+    int i = (int)pos;
+    return i + 1 < n ? sorted[i] + (sorted[i + 1] - sorted[i]) * (pos - i) : sorted[n - 1];
+}
+
+static bench_result measure(const bench_stage *s, int reps) {
+    double samples[MAX_REPS];
+    long iterations = 1;
+    bench_result r;
+
+    // grow the batch until one sample takes about SAMPLE_NS
+    for (;;) {
+        double t0 = now_ns();
+        s->run(iterations);
+        double dt = now_ns() - t0;
+        if (dt >= SAMPLE_NS || iterations >= (1L << 30))
+            break;
+        iterations = dt > 0 && SAMPLE_NS / dt < 100 ? (long)(iterations * SAMPLE_NS / dt) + 1 : iterations * 100;
+    }
+    for (int w = 0; w < WARMUP_SAMPLES; w++)
+        s->run(iterations);
+    for (int k = 0; k < reps; k++) {
+        double t0 = now_ns();
+        s->run(iterations);
+        samples[k] = (now_ns() - t0) / iterations;
+    }
+
+    qsort(samples, reps, sizeof *samples, cmp_double);
+    r.median = percentile(samples, reps, 50);
+    r.p10 = percentile(samples, reps, 10);
+    r.p90 = percentile(samples, reps, 90);
+    r.min = samples[0];
+    return r;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Baselines                                                              */
+/* ---------------------------------------------------------------------- */
+
+// Median of stage name in a baseline file, or 0 if it is not listed.
+static double baseline_median(FILE *f, const char *name) {
+    char line[256], stage[128];
+    double median;
+    rewind(f);
+    while (fgets(line, sizeof line, f))
+        if (line[0] != '#' && sscanf(line, "%127s %lf", stage, &median) == 2 && !strcmp(stage, name))
+            return median;
+    return 0;
+}
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_bench [-r reps] [-s stage] [-save file] [-compare file [-threshold pct]]\n");
+}
+
+int main(int argc, char **argv) {
+    int reps = 31;
+    double threshold = 10;
+    const char *only = NULL, *savePath = NULL, *comparePath = NULL;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-r") && a + 1 < argc)
+            reps = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-s") && a + 1 < argc)
+            only = argv[++a];
+        else if (!strcmp(argv[a], "-save") && a + 1 < argc)
+            savePath = argv[++a];
+        else if (!strcmp(argv[a], "-compare") && a + 1 < argc)
+            comparePath = argv[++a];
+        else if (!strcmp(argv[a], "-threshold") && a + 1 < argc)
+            threshold = atof(argv[++a]);
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (reps < 1 || reps > MAX_REPS) {
+        usage();
+        return 1;
+    }
+    int found = !only;
+    for (int s = 0; s < NSTAGES && !found; s++)
+        found = !strcmp(only, stages[s].name);
+    if (!found) {
+        fprintf(stderr, "filter_bench: unknown stage \"%s\"; stages:", only);
+        for (int s = 0; s < NSTAGES; s++)
+            fprintf(stderr, " %s", stages[s].name);
+        fprintf(stderr, "\n");
+        usage();
+        return 1;
+    }
+
+    FILE *save = savePath ? fopen(savePath, "w") : NULL;
+    FILE *base = comparePath ? fopen(comparePath, "r") : NULL;
+    if ((savePath && !save) || (comparePath && !base)) {
+        perror("filter_bench");
+        return 1;
+    }
+    if (save)
+        fprintf(save, "# stage median_ns (filter_bench, %d reps)\n", reps);
+
+    int regressions = 0;
+    printf("| Stage              | Median (ns) | p10 (ns)  | p90 (ns)  | Min (ns)  |%s\n",
+           base ? " Baseline  | Change  |" : "");
+    printf("|--------------------|-------------|-----------|-----------|-----------|%s\n",
+           base ? "-----------|---------|" : "");
+    for (int s = 0; s < NSTAGES; s++) {
+        if (only && strcmp(only, stages[s].name))
+            continue;
+        bench_result r = measure(&stages[s], reps);
+        printf("| %-18s | %11.1f | %9.1f | %9.1f | %9.1f |", stages[s].name, r.median, r.p10, r.p90, r.min);
+        if (base) {
+            double b = baseline_median(base, stages[s].name);
+            if (b > 0) {
+                double change = 100 * (r.median / b - 1);
+                int slow = change > threshold;
+                regressions += slow;
+                printf(" %9.1f | %+6.1f%% |%s", b, change, slow ? " REGRESSION" : "");
+            } else {
+                printf(" %9s | %7s |", "-", "-");
+            }
+        }
+        printf("\n");
+        if (save)
+            fprintf(save, "%s %.3f\n", stages[s].name, r.median);
+    }
+
+    if (save)
+        fclose(save);
+    if (base) {
+        fclose(base);
+        if (regressions) {
+            fprintf(stderr, "filter_bench: %d stage(s) slower than the baseline by more than %.1f %%\n",
+                    regressions, threshold);
+            return 1;
+        }
+    }
+    return 0;
+}
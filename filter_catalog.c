@@ -0,0 +1,175 @@
+/*
+ * Prototype Catalog Query
+ * Builds the prototype catalog (see afc_catalog.h), or answers attenuation
+ * masks from it: the lowest-order, smallest designs of any family that
+ * meet the mask, scaled to its frequencies and impedance.
+ *
+ * Usage: filter_catalog -build file [-j threads]
+ *        filter_catalog [-n count] [-family name] [-o csv|json|md|spice] file "mask" ...
+ *   mask     type,pass,stop,pass_dB,stop_dB[,topology[,impedance[,delay %]]]
+ *            with "f1:f2" bands for BP and BR, e.g.
+ *            "lp,1M,2M,0.5,60" or "bp,950M:1.05G,900M:1.1G,1,40,tee,50"
+ *   -n       candidates per mask (default 5)
+ *   -family  only this family
+ *   -o       write the designs of the candidates instead of the list
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_catalog.h"
+#include "afc_parallel.h"
+#include "afc_table.h"
+#include "afc_writer.h"
+
+#define MAX_CANDIDATES 100
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_catalog -build file [-j threads]\n"
+                    "       filter_catalog [-n count] [-family name] [-o csv|json|md|spice] file \"mask\" ...\n");
+}
+
+static double seconds(const struct timespec *t0, const struct timespec *t1) {
+    return (t1->tv_sec - t0->tv_sec) + (t1->tv_nsec - t0->tv_nsec) * 1e-9;
+}
+
+static int build(const char *path, int threads) {
+    struct timespec t0, t1;
+    afc_catalog cat;
+    threads = afc_thread_count(threads);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int rc = afc_catalog_build(path, threads);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (rc == AFC_OK)
+        rc = afc_catalog_open(path, &cat);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_catalog: %s: %s\n", path, afc_strerror(rc));
+        return 1;
+    }
+    fprintf(stderr, "Built %ld prototypes in %.3f s (%d threads), %zu bytes\n",
+            cat.rows, seconds(&t0, &t1), threads, cat.file.size);
+    afc_catalog_close(&cat);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    int threads = 0, count = 5, fail = 0;
+    afc_family family = 0;
+    afc_out_format fmt = 0;
+    const char *buildPath = NULL, *path = NULL;
+    const char *masks[256];
+    int nmasks = 0;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-build") && a + 1 < argc)
+            buildPath = argv[++a];
+        else if (!strcmp(argv[a], "-j") && a + 1 < argc)
+            threads = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-n") && a + 1 < argc)
+            count = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-family") && a + 1 < argc) {
+            if (!(family = afc_family_from_name(argv[++a]))) {
+                usage();
+                return 1;
+            }
+        } else if (!strcmp(argv[a], "-o") && a + 1 < argc) {
+            if (!(fmt = afc_out_format_from_name(argv[++a]))) {
+                usage();
+                return 1;
+            }
+        } else if (argv[a][0] == '-' || (path && nmasks == 256)) {
+            usage();
+            return 1;
+        } else if (!path)
+            path = argv[a];
+        else
+            masks[nmasks++] = argv[a];
+    }
+    if (buildPath)
+        return path ? (usage(), 1) : build(buildPath, threads);
+    if (!path || nmasks == 0 || count < 1 || count > MAX_CANDIDATES) {
+        usage();
+        return 1;
+    }
+
+    afc_catalog cat;
+    int rc = afc_catalog_open(path, &cat);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_catalog: %s: %s\n", path, afc_strerror(rc));
+        return 1;
+    }
+
+    afc_writer w;
+    afc_writer_init(&w, stdout);
+    if (fmt)
+        afc_write_preamble(&w, fmt);
+    long index = 0;
+    for (int m = 0; m < nmasks; m++) {
+        afc_mask mask;
+        afc_candidate c[MAX_CANDIDATES];
+        struct timespec t0, t1;
+        char *record = strdup(masks[m]);
+        const char *err = afc_mask_from_csv(record, &mask);
+        free(record);
+        if (err) {
+            fprintf(stderr, "filter_catalog: \"%s\": %s\n", masks[m], err);
+            fail = 1;
+            continue;
+        }
+        mask.family = family;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        int found = afc_catalog_query(&cat, &mask, c, count);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        if (found < 0) {
+            fprintf(stderr, "filter_catalog: \"%s\": %s\n", masks[m], afc_strerror(found));
+            fail = 1;
+            continue;
+        }
+        fprintf(stderr, "%s: %d candidates in %.1f us\n", masks[m], found, seconds(&t0, &t1) * 1e6);
+        if (found == 0) {
+            fprintf(stderr, "filter_catalog: \"%s\": no design in the catalog meets the mask\n", masks[m]);
+            fail = 1;
+            continue;
+        }
+
+        if (fmt) {
+            for (int i = 0; i < found; i++) {
+                afc_element el[AFC_MAX_ORDER];
+                int n = afc_catalog_design(&cat, &c[i], el, AFC_MAX_ORDER);
+                afc_write_design(&w, fmt, ++index, &c[i].spec, el, n);
+            }
+            continue;
+        }
+        char line[256];
+        snprintf(line, sizeof line, "\n### %s\n\n", masks[m]);
+        afc_write_str(&w, line);
+        afc_write_str(&w, "| Family      | Order | Ripple (dB) | Stop (dB) | Parts | Freq (Hz)    | BW (Hz)      | Margin (dB) | Delay spread |\n");
+        afc_write_str(&w, "|-------------|-------|-------------|-----------|-------|--------------|--------------|-------------|--------------|\n");
+        for (int i = 0; i < found; i++) {
+            const afc_spec *s = &c[i].spec;
+            char ripple[16] = "-", stop[16] = "-", bw[16] = "-";
+            if (s->family == AFC_CHEBYSHEV || s->family == AFC_ELLIPTIC)
+                snprintf(ripple, sizeof ripple, "%.3f", s->ripple_dB);
+            if (s->family == AFC_ELLIPTIC)
+                snprintf(stop, sizeof stop, "%.0f", s->stop_dB);
+            if (s->type == AFC_BANDPASS || s->type == AFC_BANDREJECT)
+                snprintf(bw, sizeof bw, "%.6g", s->bw);
+            snprintf(line, sizeof line, "| %-11s | %5d | %11s | %9s | %5d | %12.6g | %12s | %11.2f | %11.2f%% |\n",
+                     afc_family_name(s->family), s->order, ripple, stop, c[i].parts,
+                     s->freq, bw, c[i].margin_dB, c[i].delay_var * 100);
+            afc_write_str(&w, line);
+        }
+    }
+    if (afc_writer_free(&w) != AFC_OK) {
+        fprintf(stderr, "filter_catalog: %s\n", afc_strerror(AFC_ERR_IO));
+        fail = 1;
+    }
+    afc_catalog_close(&cat);
+    return fail;
+}
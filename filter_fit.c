@@ -0,0 +1,157 @@
+/*
+ * Fitting a Design to a Measurement
+ * Designs one filter from a CSV spec record (see afc_spec.h), fits its
+ * ladder values to a measured sweep (see afc_fit.h) and lists every part
+ * with its nominal and fitted value, flagging those that moved by more
+ * than the tolerance: the likely culprits on a board that misbehaves.
+ * The fit is run from many starting points split across all cores; the
+ * residuals and the time taken are reported on stderr.
+ *
+ * Usage: filter_fit [-j threads] [-starts n] [-spread pct] [-iter n] [-s11 weight]
+ *                   [-seed n] [-tol pct] [-o csv|json|md|spice] "spec" measured
+ *   measured  a Touchstone two-port (.s2p), modelled between its own port
+ *          impedances, or a CSV of frequency (Hz), insertion loss and
+ *          optionally return loss (dB), e.g. as filter_response writes it
+ *   -starts  starting points (default 32; the first is the nominal design)
+ *   -spread  spread of the random starts in % (default 20)
+ *   -iter    Levenberg-Marquardt steps per start at most (default 100)
+ *   -s11     weight of the return loss against the insertion loss
+ *            (default 1, 0 to fit the insertion loss only)
+ *   -tol     flag parts that moved by more than this % (default 5)
+ *   -o       write the fitted design instead of the list
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_fit.h"
+#include "afc_input.h"
+#include "afc_parallel.h"
+#include "afc_spec.h"
+#include "afc_table.h"
+#include "afc_writer.h"
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_fit [-j threads] [-starts n] [-spread pct] [-iter n] [-s11 weight]\n"
+                    "                  [-seed n] [-tol pct] [-o csv|json|md|spice] \"spec\" measured\n");
+}
+
+static void part_row(afc_writer *w, const char *kind, int e, double nominal, double fitted, double tol) {
+    char line[160];
+    double change = (fitted / nominal - 1) * 100;
+    snprintf(line, sizeof line, "| %s%-3d | %12.5g | %12.5g | %+10.2f | %-4s |\n", kind, e + 1,
+             nominal, fitted, change, fabs(change) > tol ? "<--" : "");
+    afc_write_str(w, line);
+}
+
+int main(int argc, char **argv) {
+    afc_fit_config cfg = { 0 };
+    afc_out_format fmt = 0;
+    double tol = 5, weight = 1;
+    const char *args[2] = {0};
+    int nargs = 0;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-j") && a + 1 < argc)
+            cfg.threads = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-starts") && a + 1 < argc)
+            cfg.starts = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-spread") && a + 1 < argc)
+            cfg.spread = atof(argv[++a]) / 100;
+        else if (!strcmp(argv[a], "-iter") && a + 1 < argc)
+            cfg.iterations = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-s11") && a + 1 < argc)
+            weight = atof(argv[++a]);
+        else if (!strcmp(argv[a], "-seed") && a + 1 < argc)
+            cfg.seed = (unsigned)strtoul(argv[++a], NULL, 10);
+        else if (!strcmp(argv[a], "-tol") && a + 1 < argc)
+            tol = atof(argv[++a]);
+        else if (!strcmp(argv[a], "-o") && a + 1 < argc) {
+            if (!(fmt = afc_out_format_from_name(argv[++a]))) {
+                usage();
+                return 1;
+            }
+        } else if (nargs < 2 && argv[a][0] != '-')
+            args[nargs++] = argv[a];
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (nargs < 2 || weight < 0 || !(tol >= 0)) {
+        usage();
+        return 1;
+    }
+    cfg.rl_weight = weight > 0 ? weight : -1;
+    cfg.threads = afc_thread_count(cfg.threads);
+
+    afc_spec spec;
+    afc_element el[AFC_MAX_ORDER];
+    char *record = strdup(args[0]);
+    const char *err = afc_spec_from_csv(record, &spec);
+    int n = 0;
+    if (!err && (n = afc_design(&spec, el, AFC_MAX_ORDER)) < 0)
+        err = afc_strerror(n);
+    free(record);
+    if (err) {
+        fprintf(stderr, "filter_fit: %s\n", err);
+        return 1;
+    }
+
+    afc_fit_target target;
+    int rc = afc_fit_target_load(args[1], &target);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_fit: %s: %s\n", args[1], afc_strerror(rc));
+        return 1;
+    }
+
+    afc_fit_result fit;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    // a Touchstone file says what the filter was measured between
+    double Rs = target.R[0] > 0 ? target.R[0] : spec.R;
+    double RL = target.R[1] > 0 ? target.R[1] : afc_load_impedance(&spec);
+    rc = afc_fit(el, n, Rs, RL, &target, &cfg, &fit);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_fit: %s\n", afc_strerror(rc));
+        afc_fit_target_free(&target);
+        return 1;
+    }
+
+    afc_writer w;
+    afc_writer_init(&w, stdout);
+    if (fmt) {
+        afc_write_preamble(&w, fmt);
+        afc_write_design(&w, fmt, 1, &spec, fit.el, fit.n);
+    } else {
+        afc_write_str(&w, "| Part | Nominal      | Fitted       | Change (%) |      |\n");
+        afc_write_str(&w, "|------|--------------|--------------|------------|------|\n");
+        for (int e = 0; e < n; e++) {
+            if (el[e].form != AFC_FORM_L)
+                part_row(&w, "C", e, el[e].C, fit.el[e].C, tol);
+            if (el[e].form != AFC_FORM_C)
+                part_row(&w, "L", e, el[e].L, fit.el[e].L, tol);
+        }
+    }
+    if (afc_writer_free(&w) != AFC_OK) {
+        fprintf(stderr, "filter_fit: %s\n", afc_strerror(AFC_ERR_IO));
+        rc = AFC_ERR_IO;
+    }
+
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    fprintf(stderr, "Fitted %d elements to %ld points in %.3f s (%d starts, %d threads)\n",
+            n, target.count, secs, cfg.starts > 0 ? cfg.starts : AFC_FIT_STARTS, cfg.threads);
+    fprintf(stderr, "rms error %.4f dB (nominal %.4f dB), best from start %d after %d steps, "
+                    "%d starts agree\n",
+            fit.rms_dB, fit.nominal_rms_dB, fit.start, fit.iterations, fit.agree);
+    afc_fit_target_free(&target);
+    return rc != AFC_OK;
+}
@@ -0,0 +1,283 @@
+/*
+ * Monte Carlo Tolerance Analysis
+ * Designs one filter from a CSV spec record (see afc_spec.h), perturbs its
+ * L and C values by the given tolerances and reports the yield against a
+ * loss mask together with percentile curves of the insertion loss.
+ *
+ * Usage: filter_mc [options] "spec" fstart fstop [output]
+ *   -t trials        number of samples (default 10000)
+ *   -s seed          random seed (default 1); same seed, same result
+ *   -tol pct         tolerance of every part in percent (default 5)
+ *   -tolC / -tolL    separate capacitor / inductor tolerance in percent
+ *   -dist d          uniform (default) or normal (tolerance = 3 sigma)
+ *   -pass f1:f2:dB   loss must stay at or below dB from f1 to f2
+ *   -stop f1:f2:dB   loss must reach at least dB from f1 to f2
+ *   -n points, -log  sweep points (default 201) and log spacing
+ *   -j threads       worker threads (default all cores)
+ *   -s2p prefix      also write the S-parameters of the first -variants
+ *                    trials (default 10) as Touchstone files
+ *                    prefix_<trial>.s2p, one per worker at a time, over
+ *                    -s2pn points (default -n) of the same sweep
+ *   -ts 1|2, -tsfmt ri|ma|db  their version and number format
+ *   -Q q[@Hz], -Qc q[@Hz], -srf Hz, -srfc Hz, -esr ohm, -esl H, -esrl ohm,
+ *   -part L3=file.s2p, -spart C2=file.s2p
+ *                    parasitic part models (see afc_parasitic.h)
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_montecarlo.h"
+#include "afc_parallel.h"
+#include "afc_parasitic.h"
+#include "afc_response.h"
+#include "afc_spec.h"
+#include "afc_touchstone.h"
+
+#define MAX_MASKS 32
+
+static const double percentiles[] = {1, 5, 50, 95, 99};
+#define NPCT (int)(sizeof percentiles / sizeof percentiles[0])
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_mc [-t trials] [-s seed] [-tol pct] [-tolC pct] [-tolL pct]\n"
+                    "                 [-dist uniform|normal] [-pass f1:f2:dB] [-stop f1:f2:dB]\n"
+                    "                 [-n points] [-log] [-j threads] [-s2p prefix [-variants k] [-s2pn points]\n"
+                    "                 [-ts 1|2] [-tsfmt ri|ma|db]] [parasitics] \"spec\" fstart fstop [output]\n");
+}
+
+// Parse "f1:f2:dB" into a mask segment.
+static int parse_mask(char *arg, afc_mask_kind kind, afc_mask *m) {
+    char *f1 = strtok(arg, ":"), *f2 = strtok(NULL, ":"), *dB = strtok(NULL, ":");
+    m->kind = kind;
+    return f1 && f2 && dB &&
+           afc_parse_number(f1, 0, &m->f_lo) && afc_parse_number(f2, 0, &m->f_hi) &&
+           afc_parse_number(dB, 0, &m->limit_dB) && m->f_lo <= m->f_hi;
+}
+
+typedef struct {
+    const afc_element *el;
+    int n;
+    double Rs, RL, f0, f1;
+    long points;
+    int logSweep;
+    const afc_mc_config *cfg;
+    const afc_ts_options *ts;
+    const char *prefix;
+    atomic_int err;            // first failure, AFC_OK while none
+} variant_job;
+
+// Touchstone files of trials [begin, end), each streamed on one thread.
+static void write_variants(void *ctx, long begin, long end, int tid) {
+    variant_job *job = ctx;
+    (void)tid;
+    for (long k = begin; k < end; k++) {
+        afc_element el[AFC_MAX_ORDER];
+        char path[4096], comment[64];
+        afc_mc_sample(job->el, job->n, job->cfg, k, el);
+        snprintf(path, sizeof path, "%s_%05ld.s2p", job->prefix, k);
+        snprintf(comment, sizeof comment, "Monte Carlo trial %ld, seed %llu", k,
+                 (unsigned long long)job->cfg->seed);
+        FILE *out = fopen(path, "w");
+        int rc = out ? afc_ts_write_ladder(out, el, job->n, job->Rs, job->RL, job->f0, job->f1,
+                                           job->points, job->logSweep, job->ts, comment, 1)
+                     : AFC_ERR_IO;
+        if (out && fclose(out) != 0 && rc == AFC_OK)
+            rc = AFC_ERR_IO;
+        int ok = AFC_OK;
+        if (rc != AFC_OK)
+            atomic_compare_exchange_strong(&job->err, &ok, rc);
+    }
+}
+
+int main(int argc, char **argv) {
+    afc_mc_config cfg = { .tol_C = 0.05, .tol_L = 0.05, .dist = AFC_DIST_UNIFORM, .seed = 1, .trials = 10000 };
+    afc_mask mask[MAX_MASKS];
+    afc_parasitics para = { 0 };
+    afc_ts_options ts = { 0 };
+    const char *prefix = NULL;
+    long variants = 10, tsPoints = 0;
+    int nmask = 0, logSweep = 0, points = 201, rc;
+    const char *args[4] = {0};
+    int nargs = 0;
+
+    for (int a = 1; a < argc; a++) {
+        const char *o = argv[a];
+        int more = a + 1 < argc;
+        if (!strcmp(o, "-t") && more)
+            cfg.trials = atol(argv[++a]);
+        else if (!strcmp(o, "-s") && more)
+            cfg.seed = strtoull(argv[++a], NULL, 0);
+        else if (!strcmp(o, "-tol") && more)
+            cfg.tol_C = cfg.tol_L = atof(argv[++a]) / 100;
+        else if (!strcmp(o, "-tolC") && more)
+            cfg.tol_C = atof(argv[++a]) / 100;
+        else if (!strcmp(o, "-tolL") && more)
+            cfg.tol_L = atof(argv[++a]) / 100;
+        else if (!strcmp(o, "-dist") && more) {
+            a++;
+            if (!strcasecmp(argv[a], "uniform"))
+                cfg.dist = AFC_DIST_UNIFORM;
+            else if (!strcasecmp(argv[a], "normal"))
+                cfg.dist = AFC_DIST_NORMAL;
+            else {
+                usage();
+                return 1;
+            }
+        } else if ((!strcmp(o, "-pass") || !strcmp(o, "-stop")) && more) {
+            if (nmask == MAX_MASKS ||
+                !parse_mask(argv[++a], o[2] == 'a' ? AFC_MASK_PASS : AFC_MASK_STOP, &mask[nmask++])) {
+                fprintf(stderr, "filter_mc: bad mask %s\n", argv[a]);
+                return 1;
+            }
+        } else if (!strcmp(o, "-n") && more)
+            points = atoi(argv[++a]);
+        else if (!strcmp(o, "-log"))
+            logSweep = 1;
+        else if (!strcmp(o, "-j") && more)
+            cfg.threads = atoi(argv[++a]);
+        else if (!strcmp(o, "-s2p") && more)
+            prefix = argv[++a];
+        else if (!strcmp(o, "-variants") && more)
+            variants = atol(argv[++a]);
+        else if (!strcmp(o, "-s2pn") && more)
+            tsPoints = atol(argv[++a]);
+        else if (!strcmp(o, "-ts") && more)
+            ts.version = atoi(argv[++a]);
+        else if (!strcmp(o, "-tsfmt") && more) {
+            if (!(ts.format = afc_ts_format_from_name(argv[++a]))) {
+                usage();
+                return 1;
+            }
+        }
+        else if (more && (rc = afc_parasitic_option(o, argv[a + 1], &para)) != 0) {
+            if (rc < 0) {
+                fprintf(stderr, "filter_mc: %s %s: %s\n", o, argv[a + 1], afc_strerror(rc));
+                return 1;
+            }
+            a++;
+        } else if (nargs < 4 && (o[0] != '-' || o[1] == '\0'))
+            args[nargs++] = o;
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (nargs < 3 || points < 2 || points > AFC_MC_MAX_POINTS || variants < 1 || tsPoints < 0 ||
+        (ts.version && ts.version != 1 && ts.version != 2)) {
+        usage();
+        return 1;
+    }
+    if (prefix && afc_parasitics_active(&para)) {
+        fprintf(stderr, "filter_mc: -s2p needs ideal parts\n");
+        return 1;
+    }
+    cfg.threads = afc_thread_count(cfg.threads);
+
+    afc_spec spec;
+    afc_element el[AFC_MAX_ORDER];
+    char *record = strdup(args[0]);
+    const char *err = afc_spec_from_csv(record, &spec);
+    int n = 0;
+    if (!err && (n = afc_design(&spec, el, AFC_MAX_ORDER)) < 0)
+        err = afc_strerror(n);
+    free(record);
+    if (err) {
+        fprintf(stderr, "filter_mc: %s\n", err);
+        return 1;
+    }
+
+    double f0 = 0, f1 = 0;
+    if (!afc_parse_number(args[1], 0, &f0) || !afc_parse_number(args[2], 0, &f1) ||
+        !(f0 > 0) || !(f1 > f0)) {
+        fprintf(stderr, "filter_mc: need 0 < fstart < fstop\n");
+        return 1;
+    }
+
+    double freq[AFC_MC_MAX_POINTS], nominal[AFC_MC_MAX_POINTS];
+    double *curve = malloc((size_t)points * NPCT * sizeof *curve);
+    if (!curve) {
+        fprintf(stderr, "filter_mc: out of memory\n");
+        return 1;
+    }
+    for (int i = 0; i < points; i++) {
+        double t = (double)i / (points - 1);
+        freq[i] = logSweep ? f0 * pow(f1 / f0, t) : f0 + (f1 - f0) * t;
+    }
+
+    double Rs = spec.R, RL = afc_load_impedance(&spec);
+    afc_mc_result res = { .curve = curve };
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    afc_response nom = { .il_dB = nominal };
+    if (afc_parasitics_active(&para)) {
+        afc_part_table parts;
+        cfg.parasitics = &para;
+        if ((rc = afc_part_table_init(&parts, el, n, &para, freq, points)) == AFC_OK)
+            rc = afc_part_table_response(&parts, Rs, RL, NULL, NULL, &nom, 1);
+        afc_part_table_free(&parts);
+    } else {
+        rc = afc_ladder_response(el, n, Rs, RL, freq, points, &nom);
+    }
+    if (rc == AFC_OK)
+        rc = afc_monte_carlo(el, n, Rs, RL, freq, points, mask, nmask, &cfg, percentiles, NPCT, &res);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_mc: %s\n", afc_strerror(rc));
+        return 1;
+    }
+
+    FILE *out = (nargs > 3 && strcmp(args[3], "-")) ? fopen(args[3], "w") : stdout;
+    if (!out) {
+        perror("filter_mc");
+        return 1;
+    }
+    fprintf(out, "# trials %ld, passed %ld, yield %.2f %%%s\n", res.trials, res.passed,
+            100.0 * res.passed / res.trials, nmask ? "" : " (no mask given)");
+    fprintf(out, "freq_Hz,nominal_dB");
+    for (int p = 0; p < NPCT; p++)
+        fprintf(out, ",p%g_dB", percentiles[p]);
+    fprintf(out, "\n");
+    for (int i = 0; i < points; i++) {
+        fprintf(out, "%.6g,%.4f", freq[i], nominal[i]);
+        for (int p = 0; p < NPCT; p++)
+            fprintf(out, ",%.3f", curve[i * NPCT + p]);
+        fprintf(out, "\n");
+    }
+    if (out != stdout)
+        fclose(out);
+
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    fprintf(stderr, "Ran %ld trials in %.3f s (%.0f trials/s, %d threads)\n",
+            res.trials, secs, secs > 0 ? res.trials / secs : 0.0, cfg.threads);
+
+    if (prefix) {
+        if (variants > cfg.trials)
+            variants = cfg.trials;
+        variant_job job = { el, n, Rs, RL, f0, f1, tsPoints ? tsPoints : points, logSweep,
+                            &cfg, &ts, prefix, AFC_OK };
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        afc_parallel_for(variants, 1, cfg.threads, write_variants, &job);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        int err = atomic_load(&job.err);
+        if (err != AFC_OK) {
+            fprintf(stderr, "filter_mc: %s_*.s2p: %s\n", prefix, afc_strerror(err));
+            return 1;
+        }
+        secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+        fprintf(stderr, "Wrote %ld Touchstone files of %ld points in %.3f s\n", variants, job.points, secs);
+    }
+
+    free(curve);
+    afc_parasitics_free(&para);
+    return 0;
+}
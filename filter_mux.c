@@ -0,0 +1,291 @@
+/*
+ * Filter Bank / Multiplexer Designer
+ * Designs every channel of a multiplexer in one run: band-pass ladders of
+ * one family, order and topology at the centre frequencies and bandwidths
+ * of a channel plan, joined at a common port, with the first resonator of
+ * each channel corrected for the loading of the others (see afc_mux.h).
+ * Writes the channel designs, or with -r the response of the whole bank,
+ * and a summary of the bank at the channel centres on stderr.
+ *
+ * Usage: filter_mux [-j threads] [-raw] [-o csv|json|md|spice] [-r fstart fstop]
+ *                   [-n points] [-grid first:spacing:count:bw] [-plan file]
+ *                   [--stats[=json]] "spec" [freq:bw ...]
+ *   spec   CSV spec record (see afc_spec.h) of the channels; its type,
+ *          frequency and bandwidth are taken from the plan, e.g.
+ *          "chebyshev,bp,5,0.1,,,tee,50"
+ *   freq:bw  one channel, e.g. 1.2G:40M
+ *   -grid  count equally spaced channels from first, each bw wide
+ *   -plan  channels from a file, one "freq,bw" (or "freq bw") per line
+ *   -raw   leave out the junction correction
+ * Exits with 1, the designs still written, if the correction does not
+ * converge to a matched bank.
+ *   -r     response from fstart to fstop over -n points (default 2001):
+ *          common port return loss and the insertion loss of each channel
+ *   --stats[=json]  per-stage counts and latencies on stderr (afc_stats.h)
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_input.h"
+#include "afc_mux.h"
+#include "afc_parallel.h"
+#include "afc_spec.h"
+#include "afc_stats.h"
+#include "afc_table.h"
+#include "afc_writer.h"
+
+static afc_mux_channel plan[AFC_MUX_MAX_CHANNELS];
+static int channels;
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_mux [-j threads] [-raw] [-o csv|json|md|spice] [-r fstart fstop]\n"
+                    "                  [-n points] [-grid first:spacing:count:bw] [-plan file]\n"
+                    "                  [--stats[=json]] \"spec\" [freq:bw ...]\n");
+}
+
+// "a:b:..." or "a,b" or "a b" into v[0..count-1]; 0 if malformed.
+static int parse_list(const char *s, double *v, int count) {
+    for (int i = 0; i < count; i++) {
+        const char *end;
+        if (afc_scan_double(s, NULL, &v[i], &end))
+            return 0;
+        while (*end == ' ' || *end == '\t')
+            end++;
+        if (i + 1 == count)
+            return *end == '\0';
+        if (*end == ':' || *end == ',')
+            end++;
+        s = end;
+    }
+    return 0;
+}
+
+static int add_channel(double freq, double bw) {
+    if (channels == AFC_MUX_MAX_CHANNELS) {
+        fprintf(stderr, "filter_mux: more than %d channels\n", AFC_MUX_MAX_CHANNELS);
+        return 0;
+    }
+    plan[channels].freq = freq;
+    plan[channels].bw = bw;
+    channels++;
+    return 1;
+}
+
+static int add_grid(const char *s) {
+    double v[4];
+    if (!parse_list(s, v, 4) || !(v[2] >= 1) || v[2] != floor(v[2])) {
+        fprintf(stderr, "filter_mux: bad grid \"%s\"\n", s);
+        return 0;
+    }
+    for (int k = 0; k < (int)v[2]; k++)
+        if (!add_channel(v[0] + k * v[1], v[3]))
+            return 0;
+    return 1;
+}
+
+static int add_plan(const char *path) {
+    FILE *in = fopen(path, "r");
+    char line[256];
+    int ok = 1;
+    if (!in) {
+        perror(path);
+        return 0;
+    }
+    for (int no = 1; ok && fgets(line, sizeof line, in); no++) {
+        char *l = afc_trim(line);
+        double v[2];
+        if (*l == '\0' || *l == '#' || !strncasecmp(l, "freq", 4))
+            continue;
+        if (!parse_list(l, v, 2)) {
+            fprintf(stderr, "filter_mux: %s:%d: expected freq,bw\n", path, no);
+            ok = 0;
+        } else {
+            ok = add_channel(v[0], v[1]);
+        }
+    }
+    fclose(in);
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    int threads = 0, raw = 0, stats = 0, rc;
+    afc_out_format fmt = AFC_OUT_CSV;
+    long points = 2001;
+    double fr[2] = { 0, 0 };
+    const char *specArg = NULL;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-j") && a + 1 < argc)
+            threads = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-raw"))
+            raw = 1;
+        else if (!strcmp(argv[a], "-o") && a + 1 < argc) {
+            if (!(fmt = afc_out_format_from_name(argv[++a]))) {
+                usage();
+                return 1;
+            }
+        } else if (!strcmp(argv[a], "-r") && a + 2 < argc) {
+            if (!afc_parse_number(argv[a + 1], 0, &fr[0]) || !afc_parse_number(argv[a + 2], 0, &fr[1]) ||
+                !(fr[0] > 0) || !(fr[1] > fr[0])) {
+                fprintf(stderr, "filter_mux: need 0 < fstart < fstop\n");
+                return 1;
+            }
+            a += 2;
+        } else if (!strcmp(argv[a], "-n") && a + 1 < argc)
+            points = atol(argv[++a]);
+        else if (!strcmp(argv[a], "-grid") && a + 1 < argc) {
+            if (!add_grid(argv[++a]))
+                return 1;
+        } else if (!strcmp(argv[a], "-plan") && a + 1 < argc) {
+            if (!add_plan(argv[++a]))
+                return 1;
+        } else if (!strncmp(argv[a], "--stats", 7)) {
+            if ((stats = afc_stats_option(argv[a])) < 0) {
+                usage();
+                return 1;
+            }
+            afc_stats_enable();
+        } else if (argv[a][0] == '-') {
+            usage();
+            return 1;
+        } else if (!specArg) {
+            specArg = argv[a];
+        } else {
+            double v[2];
+            if (!parse_list(argv[a], v, 2)) {
+                fprintf(stderr, "filter_mux: bad channel \"%s\", expected freq:bw\n", argv[a]);
+                return 1;
+            }
+            if (!add_channel(v[0], v[1]))
+                return 1;
+        }
+    }
+    if (!specArg || channels == 0 || points < 2) {
+        usage();
+        return 1;
+    }
+    threads = afc_thread_count(threads);
+
+    afc_mux_config cfg = { .channels = channels, .plan = plan, .raw = raw, .threads = threads };
+    char *record = strdup(specArg);
+    const char *err = afc_spec_from_csv(record, &cfg.base);
+    free(record);
+    if (err) {
+        fprintf(stderr, "filter_mux: %s\n", err);
+        return 1;
+    }
+
+    afc_mux mux;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    rc = afc_mux_init(&mux, &cfg);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_mux: %s\n", afc_strerror(rc));
+        afc_mux_free(&mux);
+        return 1;
+    }
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+    // the bank at the channel centres
+    double centre[AFC_MUX_MAX_CHANNELS], rl[AFC_MUX_MAX_CHANNELS];
+    double *il = malloc((size_t)channels * channels * sizeof *il);
+    if (!il) {
+        fprintf(stderr, "filter_mux: out of memory\n");
+        return 1;
+    }
+    for (int c = 0; c < channels; c++)
+        centre[c] = plan[c].freq;
+    afc_mux_response(&mux, centre, channels, rl, il);
+
+    int fail = 0;
+    long tf = afc_stats_begin();
+    afc_writer w;
+    afc_writer_init(&w, stdout);
+    if (fr[0] > 0) {
+        double *freq = malloc(points * sizeof *freq);
+        double *prl = malloc(points * sizeof *prl);
+        double *pil = malloc((size_t)points * channels * sizeof *pil);
+        if (!freq || !prl || !pil) {
+            fprintf(stderr, "filter_mux: out of memory\n");
+            return 1;
+        }
+        for (long i = 0; i < points; i++)
+            freq[i] = fr[0] + (fr[1] - fr[0]) * i / (points - 1);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        afc_mux_response(&mux, freq, points, prl, pil);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double rs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+        fprintf(stderr, "Evaluated %ld points x %d channels in %.3f s\n", points, channels, rs);
+
+        char buf[64];
+        afc_write_str(&w, "freq_Hz,common_rl_dB");
+        for (int c = 0; c < channels; c++) {
+            snprintf(buf, sizeof buf, ",ch%d_il_dB", c + 1);
+            afc_write_str(&w, buf);
+        }
+        afc_write_char(&w, '\n');
+        for (long i = 0; i < points; i++) {
+            snprintf(buf, sizeof buf, "%.6g,%.4f", freq[i], prl[i]);
+            afc_write_str(&w, buf);
+            for (int c = 0; c < channels; c++) {
+                snprintf(buf, sizeof buf, ",%.4f", pil[(size_t)c * points + i]);
+                afc_write_str(&w, buf);
+            }
+            afc_write_char(&w, '\n');
+        }
+        free(freq);
+        free(prl);
+        free(pil);
+    } else {
+        afc_write_preamble(&w, fmt);
+        for (int c = 0; c < channels; c++)
+            afc_write_design(&w, fmt, c + 1, &mux.spec[c], mux.el[c], mux.n[c]);
+    }
+    if (afc_writer_free(&w) != AFC_OK) {
+        fprintf(stderr, "filter_mux: %s\n", afc_strerror(AFC_ERR_IO));
+        fail = 1;
+    }
+    afc_stats_end(AFC_STAGE_FORMAT, tf);
+
+    fprintf(stderr, "Designed %d channels in %.3f s (%d threads), ", channels, secs, threads);
+    if (raw)
+        fprintf(stderr, "no junction correction\n");
+    else
+        fprintf(stderr, "junction correction: %d passes, last change %.2g\n", mux.iterations, mux.residual);
+    if (!raw && !mux.converged) {
+        if (mux.clamped)
+            fprintf(stderr, "filter_mux: junction correction did not converge: %d channels at the "
+                            "correction limit (shunt-first channels need wider spacing, or use tee)\n",
+                    mux.clamped);
+        else if (mux.residual >= AFC_MUX_TOLERANCE)
+            fprintf(stderr, "filter_mux: junction correction did not settle in %d passes\n",
+                    mux.iterations);
+        fprintf(stderr, "filter_mux: bank not matched: common RL %.2f dB at a channel centre\n",
+                mux.centre_rl_dB);
+        fail = 1;
+    }
+    fprintf(stderr, "| Channel |  Centre (Hz) |      BW (Hz) | IL at centre (dB) | Common RL (dB) |\n");
+    fprintf(stderr, "|---------|--------------|--------------|-------------------|----------------|\n");
+    for (int c = 0; c < channels; c++)
+        fprintf(stderr, "| %7d | %12.6g | %12.6g | %17.3f | %14.2f |\n", c + 1, plan[c].freq, plan[c].bw,
+                il[(size_t)c * channels + c], rl[c]);
+
+    free(il);
+    afc_mux_free(&mux);
+    if (stats) {
+        afc_stats st;
+        afc_stats_collect(&st);
+        afc_stats_print(stderr, &st, stats == 2);
+    }
+    return fail;
+}
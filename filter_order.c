@@ -0,0 +1,188 @@
+/*
+ * Filter Order Solver
+ * Reads loss masks, one per line, and writes the smallest order of each
+ * that meets it together with the loss that order reaches at the offset.
+ * With -n the order is given instead and only the loss is reported.
+ *
+ * Mask record (CSV):
+ *   family,type,ripple,freq,bw,atten,offset[,norm[,delay_freq,delay_tol]]
+ * e.g. "chebyshev,lp,0.1,1e6,,40,2e6" or, for a Bessel low-pass whose
+ * delay may sag at most 1 % up to 500 kHz, "bessel,lp,,1e6,,20,3e6,3db,5e5,0.01".
+ *
+ * Usage: filter_order [-j threads] [-n order] [input [output]]
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_order.h"
+#include "afc_parallel.h"
+#include "afc_spec.h"
+
+#define MASK_FIELDS 10
+
+typedef struct {
+    afc_order_spec *spec;
+    const char **error;    // parse error per record, NULL if none
+    long count, cap;
+} mask_list;
+
+static const char *parse_mask(char *line, afc_order_spec *s) {
+    char *field[MASK_FIELDS] = {0};
+    int nf = 0, norm;
+    char *p = line;
+    while (nf < MASK_FIELDS) {
+        field[nf++] = p;
+        char *comma = strchr(p, ',');
+        if (!comma)
+            break;
+        *comma = '\0';
+        p = comma + 1;
+    }
+    for (int i = 0; i < MASK_FIELDS; i++)
+        field[i] = field[i] ? afc_trim(field[i]) : "";
+    if (nf < 7)
+        return "too few fields";
+
+    memset(s, 0, sizeof *s);
+    if (!(s->family = afc_family_from_name(field[0])))
+        return "unknown family";
+    if (!(s->type = afc_type_from_name(field[1])))
+        return "unknown filter type";
+    if (!afc_parse_number(field[2], 0, &s->ripple_dB))
+        return "invalid ripple";
+    if (!afc_parse_number(field[3], 0, &s->freq))
+        return "invalid frequency";
+    if (!afc_parse_number(field[4], 0, &s->bw))
+        return "invalid bandwidth";
+    if (!afc_parse_number(field[5], 0, &s->atten_dB))
+        return "invalid attenuation";
+    if (!afc_parse_number(field[6], 0, &s->offset))
+        return "invalid offset frequency";
+    if ((norm = afc_norm_from_name(field[7][0] ? field[7] : "3db")) < 0)
+        return "unknown normalization";
+    s->norm = norm;
+    if (!afc_parse_number(field[8], 0, &s->delay_freq) || !afc_parse_number(field[9], 0, &s->delay_tol))
+        return "invalid delay limit";
+    return NULL;
+}
+
+static int add_mask(mask_list *m, char *line) {
+    if (m->count == m->cap) {
+        long cap = m->cap ? 2 * m->cap : 4096;
+        afc_order_spec *spec = realloc(m->spec, cap * sizeof *spec);
+        const char **error = spec ? realloc(m->error, cap * sizeof *error) : NULL;
+        if (spec)
+            m->spec = spec;
+        if (!error)
+            return 0;
+        m->error = error;
+        m->cap = cap;
+    }
+    m->error[m->count] = parse_mask(line, &m->spec[m->count]);
+    m->count++;
+    return 1;
+}
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_order [-j threads] [-n order] [input [output]]\n");
+}
+
+int main(int argc, char **argv) {
+    int threads = 0, fixedOrder = 0;
+    const char *inPath = NULL, *outPath = NULL;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-j") && a + 1 < argc)
+            threads = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-n") && a + 1 < argc)
+            fixedOrder = atoi(argv[++a]);
+        else if (argv[a][0] == '-' && argv[a][1] != '\0') {
+            usage();
+            return 1;
+        } else if (!inPath)
+            inPath = argv[a];
+        else if (!outPath)
+            outPath = argv[a];
+        else {
+            usage();
+            return 1;
+        }
+    }
+    threads = afc_thread_count(threads);
+
+    FILE *in = (inPath && strcmp(inPath, "-")) ? fopen(inPath, "r") : stdin;
+    FILE *out = (outPath && strcmp(outPath, "-")) ? fopen(outPath, "w") : stdout;
+    if (!in || !out) {
+        perror("filter_order");
+        return 1;
+    }
+
+    mask_list masks = {0};
+    char *line = NULL;
+    size_t cap = 0;
+    while (getline(&line, &cap, in) > 0) {
+        char *l = afc_trim(line);
+        // skip blank lines, comments and a header row
+        if (*l == '\0' || *l == '#' || !strncasecmp(l, "family", 6))
+            continue;
+        if (!add_mask(&masks, l)) {
+            fprintf(stderr, "filter_order: out of memory\n");
+            return 1;
+        }
+    }
+    free(line);
+
+    long n = masks.count;
+    int *order = malloc((n ? n : 1) * sizeof *order);
+    double *atten = malloc((n ? n : 1) * sizeof *atten);
+    if (!order || !atten) {
+        fprintf(stderr, "filter_order: out of memory\n");
+        return 1;
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (fixedOrder)
+        for (long i = 0; i < n; i++)
+            order[i] = fixedOrder;
+    else
+        afc_min_order_batch(masks.spec, n, order, threads);
+    afc_rejection_batch(masks.spec, order, n, atten, threads);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    fprintf(out, "mask,order,rejection_dB\n");
+    for (long i = 0; i < n; i++) {
+        const char *err = masks.error[i];
+        if (!err && order[i] < 0)
+            err = afc_strerror(order[i]);
+        if (!err && isnan(atten[i]))
+            err = afc_strerror(afc_rejection(&masks.spec[i], order[i], &atten[i]));
+        if (err)
+            fprintf(out, "# mask %ld: error: %s\n", i + 1, err);
+        else
+            fprintf(out, "%ld,%d,%.4f\n", i + 1, order[i], atten[i]);
+    }
+
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    fprintf(stderr, "Solved %ld masks in %.3f s (%.0f masks/s, %d threads)\n",
+            n, secs, secs > 0 ? n / secs : 0.0, threads);
+
+    if (out != stdout)
+        fclose(out);
+    if (in != stdin)
+        fclose(in);
+    free(masks.spec);
+    free(masks.error);
+    free(order);
+    free(atten);
+    return 0;
+}
@@ -0,0 +1,255 @@
+/*
+ * Filter Response Sweep
+ * Designs one filter from a CSV spec record (see afc_spec.h) and writes the
+ * response of the resulting ladder over a frequency sweep: insertion loss,
+ * return loss and group delay. The sweep is split across all cores and the
+ * run rate (points/s) is reported on stderr.
+ *
+ * Usage: filter_response [-j threads] [-n points] [-log] [-sens] [-q] [--stats[=json]]
+ *                        [-ts 1|2] [-tsfmt ri|ma|db] [parasitics] "spec" fstart fstop [output]
+ *   -n    number of sweep points (default 1001)
+ *   -log  logarithmic instead of linear spacing
+ *   -sens add the change of insertion loss and group delay per 1 % change
+ *         of every L and C (columns C<k>_dB, C<k>_gd_ns, L<k>_dB, ...)
+ *   -q    compute only, do not write the table (timing runs)
+ *   -ts   write the S-parameters as a Touchstone 1.1 or 2.0 file instead
+ *         (see afc_touchstone.h), streamed in chunks: any -n fits in memory
+ *   -tsfmt  its number format (default ri)
+ *   --stats[=json]  per-stage counts and latencies on stderr (afc_stats.h)
+ *   -Q q[@Hz], -Qc q[@Hz], -srf Hz, -srfc Hz, -esr ohm, -esl H, -esrl ohm,
+ *   -part L3=file.s2p, -spart C2=file.s2p
+ *         real instead of ideal parts (see afc_parasitic.h)
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_parallel.h"
+#include "afc_parasitic.h"
+#include "afc_response.h"
+#include "afc_spec.h"
+#include "afc_stats.h"
+#include "afc_touchstone.h"
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_response [-j threads] [-n points] [-log] [-sens] [-q] [--stats[=json]]\n"
+                    "                       [-ts 1|2] [-tsfmt ri|ma|db] [parasitics] \"spec\" fstart fstop [output]\n");
+}
+
+// The sweep as a Touchstone file, computed and written a chunk at a time.
+static int write_touchstone(const afc_spec *spec, const afc_element *el, int n, double f0, double f1,
+                            long points, int logSweep, const afc_ts_options *ts, const char *path,
+                            int threads, int stats) {
+    char comment[256];
+    struct timespec t0, t1;
+    FILE *out = (path && strcmp(path, "-")) ? fopen(path, "w") : stdout;
+    if (!out) {
+        perror("filter_response");
+        return 1;
+    }
+    snprintf(comment, sizeof comment, "%s %s, order %d, %s, source %.4f ohm, load %.4f ohm",
+             afc_family_name(spec->family), afc_type_name(spec->type), spec->order,
+             afc_topology_name(spec->topology), spec->R, afc_load_impedance(spec));
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    long tf = afc_stats_begin();
+    int rc = afc_ts_write_ladder(out, el, n, spec->R, afc_load_impedance(spec), f0, f1, points, logSweep,
+                                 ts, comment, threads);
+    afc_stats_end(AFC_STAGE_FORMAT, tf);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (out != stdout && fclose(out) != 0 && rc == AFC_OK)
+        rc = AFC_ERR_IO;
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_response: %s\n", afc_strerror(rc));
+        return 1;
+    }
+
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    fprintf(stderr, "Wrote %ld points in %.3f s (%.0f points/s, %d threads, Touchstone %d.%d)\n",
+            points, secs, secs > 0 ? points / secs : 0.0, threads, ts->version, ts->version == 1 ? 1 : 0);
+    if (stats) {
+        afc_stats st;
+        afc_stats_collect(&st);
+        afc_stats_print(stderr, &st, stats == 2);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    int threads = 0, logSweep = 0, quiet = 0, withSens = 0, stats = 0, rc;
+    afc_parasitics para = { 0 };
+    afc_ts_options ts = { 0 };
+    long points = 1001;
+    const char *args[4] = {0};
+    int nargs = 0;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-j") && a + 1 < argc)
+            threads = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-n") && a + 1 < argc)
+            points = atol(argv[++a]);
+        else if (!strcmp(argv[a], "-log"))
+            logSweep = 1;
+        else if (!strcmp(argv[a], "-sens"))
+            withSens = 1;
+        else if (!strcmp(argv[a], "-q"))
+            quiet = 1;
+        else if (!strcmp(argv[a], "-ts") && a + 1 < argc)
+            ts.version = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-tsfmt") && a + 1 < argc) {
+            if (!(ts.format = afc_ts_format_from_name(argv[++a]))) {
+                usage();
+                return 1;
+            }
+        }
+        else if (!strncmp(argv[a], "--stats", 7)) {
+            if ((stats = afc_stats_option(argv[a])) < 0) {
+                usage();
+                return 1;
+            }
+            afc_stats_enable();
+        } else if (a + 1 < argc && (rc = afc_parasitic_option(argv[a], argv[a + 1], &para)) != 0) {
+            if (rc < 0) {
+                fprintf(stderr, "filter_response: %s %s: %s\n", argv[a], argv[a + 1], afc_strerror(rc));
+                return 1;
+            }
+            a++;
+        } else if (nargs < 4 && (argv[a][0] != '-' || argv[a][1] == '\0'))
+            args[nargs++] = argv[a];
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (nargs < 3 || points < 2) {
+        usage();
+        return 1;
+    }
+    int lossy = afc_parasitics_active(&para);
+    if (lossy && withSens) {
+        fprintf(stderr, "filter_response: -sens needs ideal parts\n");
+        return 1;
+    }
+    if (ts.version && (lossy || withSens || (ts.version != 1 && ts.version != 2))) {
+        fprintf(stderr, "filter_response: -ts is 1 or 2, and needs ideal parts and no -sens\n");
+        return 1;
+    }
+    threads = afc_thread_count(threads);
+
+    afc_spec spec;
+    afc_element el[AFC_MAX_ORDER];
+    char *record = strdup(args[0]);
+    const char *err = afc_spec_from_csv(record, &spec);
+    int n = 0;
+    if (!err && (n = afc_design(&spec, el, AFC_MAX_ORDER)) < 0)
+        err = afc_strerror(n);
+    free(record);
+    if (err) {
+        fprintf(stderr, "filter_response: %s\n", err);
+        return 1;
+    }
+
+    double f0 = 0, f1 = 0;
+    if (!afc_parse_number(args[1], 0, &f0) || !afc_parse_number(args[2], 0, &f1) ||
+        !(f0 > 0) || !(f1 > f0)) {
+        fprintf(stderr, "filter_response: need 0 < fstart < fstop\n");
+        return 1;
+    }
+
+    if (ts.version)
+        return write_touchstone(&spec, el, n, f0, f1, points, logSweep, &ts, nargs > 3 ? args[3] : NULL,
+                                threads, stats);
+
+    double *freq = malloc(points * sizeof *freq);
+    double *il = malloc(points * sizeof *il);
+    double *rl = malloc(points * sizeof *rl);
+    double *gd = malloc(points * sizeof *gd);
+    // sensitivities: il_C, il_L, gd_C, gd_L, points * n each
+    double *sens = withSens ? malloc(4 * (size_t)points * n * sizeof *sens) : NULL;
+    if (!freq || !il || !rl || !gd || (withSens && !sens)) {
+        fprintf(stderr, "filter_response: out of memory\n");
+        return 1;
+    }
+    for (long i = 0; i < points; i++) {
+        double t = (double)i / (points - 1);
+        freq[i] = logSweep ? f0 * pow(f1 / f0, t) : f0 + (f1 - f0) * t;
+    }
+
+    afc_response resp = { .il_dB = il, .rl_dB = rl, .gd = gd };
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    double load = afc_load_impedance(&spec);
+    size_t plane = (size_t)points * n;
+    afc_sensitivity sr = { sens, sens + plane, sens + 2 * plane, sens + 3 * plane };
+    if (lossy) {
+        // the part models are evaluated once, before the cascade
+        afc_part_table parts;
+        if ((rc = afc_part_table_init(&parts, el, n, &para, freq, points)) == AFC_OK)
+            rc = afc_part_table_response(&parts, spec.R, load, NULL, NULL, &resp, threads);
+        afc_part_table_free(&parts);
+    } else {
+        rc = afc_ladder_response_mt(el, n, spec.R, load, freq, points, &resp, threads);
+    }
+    if (rc == AFC_OK && withSens)
+        rc = afc_ladder_sensitivity(el, n, spec.R, load, freq, points, &sr, threads);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_response: %s\n", afc_strerror(rc));
+        return 1;
+    }
+
+    if (!quiet) {
+        long tf = afc_stats_begin();
+        FILE *out = (nargs > 3 && strcmp(args[3], "-")) ? fopen(args[3], "w") : stdout;
+        if (!out) {
+            perror("filter_response");
+            return 1;
+        }
+        fprintf(out, "freq_Hz,insertion_loss_dB,return_loss_dB,group_delay_ns");
+        for (int e = 0; withSens && e < n; e++) {
+            if (el[e].form != AFC_FORM_L)
+                fprintf(out, ",C%d_dB,C%d_gd_ns", e + 1, e + 1);
+            if (el[e].form != AFC_FORM_C)
+                fprintf(out, ",L%d_dB,L%d_gd_ns", e + 1, e + 1);
+        }
+        fputc('\n', out);
+        for (long i = 0; i < points; i++) {
+            fprintf(out, "%.6g,%.4f,%.4f,%.4f", freq[i], il[i], rl[i], gd[i] * 1e9);
+            for (int e = 0; withSens && e < n; e++) {
+                size_t at = (size_t)i * n + e;
+                // per 1 % change of the part
+                if (el[e].form != AFC_FORM_L)
+                    fprintf(out, ",%.5g,%.5g", sr.il_C[at] * 0.01, sr.gd_C[at] * 1e7);
+                if (el[e].form != AFC_FORM_C)
+                    fprintf(out, ",%.5g,%.5g", sr.il_L[at] * 0.01, sr.gd_L[at] * 1e7);
+            }
+            fputc('\n', out);
+        }
+        if (out != stdout)
+            fclose(out);
+        afc_stats_end(AFC_STAGE_FORMAT, tf);
+    }
+
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    fprintf(stderr, "Evaluated %ld points in %.3f s (%.0f points/s, %d threads, %s)\n",
+            points, secs, secs > 0 ? points / secs : 0.0, threads, lossy ? "parasitics" : afc_response_isa());
+
+    free(freq);
+    free(il);
+    free(rl);
+    free(gd);
+    free(sens);
+    afc_parasitics_free(&para);
+    if (stats) {
+        afc_stats st;
+        afc_stats_collect(&st);
+        afc_stats_print(stderr, &st, stats == 2);
+    }
+    return 0;
+}
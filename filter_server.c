@@ -0,0 +1,371 @@
+/*
+ * Filter Design Server
+ * Long-lived front-end for the batch record format: reads design specs
+ * (CSV or JSON Lines, see afc_spec.h), one per line, on stdin or from
+ * clients of a Unix domain socket and answers each with its component
+ * values. Results come from a shared LRU cache (afc_cache.h), so repeated
+ * queries cost a lookup instead of a design.
+ *
+ * Clients may pipeline: every request line already received is answered in
+ * order and the replies go out in one write. Replies are numbered by the
+ * request's position on the connection. In JSON (the default) each reply
+ * is one line; in csv and spice each reply ends with an "end <n>" comment.
+ *
+ * Besides specs a client may send
+ *   stats    counters: requests, cache hits/misses/evictions, latency, and
+ *            with --stats the count, p50 and p99 of every pipeline stage
+ *   quit     close the connection
+ *
+ * --stats also reports the stage histograms on stderr at exit, as a table
+ * or with --stats=json as one JSON line (see afc_stats.h).
+ *
+ * Usage: filter_server [-s socket] [-c entries] [-o json|csv|spice] [--stats[=json]]
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "afc.h"
+#include "afc_cache.h"
+#include "afc_spec.h"
+#include "afc_stats.h"
+#include "afc_table.h"
+#include "afc_writer.h"
+
+#define READ_SIZE     65536
+#define MAX_LINE      (1 << 20)   // longest request line accepted
+#define CACHE_DEFAULT 65536
+#define ACCEPT_BACKOFF_MS 100     // wait after accept() fails for lack of resources
+
+/* ---------------------------------------------------------------------- */
+/* Counters                                                               */
+/* ---------------------------------------------------------------------- */
+
+static struct {
+    atomic_long requests, errors, connections;
+    // latency of the requests that produced a design; failed ones are only
+    // counted in errors, as they may never have reached the cache
+    atomic_long hit_ns, miss_ns, max_ns;
+    atomic_long timed_hits, timed_misses;
+} counters;
+
+static afc_design_cache *cache;
+static afc_out_format outFmt = AFC_OUT_JSON;
+static int statsFmt;
+static volatile sig_atomic_t stopping;
+
+static long elapsed_ns(const struct timespec *t0, const struct timespec *t1) {
+    return (t1->tv_sec - t0->tv_sec) * 1000000000L + (t1->tv_nsec - t0->tv_nsec);
+}
+
+static void record_latency(int hit, long ns) {
+    atomic_fetch_add(hit ? &counters.hit_ns : &counters.miss_ns, ns);
+    atomic_fetch_add(hit ? &counters.timed_hits : &counters.timed_misses, 1);
+    long max = atomic_load(&counters.max_ns);
+    while (ns > max && !atomic_compare_exchange_weak(&counters.max_ns, &max, ns))
+        ;
+}
+
+static void write_field(afc_writer *w, int json, int first, const char *name, const char *suffix,
+                        long value) {
+    if (json) {
+        afc_write_str(w, first ? "\"" : ",\"");
+        afc_write_str(w, name);
+        afc_write_str(w, suffix);
+        afc_write_str(w, "\":");
+    } else {
+        afc_write_char(w, ' ');
+        afc_write_str(w, name);
+        afc_write_str(w, suffix);
+        afc_write_char(w, '=');
+    }
+    afc_write_int(w, value, 0);
+}
+
+static void write_stats(afc_writer *w) {
+    afc_cache_stats s;
+    afc_cache_get_stats(cache, &s);
+    long hitNs = atomic_load(&counters.hit_ns), missNs = atomic_load(&counters.miss_ns);
+    long hits = atomic_load(&counters.timed_hits), misses = atomic_load(&counters.timed_misses);
+    struct { const char *name; long value; } field[] = {
+        { "requests",    atomic_load(&counters.requests) },
+        { "errors",      atomic_load(&counters.errors) },
+        { "connections", atomic_load(&counters.connections) },
+        { "hits",        s.hits },
+        { "misses",      s.misses },
+        { "evictions",   s.evictions },
+        { "entries",     s.entries },
+        { "capacity",    s.capacity },
+        { "hit_ns_avg",  hits ? hitNs / hits : 0 },
+        { "miss_ns_avg", misses ? missNs / misses : 0 },
+        { "max_ns",      atomic_load(&counters.max_ns) },
+    };
+    int json = outFmt == AFC_OUT_JSON;
+
+    afc_write_str(w, json ? "{\"stats\":{" : outFmt == AFC_OUT_SPICE ? "* stats" : "# stats");
+    for (size_t i = 0; i < sizeof field / sizeof field[0]; i++)
+        write_field(w, json, i == 0, field[i].name, "", field[i].value);
+    if (statsFmt) {
+        afc_stats st;
+        afc_stats_collect(&st);
+        for (int i = 0; i < AFC_STAGE_COUNT; i++) {
+            const char *name = afc_stage_name(i);
+            write_field(w, json, 0, name, "_count", st.stage[i].count);
+            write_field(w, json, 0, name, "_p50_ns", afc_stats_quantile(&st.stage[i], 0.5));
+            write_field(w, json, 0, name, "_p99_ns", afc_stats_quantile(&st.stage[i], 0.99));
+        }
+    }
+    afc_write_str(w, json ? "}}\n" : "\n");
+}
+
+/* ---------------------------------------------------------------------- */
+/* Sessions                                                               */
+/* ---------------------------------------------------------------------- */
+
+// Answer one request line; returns 0 on "quit".
+static int handle_line(char *line, long *index, afc_writer *w) {
+    char *l = afc_trim(line);
+    if (*l == '\0' || *l == '#' || !strncasecmp(l, "family", 6))
+        return 1;
+    if (!strcasecmp(l, "quit"))
+        return 0;
+    if (!strcasecmp(l, "stats")) {
+        write_stats(w);
+        return 1;
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    afc_spec s;
+    afc_element el[AFC_MAX_ORDER];
+    long id = ++*index;
+    int n = 0, hit = 0;
+    const char *err = *l == '{' ? afc_spec_from_jsonl(l, &s) : afc_spec_from_csv(l, &s);
+    if (!err && (n = afc_cache_design(cache, &s, el, AFC_MAX_ORDER, &hit)) < 0)
+        err = afc_strerror(n);
+    if (err) {
+        afc_write_error(w, outFmt, id, err);
+        atomic_fetch_add(&counters.errors, 1);
+    } else {
+        afc_write_design(w, outFmt, id, &s, el, n);
+    }
+    if (outFmt != AFC_OUT_JSON) {
+        afc_write_str(w, outFmt == AFC_OUT_SPICE ? "* end " : "# end ");
+        afc_write_int(w, id, 0);
+        afc_write_char(w, '\n');
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    atomic_fetch_add(&counters.requests, 1);
+    if (!err)
+        record_latency(hit, elapsed_ns(&t0, &t1));
+    return 1;
+}
+
+static int write_all(int fd, const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return 0;
+        p += n;
+        len -= (size_t)n;
+    }
+    return 1;
+}
+
+// Serve one client until it closes, sends "quit" or a write fails.
+static void serve(int in, int out) {
+    size_t cap = READ_SIZE, len = 0;
+    char *buf = malloc(cap + 1);
+    afc_writer w;
+    long index = 0;
+    int open = buf != NULL;
+
+    afc_writer_init(&w, NULL);
+    if (outFmt == AFC_OUT_CSV)
+        afc_write_preamble(&w, outFmt);
+    while (open) {
+        if (cap - len < READ_SIZE / 2) {
+            char *p = len + READ_SIZE <= MAX_LINE ? realloc(buf, cap * 2 + 1) : NULL;
+            if (!p)
+                break;   // line too long or out of memory: drop the client
+            buf = p;
+            cap *= 2;
+        }
+        ssize_t got = read(in, buf + len, cap - len);
+        if (got < 0 && errno == EINTR && !stopping)
+            continue;
+        if (got <= 0) {
+            // answer a last line without a newline
+            if (len > 0) {
+                buf[len] = '\0';
+                handle_line(buf, &index, &w);
+            }
+            open = 0;
+        } else {
+            len += (size_t)got;
+            // every complete line so far, then one write for all replies
+            char *line = buf, *nl;
+            while (open && (nl = memchr(line, '\n', len - (size_t)(line - buf)))) {
+                *nl = '\0';
+                open = handle_line(line, &index, &w);
+                line = nl + 1;
+            }
+            len -= (size_t)(line - buf);
+            memmove(buf, line, len);
+        }
+        if (w.len > 0 && (w.error || !write_all(out, w.data, w.len)))
+            break;
+        afc_writer_reset(&w);
+    }
+    afc_writer_free(&w);
+    free(buf);
+}
+
+static void *client_thread(void *arg) {
+    int fd = (int)(long)arg;
+    serve(fd, fd);
+    close(fd);
+    return NULL;
+}
+
+static void on_signal(int sig) {
+    (void)sig;
+    stopping = 1;
+}
+
+static int listen_unix(const char *path) {
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(path) >= sizeof addr.sun_path) {
+        fprintf(stderr, "filter_server: socket path too long\n");
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("filter_server");
+        return -1;
+    }
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof addr) < 0 || listen(fd, 64) < 0) {
+        perror("filter_server");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_server [-s socket] [-c entries] [-o json|csv|spice] [--stats[=json]]\n");
+}
+
+int main(int argc, char **argv) {
+    const char *sockPath = NULL;
+    long entries = CACHE_DEFAULT;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-s") && a + 1 < argc) {
+            sockPath = argv[++a];
+        } else if (!strcmp(argv[a], "-c") && a + 1 < argc) {
+            entries = atol(argv[++a]);
+        } else if (!strcmp(argv[a], "-o") && a + 1 < argc) {
+            outFmt = afc_out_format_from_name(argv[++a]);
+            // markdown replies have no end marker a client could wait for
+            if (!outFmt || outFmt == AFC_OUT_MARKDOWN) {
+                usage();
+                return 1;
+            }
+        } else if (!strncmp(argv[a], "--stats", 7)) {
+            if ((statsFmt = afc_stats_option(argv[a])) < 0) {
+                usage();
+                return 1;
+            }
+            afc_stats_enable();
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (entries < 1) {
+        usage();
+        return 1;
+    }
+    if (!(cache = afc_cache_create(entries))) {
+        fprintf(stderr, "filter_server: out of memory\n");
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    if (!sockPath) {
+        atomic_fetch_add(&counters.connections, 1);
+        serve(STDIN_FILENO, STDOUT_FILENO);
+    } else {
+        int lfd = listen_unix(sockPath);
+        if (lfd < 0)
+            return 1;
+        // no SA_RESTART, so a signal interrupts accept()
+        struct sigaction sa = { .sa_handler = on_signal };
+        sigaction(SIGINT, &sa, NULL);
+        sigaction(SIGTERM, &sa, NULL);
+        fprintf(stderr, "filter_server: listening on %s\n", sockPath);
+
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        int failing = 0;
+        while (!stopping) {
+            int fd = accept(lfd, NULL, NULL);
+            if (fd < 0) {
+                if (errno == EINTR || errno == ECONNABORTED)
+                    continue;
+                // out of descriptors (EMFILE, ENFILE) or buffers lasts until
+                // clients leave: report it once and wait rather than spin
+                if (!failing)
+                    perror("filter_server: accept");
+                failing = 1;
+                nanosleep(&(struct timespec){ 0, ACCEPT_BACKOFF_MS * 1000000L }, NULL);
+                continue;
+            }
+            if (failing)
+                fprintf(stderr, "filter_server: accepting again\n");
+            failing = 0;
+            pthread_t t;
+            atomic_fetch_add(&counters.connections, 1);
+            if (pthread_create(&t, &attr, client_thread, (void *)(long)fd) != 0)
+                close(fd);
+        }
+        pthread_attr_destroy(&attr);
+        close(lfd);
+        unlink(sockPath);
+    }
+
+    afc_cache_stats s;
+    afc_cache_get_stats(cache, &s);
+    fprintf(stderr, "Served %ld requests (%ld cache hits, %ld misses) on %ld connections\n",
+            atomic_load(&counters.requests), s.hits, s.misses, atomic_load(&counters.connections));
+    if (statsFmt) {
+        afc_stats st;
+        afc_stats_collect(&st);
+        afc_stats_print(stderr, &st, statsFmt == 2);
+    }
+    // client threads may still be running in socket mode, so the cache is
+    // left to the exit
+    if (!sockPath)
+        afc_cache_destroy(cache);
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Standard Value Snapping
+ * Designs one filter from a CSV spec record (see afc_spec.h) and replaces
+ * its ideal L and C values by E12/E24/E48/E96 parts, optionally as series
+ * or parallel pairs, keeping the insertion loss as close as possible to
+ * the ideal design.
+ *
+ * Usage: filter_snap [-e 12|24|48|96] [-pairs] [-j threads] [-nodes N] "spec"
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_eseries.h"
+#include "afc_parallel.h"
+#include "afc_snap.h"
+#include "afc_spec.h"
+
+#define GRID_POINTS 64
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_snap [-e 12|24|48|96] [-pairs] [-j threads] [-nodes N] \"spec\"\n");
+}
+
+// Value with an SI prefix, e.g. 4.7 nF
+static const char *si(double v, const char *unit, char *buf, size_t size) {
+    static const char *prefix[] = {"f", "p", "n", "u", "m", "", "k"};
+    int p = 0;
+    double scale = 1e-15;
+    while (p < 6 && v >= scale * 1000 * 0.9995) {
+        scale *= 1000;
+        p++;
+    }
+    snprintf(buf, size, "%.4g %s%s", v / scale, prefix[p], unit);
+    return buf;
+}
+
+static const char *describe(const afc_part *p, const char *unit, char *buf, size_t size) {
+    char a[32], b[32];
+    if (p->combo == AFC_COMBO_SINGLE)
+        return si(p->a, unit, buf, size);
+    si(p->a, unit, a, sizeof a);
+    si(p->b, unit, b, sizeof b);
+    // for capacitors a sum is a parallel pair, for inductors a series pair
+    int parallel = (p->combo == AFC_COMBO_SUM) == (unit[0] == 'F');
+    snprintf(buf, size, "%s %s %s", a, parallel ? "||" : "+", b);
+    return buf;
+}
+
+// Frequencies the loss is matched over: the pass band and the skirts
+static void make_grid(const afc_spec *s, double *freq) {
+    double lo, hi;
+    if (s->type == AFC_LOWPASS) {
+        lo = s->freq / 10;
+        hi = s->freq * 3;
+    } else if (s->type == AFC_HIGHPASS) {
+        lo = s->freq / 3;
+        hi = s->freq * 10;
+    } else {
+        lo = fmax(s->freq - 2.5 * s->bw, s->freq / 10);
+        hi = s->freq + 2.5 * s->bw;
+    }
+    for (int i = 0; i < GRID_POINTS; i++)
+        freq[i] = lo * pow(hi / lo, (double)i / (GRID_POINTS - 1));
+}
+
+int main(int argc, char **argv) {
+    afc_snap_config cfg = { .series = AFC_E24 };
+    const char *specArg = NULL;
+
+    for (int a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-e") && a + 1 < argc)
+            cfg.series = (afc_eseries)atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-pairs"))
+            cfg.pairs = 1;
+        else if (!strcmp(argv[a], "-j") && a + 1 < argc)
+            cfg.threads = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-nodes") && a + 1 < argc)
+            cfg.max_nodes = atol(argv[++a]);
+        else if (!specArg && argv[a][0] != '-')
+            specArg = argv[a];
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (!specArg || afc_eseries_size(cfg.series) == 0) {
+        usage();
+        return 1;
+    }
+    cfg.threads = afc_thread_count(cfg.threads);
+
+    afc_spec spec;
+    afc_element el[AFC_MAX_ORDER], snapped[AFC_MAX_ORDER];
+    afc_snap_element parts[AFC_MAX_ORDER];
+    char *record = strdup(specArg);
+    const char *err = afc_spec_from_csv(record, &spec);
+    int n = 0;
+    if (!err && (n = afc_design(&spec, el, AFC_MAX_ORDER)) < 0)
+        err = afc_strerror(n);
+    free(record);
+    if (err) {
+        fprintf(stderr, "filter_snap: %s\n", err);
+        return 1;
+    }
+
+    double freq[GRID_POINTS];
+    afc_snap_result res;
+    struct timespec t0, t1;
+    make_grid(&spec, freq);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int rc = afc_snap(el, n, spec.R, afc_load_impedance(&spec), freq, GRID_POINTS, &cfg, snapped, parts, &res);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_snap: %s\n", afc_strerror(rc));
+        return 1;
+    }
+
+    printf("\n| Element | Part | Ideal        | Standard                 | Error    |\n");
+    printf("|---------|------|--------------|--------------------------|----------|\n");
+    for (int i = 0; i < n; i++) {
+        const afc_part *p[2] = { &parts[i].C, &parts[i].L };
+        const double ideal[2] = { el[i].C, el[i].L };
+        for (int k = 0; k < 2; k++) {
+            char a[32], b[80];
+            const char *unit = k ? "H" : "F";
+            if (!(p[k]->value > 0))
+                continue;
+            printf("|   %2d    |  %s   | %-12s | %-24s | %+7.2f%% |\n", i + 1, k ? "L" : "C",
+                   si(ideal[k], unit, a, sizeof a), describe(p[k], unit, b, sizeof b),
+                   100 * (p[k]->value / ideal[k] - 1));
+        }
+    }
+
+    printf("\nE%d%s: loss deviation %.3f dB rms, %.3f dB max (nearest values: %.3f dB rms, %.3f dB max)\n",
+           cfg.series, cfg.pairs ? " with pairs" : "", res.rms_dB, res.max_dB,
+           res.nearest_rms_dB, res.nearest_max_dB);
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    fprintf(stderr, "Searched %ld nodes in %.3f s (%d threads)%s\n", res.nodes, secs, cfg.threads,
+            res.complete ? "" : ", budget reached: best found so far");
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Filter Step Response
+ * Designs filters from CSV spec records (see afc_spec.h) and reports the
+ * time-domain figures of each: 50 % delay, 10-90 % rise time, overshoot,
+ * undershoot, ringing and settling time. BP and BR designs are measured
+ * on the envelope of a carrier at the centre frequency (see afc_time.h).
+ * With -o the step and impulse response of the first spec are written as
+ * CSV, streamed a block at a time.
+ *
+ * Usage: filter_step [-tol pct] [-T seconds] [-max points] [-j threads]
+ *                    [-o file] "spec" ["spec" ...]
+ *   -tol  settling band in percent of the final value (default 1)
+ *   -T    record length (default: until the response has decayed)
+ *   -max  transform length cap (default 4194304)
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "afc.h"
+#include "afc_spec.h"
+#include "afc_time.h"
+
+#define MAX_SPECS 64
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_step [-tol pct] [-T seconds] [-max points] [-j threads]\n"
+                    "                   [-o file] \"spec\" [\"spec\" ...]\n");
+}
+
+static void write_block(void *ctx, double t0, double dt, const double *step,
+                        const double *impulse, long count) {
+    FILE *out = ctx;
+    for (long i = 0; i < count; i++)
+        fprintf(out, "%.6g,%.6g,%.6g\n", t0 + i * dt, step[i], impulse[i]);
+}
+
+// Seconds in engineering units, "-" for NaN.
+static void print_time(double t) {
+    static const struct { double scale; const char *unit; } units[] = {
+        { 1, "s" }, { 1e-3, "ms" }, { 1e-6, "us" }, { 1e-9, "ns" }, { 1e-12, "ps" }
+    };
+    if (isnan(t)) {
+        printf(" %12s |", "-");
+        return;
+    }
+    int u = 0;
+    while (u < 4 && fabs(t) < units[u].scale)
+        u++;
+    printf(" %9.4g %-2s |", t / units[u].scale, units[u].unit);
+}
+
+static void print_pct(double p) {
+    if (isnan(p))
+        printf(" %9s |", "-");
+    else
+        printf(" %9.3f |", p);
+}
+
+int main(int argc, char **argv) {
+    afc_step_config cfg = { 0 };
+    const char *specs[MAX_SPECS], *outPath = NULL;
+    int nspecs = 0;
+
+    for (int a = 1; a < argc; a++) {
+        int more = a + 1 < argc;
+        if (!strcmp(argv[a], "-tol") && more)
+            cfg.settle_tol = atof(argv[++a]) / 100;
+        else if (!strcmp(argv[a], "-T") && more)
+            cfg.duration = atof(argv[++a]);
+        else if (!strcmp(argv[a], "-max") && more)
+            cfg.max_points = atol(argv[++a]);
+        else if (!strcmp(argv[a], "-j") && more)
+            cfg.threads = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "-o") && more)
+            outPath = argv[++a];
+        else if (argv[a][0] != '-' && nspecs < MAX_SPECS)
+            specs[nspecs++] = argv[a];
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (nspecs == 0 || cfg.settle_tol < 0 || cfg.duration < 0) {
+        usage();
+        return 1;
+    }
+
+    FILE *out = NULL;
+    if (outPath) {
+        out = strcmp(outPath, "-") ? fopen(outPath, "w") : stdout;
+        if (!out) {
+            perror("filter_step");
+            return 1;
+        }
+        fprintf(out, "t_s,step,impulse_per_s\n");
+    }
+
+    int status = 0;
+    if (out != stdout) {
+        printf("| %-36s | %-8s | %-12s | %-12s | Overshoot | Undershoot | Ringing | %-12s |\n",
+               "Spec", "Final", "Delay", "Rise", "Settling");
+        printf("|--------------------------------------|----------|--------------|--------------|"
+               "-----------|------------|---------|--------------|\n");
+    }
+    for (int i = 0; i < nspecs; i++) {
+        afc_spec spec;
+        afc_element el[AFC_MAX_ORDER];
+        afc_step_metrics m;
+        char *record = strdup(specs[i]);
+        const char *err = record ? afc_spec_from_csv(record, &spec) : "out of memory";
+        int n = 0, rc;
+        if (!err && (n = afc_design(&spec, el, AFC_MAX_ORDER)) < 0)
+            err = afc_strerror(n);
+        free(record);
+
+        cfg.sink = i == 0 && out ? write_block : NULL;
+        cfg.ctx = out;
+        if (!err && (rc = afc_step_response(&spec, el, n, &cfg, &m)) != AFC_OK)
+            err = afc_strerror(rc);
+        if (err) {
+            fprintf(stderr, "filter_step: %s: %s\n", specs[i], err);
+            status = 1;
+            continue;
+        }
+        if (out == stdout)
+            continue;
+        printf("| %-36.36s | %8.4f |", specs[i], m.final);
+        print_time(m.delay);
+        print_time(m.rise_time);
+        print_pct(m.overshoot_pct);
+        printf(" ");
+        print_pct(m.undershoot_pct);
+        printf(" %7d |", m.ringing);
+        print_time(m.settling_time);
+        printf("%s%s\n", m.envelope ? " envelope" : "", m.truncated ? " (not settled in record)" : "");
+    }
+    if (out && out != stdout)
+        fclose(out);
+    return status;
+}
@@ -0,0 +1,372 @@
+/*
+ * Design Space Sweep
+ * Expands a grid of family x order x ripple x stop-band loss x topology x
+ * frequency (ripple for Chebyshev and elliptic, loss for elliptic), designs
+ * every point in parallel and writes the element values and figures of
+ * merit (rejection at an offset, group-delay flatness, total inductance)
+ * to a columnar sweep file (format in afc_sweep.h). Workers store straight
+ * into the memory-mapped file, so nothing is buffered however big it gets.
+ *
+ * Usage: filter_sweep [options] output.afcs
+ *   -type lp|hp|bp|br       filter type (default lp)
+ *   -family f1,f2,...       butterworth, chebyshev, bessel, elliptic
+ *                           (default all but elliptic)
+ *   -order a:b | n1,n2,...  orders (default 2:10)
+ *   -ripple r1,r2,...       Chebyshev and elliptic ripples in dB (default 0.1)
+ *   -stop s1,s2,...         elliptic stop-band losses in dB (default 60)
+ *   -topology pi,tee        topologies (default both)
+ *   -freq a:b:n | f1,...    frequencies, a:b:n is log spaced; values may
+ *                           carry suffixes, e.g. 1M:10M:3 (default 1e6)
+ *   -bw Hz                  bandwidth for BP/BR
+ *   -R ohm                  impedance (default 50)
+ *   -offset ratio           rejection point (default 2, see afc_sweep.h)
+ *   -j threads              worker threads (default all cores)
+ *        filter_sweep -dump file.afcs [rows]
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+
+#include "afc.h"
+#include "afc_parallel.h"
+#include "afc_spec.h"
+#include "afc_sweep.h"
+
+#define MAX_LIST   4096
+#define SWEEP_CHUNK 1024
+
+typedef struct {
+    double v[MAX_LIST];
+    int n;
+} value_list;
+
+enum {
+    COL_FAMILY, COL_TYPE, COL_ORDER, COL_TOPOLOGY, COL_STATUS,
+    COL_RIPPLE, COL_STOP, COL_FREQ, COL_BW, COL_R, COL_LOAD,
+    COL_REJECTION, COL_GD_RIPPLE, COL_TOTAL_L,
+    COL_G, COL_C, COL_L, NCOLS
+};
+
+typedef struct {
+    afc_type type;
+    value_list family, order, ripple, stop, topology, freq;
+    double bw, R, offset;
+    int width;                 // most elements of any design
+    long family_rows[5];       // rows before each family index
+    void *col[NCOLS];
+} sweep_grid;
+
+/* ---------------------------------------------------------------------- */
+/* Grid                                                                   */
+/* ---------------------------------------------------------------------- */
+
+// "a:b" (integer range), "a:b:n" (log range) or a comma list; names are
+// resolved with lookup when given.
+static int parse_list(const char *arg, value_list *l, int (*lookup)(const char *)) {
+    char buf[1024], *save = NULL;
+    l->n = 0;
+    if (snprintf(buf, sizeof buf, "%s", arg) >= (int)sizeof buf)
+        return 0;
+    if (!lookup && strchr(buf, ':')) {
+        // endpoints take suffixes like the list items: 1M:10M:3
+        double v[3];
+        int nv = 0;
+        for (char *t = buf, *colon; t; t = colon ? colon + 1 : NULL) {
+            if ((colon = strchr(t, ':')))
+                *colon = '\0';
+            if (nv == 3 || !afc_parse_number(t, NAN, &v[nv]) || !isfinite(v[nv]))
+                return 0;
+            nv++;
+        }
+        double a = v[0], b = v[1], n = v[2];
+        if (nv == 3) {
+            if (!(a > 0) || !(b >= a) || n < 1 || n > MAX_LIST || n != floor(n))
+                return 0;
+            for (int i = 0; i < (int)n; i++)
+                l->v[l->n++] = n > 1 ? a * pow(b / a, i / (n - 1)) : a;
+            return 1;
+        }
+        if (nv != 2 || a != floor(a) || b != floor(b) || !(a > 0) || b < a || b - a >= MAX_LIST ||
+            b > INT_MAX)
+            return 0;
+        for (int i = (int)a; i <= (int)b; i++)
+            l->v[l->n++] = i;
+        return 1;
+    }
+    for (char *t = strtok_r(buf, ",", &save); t; t = strtok_r(NULL, ",", &save)) {
+        double v;
+        if (l->n == MAX_LIST)
+            return 0;
+        if (lookup)
+            v = lookup(afc_trim(t));
+        else if (!afc_parse_number(t, NAN, &v))
+            return 0;
+        if (!(v > 0))
+            return 0;
+        l->v[l->n++] = v;
+    }
+    return l->n > 0;
+}
+
+// Orders are whole numbers that fit an int; ones above AFC_MAX_ORDER stay
+// in the grid and come out as error rows.
+static int parse_orders(const char *arg, value_list *l) {
+    if (!parse_list(arg, l, NULL))
+        return 0;
+    for (int i = 0; i < l->n; i++)
+        if (!isfinite(l->v[i]) || l->v[i] != floor(l->v[i]) || l->v[i] > INT_MAX)
+            return 0;
+    return 1;
+}
+
+static int family_lookup(const char *s)   { return afc_family_from_name(s); }
+static int topology_lookup(const char *s) { return afc_topology_from_name(s); }
+
+static long rows_for(const sweep_grid *g, int f) {
+    int family = (int)g->family.v[f];
+    int ripples = family == AFC_CHEBYSHEV || family == AFC_ELLIPTIC ? g->ripple.n : 1;
+    int stops = family == AFC_ELLIPTIC ? g->stop.n : 1;
+    return (long)g->order.n * ripples * stops * g->topology.n * g->freq.n;
+}
+
+// Decode row index r into a spec.
+static void row_spec(const sweep_grid *g, long r, afc_spec *s) {
+    int f = 0;
+    while (f + 1 < g->family.n && r >= g->family_rows[f + 1])
+        f++;
+    r -= g->family_rows[f];
+
+    memset(s, 0, sizeof *s);
+    s->family = (afc_family)g->family.v[f];
+    s->type = g->type;
+    s->bw = g->bw;
+    s->R = g->R;
+    s->freq = g->freq.v[r % g->freq.n];
+    r /= g->freq.n;
+    s->topology = (afc_topology)g->topology.v[r % g->topology.n];
+    r /= g->topology.n;
+    if (s->family == AFC_ELLIPTIC) {
+        s->stop_dB = g->stop.v[r % g->stop.n];
+        r /= g->stop.n;
+    }
+    if (s->family == AFC_CHEBYSHEV || s->family == AFC_ELLIPTIC) {
+        s->ripple_dB = g->ripple.v[r % g->ripple.n];
+        r /= g->ripple.n;
+    }
+    s->order = (int)g->order.v[r];
+}
+
+/* ---------------------------------------------------------------------- */
+/* Evaluation                                                             */
+/* ---------------------------------------------------------------------- */
+
+static void sweep_rows(void *ctx, long begin, long end, int tid) {
+    sweep_grid *g = ctx;
+    int32_t **ic = (int32_t **)g->col;
+    double **dc = (double **)g->col;
+    (void)tid;
+
+    // frequency is the fastest axis, so most rows rescale the one before
+    afc_spec prev;
+    afc_element prevEl[AFC_MAX_ORDER];
+    int prevN = 0;
+
+    for (long r = begin; r < end; r++) {
+        afc_spec s;
+        afc_element el[AFC_MAX_ORDER];
+        afc_metrics m = { NAN, NAN, NAN };
+        row_spec(g, r, &s);
+
+        int n = prevN > 0 ? afc_rescale(&prev, prevEl, prevN, &s, el, g->width) : -1;
+        if (n < 0)
+            n = afc_design(&s, el, g->width);
+        if ((prevN = n) > 0) {
+            prev = s;
+            memcpy(prevEl, el, (size_t)n * sizeof *el);
+        }
+        int status = n < 0 ? n : afc_design_metrics(&s, el, n, g->offset, &m);
+
+        ic[COL_FAMILY][r] = s.family;
+        ic[COL_TYPE][r] = s.type;
+        ic[COL_ORDER][r] = s.order;
+        ic[COL_TOPOLOGY][r] = s.topology;
+        ic[COL_STATUS][r] = status;
+        dc[COL_RIPPLE][r] = s.ripple_dB;
+        dc[COL_STOP][r] = s.stop_dB;
+        dc[COL_FREQ][r] = s.freq;
+        dc[COL_BW][r] = s.bw;
+        dc[COL_R][r] = s.R;
+        dc[COL_LOAD][r] = afc_load_impedance(&s);
+        dc[COL_REJECTION][r] = m.rejection_dB;
+        dc[COL_GD_RIPPLE][r] = m.gd_ripple;
+        dc[COL_TOTAL_L][r] = m.total_L;
+        // the mapping starts zeroed, so only the design's own slots are set
+        for (int i = 0; i < n; i++) {
+            dc[COL_G][r * g->width + i] = el[i].g;
+            dc[COL_C][r * g->width + i] = el[i].C;
+            dc[COL_L][r * g->width + i] = el[i].L;
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* Dump                                                                   */
+/* ---------------------------------------------------------------------- */
+
+static int dump(const char *path, long limit) {
+    afc_sweep_file f;
+    int rc = afc_sweep_open(path, &f);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_sweep: %s: %s\n", path, afc_strerror(rc));
+        return 1;
+    }
+    printf("# %llu rows, %d columns\n", (unsigned long long)f.rows, f.ncolumns);
+    for (int c = 0; c < f.ncolumns; c++)
+        printf("# %-12s %s x %u at %llu\n", f.columns[c].name,
+               f.columns[c].type == AFC_COL_I32 ? "i32" : "f64", f.columns[c].width,
+               (unsigned long long)f.columns[c].offset);
+
+    for (int c = 0; c < f.ncolumns; c++)
+        printf("%s%s", c ? "," : "", f.columns[c].name);
+    printf("\n");
+    for (uint64_t r = 0; r < f.rows && (long)r < limit; r++) {
+        for (int c = 0; c < f.ncolumns; c++) {
+            const afc_sweep_column *col = &f.columns[c];
+            const void *d = afc_sweep_data(&f, col);
+            printf("%s", c ? "," : "");
+            for (uint32_t w = 0; w < col->width; w++) {
+                if (col->type == AFC_COL_I32)
+                    printf("%s%d", w ? " " : "", ((const int32_t *)d)[r * col->width + w]);
+                else
+                    printf("%s%.6g", w ? " " : "", ((const double *)d)[r * col->width + w]);
+            }
+        }
+        printf("\n");
+    }
+    afc_sweep_close(&f);
+    return 0;
+}
+
+static void usage(void) {
+    fprintf(stderr, "Usage: filter_sweep [-type lp|hp|bp|br] [-family list] [-order a:b|list] [-ripple list]\n"
+                    "                    [-stop list] [-topology list] [-freq a:b:n|list] [-bw Hz] [-R ohm]\n"
+                    "                    [-offset ratio] [-j threads] output.afcs\n"
+                    "       filter_sweep -dump file.afcs [rows]\n");
+}
+
+int main(int argc, char **argv) {
+    sweep_grid g = { .type = AFC_LOWPASS, .R = 50, .offset = 2 };
+    const char *outPath = NULL;
+    int threads = 0, ok = 1;
+
+    if (argc >= 3 && !strcmp(argv[1], "-dump"))
+        return dump(argv[2], argc > 3 ? atol(argv[3]) : 10);
+
+    parse_list("butterworth,chebyshev,bessel", &g.family, family_lookup);
+    parse_orders("2:10", &g.order);
+    parse_list("0.1", &g.ripple, NULL);
+    parse_list("60", &g.stop, NULL);
+    parse_list("pi,tee", &g.topology, topology_lookup);
+    parse_list("1e6", &g.freq, NULL);
+
+    for (int a = 1; a < argc && ok; a++) {
+        const char *o = argv[a];
+        int more = a + 1 < argc;
+        if (!strcmp(o, "-type") && more)
+            ok = (g.type = afc_type_from_name(argv[++a])) != 0;
+        else if (!strcmp(o, "-family") && more)
+            ok = parse_list(argv[++a], &g.family, family_lookup);
+        else if (!strcmp(o, "-order") && more)
+            ok = parse_orders(argv[++a], &g.order);
+        else if (!strcmp(o, "-ripple") && more)
+            ok = parse_list(argv[++a], &g.ripple, NULL);
+        else if (!strcmp(o, "-stop") && more)
+            ok = parse_list(argv[++a], &g.stop, NULL);
+        else if (!strcmp(o, "-topology") && more)
+            ok = parse_list(argv[++a], &g.topology, topology_lookup);
+        else if (!strcmp(o, "-freq") && more)
+            ok = parse_list(argv[++a], &g.freq, NULL);
+        else if (!strcmp(o, "-bw") && more)
+            ok = afc_parse_number(argv[++a], 0, &g.bw);
+        else if (!strcmp(o, "-R") && more)
+            ok = afc_parse_number(argv[++a], 0, &g.R);
+        else if (!strcmp(o, "-offset") && more)
+            ok = afc_parse_number(argv[++a], 0, &g.offset) && g.offset > 0;
+        else if (!strcmp(o, "-j") && more)
+            threads = atoi(argv[++a]);
+        else if (!outPath && o[0] != '-')
+            outPath = o;
+        else
+            ok = 0;
+    }
+    if (!ok || !outPath || g.family.n > 5) {
+        usage();
+        return 1;
+    }
+    threads = afc_thread_count(threads);
+
+    long rows = 0;
+    for (int f = 0; f < g.family.n; f++) {
+        g.family_rows[f] = rows;
+        rows += rows_for(&g, f);
+    }
+    g.width = 1;
+    for (int i = 0; i < g.order.n; i++)
+        if (g.order.v[i] > g.width && g.order.v[i] <= AFC_MAX_ORDER)
+            g.width = (int)g.order.v[i];
+    // elliptic BP/BR tanks split into two resonators each
+    for (int f = 0; f < g.family.n; f++)
+        if (g.family.v[f] == AFC_ELLIPTIC && (g.type == AFC_BANDPASS || g.type == AFC_BANDREJECT))
+            g.width = (int)fmin(AFC_MAX_ORDER, g.width + (g.width - 1) / 2);
+
+    const afc_sweep_layout layout[NCOLS] = {
+        [COL_FAMILY]    = { "family", AFC_COL_I32, 1 },
+        [COL_TYPE]      = { "type", AFC_COL_I32, 1 },
+        [COL_ORDER]     = { "order", AFC_COL_I32, 1 },
+        [COL_TOPOLOGY]  = { "topology", AFC_COL_I32, 1 },
+        [COL_STATUS]    = { "status", AFC_COL_I32, 1 },
+        [COL_RIPPLE]    = { "ripple_dB", AFC_COL_F64, 1 },
+        [COL_STOP]      = { "stop_dB", AFC_COL_F64, 1 },
+        [COL_FREQ]      = { "freq_Hz", AFC_COL_F64, 1 },
+        [COL_BW]        = { "bw_Hz", AFC_COL_F64, 1 },
+        [COL_R]         = { "R_ohm", AFC_COL_F64, 1 },
+        [COL_LOAD]      = { "load_ohm", AFC_COL_F64, 1 },
+        [COL_REJECTION] = { "rejection_dB", AFC_COL_F64, 1 },
+        [COL_GD_RIPPLE] = { "gd_ripple", AFC_COL_F64, 1 },
+        [COL_TOTAL_L]   = { "total_L_H", AFC_COL_F64, 1 },
+        [COL_G]         = { "g", AFC_COL_F64, (uint32_t)g.width },
+        [COL_C]         = { "C_F", AFC_COL_F64, (uint32_t)g.width },
+        [COL_L]         = { "L_H", AFC_COL_F64, (uint32_t)g.width },
+    };
+
+    afc_sweep_file f;
+    int rc = afc_sweep_create(outPath, layout, NCOLS, (uint64_t)rows, &f);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_sweep: %s: %s\n", outPath, afc_strerror(rc));
+        return 1;
+    }
+    for (int c = 0; c < NCOLS; c++)
+        g.col[c] = afc_sweep_data(&f, &f.columns[c]);
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    afc_parallel_for(rows, SWEEP_CHUNK, threads, sweep_rows, &g);
+    rc = afc_sweep_close(&f);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (rc != AFC_OK) {
+        fprintf(stderr, "filter_sweep: %s: %s\n", outPath, afc_strerror(rc));
+        return 1;
+    }
+
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    fprintf(stderr, "Swept %ld designs in %.3f s (%.0f designs/s, %d threads), %.1f MB\n",
+            rows, secs, secs > 0 ? rows / secs : 0.0, threads, f.size / 1e6);
+    return 0;
+}
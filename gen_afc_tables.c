@@ -0,0 +1,110 @@
+/*
+ * Analog Filter Calculator - prototype table generator
+ * Writes afc_tables.h, the precomputed prototypes compiled into afc.c:
+ * Butterworth and Chebyshev (common ripples) up to PROTO_TABLE_ORDER from
+ * afc_proto.c, Bessel up to BESSEL_TABLE_ORDER from afc_bessel.c. Run it
+ * whenever the synthesis code or the table limits change:
+ *
+ *   gcc -O2 -DAFC_BESSEL_QUAD gen_afc_tables.c afc_proto.c afc_bessel.c -o gen_afc_tables -lquadmath -lm
+ *   ./gen_afc_tables > afc_tables.h
+ *
+ * Author: kheng choong
+ * Date: 2026-10-16
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+
+#include "afc.h"
+
+#define PROTO_TABLE_ORDER  32
+#define BESSEL_TABLE_ORDER 32
+
+// Chebyshev ripples with precomputed prototypes (dB)
+static const double cheb_ripples[] = { 0.01, 0.05, 0.1, 0.2, 0.25, 0.5, 1, 2, 3 };
+#define CHEB_RIPPLES ((int)(sizeof cheb_ripples / sizeof cheb_ripples[0]))
+
+// One table row: g[0..n] with g(n+1) last, four values per line.
+static void print_row(int n, const double *g, const char *indent) {
+    printf("%s{ // order %d\n%s   ", indent, n, indent);
+    for (int i = 0; i <= n; i++) {
+        printf(" %.17g,", g[i]);
+        if (i % 4 == 3 && i < n)
+            printf("\n%s   ", indent);
+    }
+    printf("\n%s},\n", indent);
+}
+
+int main() {
+    double g[PROTO_TABLE_ORDER + 1][PROTO_TABLE_ORDER + 1] = {{0}};
+    double bg[BESSEL_TABLE_ORDER + 1][BESSEL_TABLE_ORDER + 1] = {{0}};
+    double f3db[PROTO_TABLE_ORDER + 1];
+    double w3db[BESSEL_TABLE_ORDER + 1];
+
+    for (int n = 1; n <= BESSEL_TABLE_ORDER; n++) {
+        if (afc_bessel_synthesize(n, bg[n], &w3db[n]) != AFC_OK) {
+            fprintf(stderr, "gen_afc_tables: Bessel order %d failed, build with -DAFC_BESSEL_QUAD\n", n);
+            return 1;
+        }
+    }
+
+    printf("/*\n");
+    printf(" * Analog Filter Calculator - precomputed prototype tables\n");
+    printf(" * Generated by gen_afc_tables.c, do not edit.\n");
+    printf(" */\n\n");
+    printf("#ifndef AFC_TABLES_H\n#define AFC_TABLES_H\n\n");
+    printf("#define AFC_PROTO_TABLE_ORDER %d\n", PROTO_TABLE_ORDER);
+    printf("#define AFC_CHEBYSHEV_TABLE_RIPPLES %d\n", CHEB_RIPPLES);
+    printf("#define AFC_BESSEL_TABLE_ORDER %d\n\n", BESSEL_TABLE_ORDER);
+
+    printf("// Butterworth ladder g-values, g[n-1][0..n] (g(n+1) last)\n");
+    printf("static const double afc_butterworth_g[%d][%d] = {\n", PROTO_TABLE_ORDER, PROTO_TABLE_ORDER + 1);
+    for (int n = 1; n <= PROTO_TABLE_ORDER; n++) {
+        afc_butterworth_synthesize(n, g[n]);
+        print_row(n, g[n], "    ");
+    }
+    printf("};\n\n");
+
+    printf("// Chebyshev ripples (dB) with tables below\n");
+    printf("static const double afc_chebyshev_ripple[%d] = {", CHEB_RIPPLES);
+    for (int r = 0; r < CHEB_RIPPLES; r++)
+        printf(" %.17g,", cheb_ripples[r]);
+    printf(" };\n\n");
+
+    printf("// Chebyshev ladder g-values normalized to the ripple band edge,\n");
+    printf("// g[ripple][n-1][0..n] (g(n+1) last), and the -3 dB frequency\n");
+    printf("static const double afc_chebyshev_g[%d][%d][%d] = {\n", CHEB_RIPPLES, PROTO_TABLE_ORDER,
+           PROTO_TABLE_ORDER + 1);
+    double cf3db[CHEB_RIPPLES][PROTO_TABLE_ORDER + 1];
+    for (int r = 0; r < CHEB_RIPPLES; r++) {
+        printf("    { // %g dB\n", cheb_ripples[r]);
+        for (int n = 1; n <= PROTO_TABLE_ORDER; n++) {
+            afc_chebyshev_synthesize(n, cheb_ripples[r], g[n], &f3db[n]);
+            cf3db[r][n] = f3db[n];
+            print_row(n, g[n], "        ");
+        }
+        printf("    },\n");
+    }
+    printf("};\n\n");
+    printf("static const double afc_chebyshev_f3db[%d][%d] = {\n", CHEB_RIPPLES, PROTO_TABLE_ORDER);
+    for (int r = 0; r < CHEB_RIPPLES; r++) {
+        printf("    { // %g dB\n       ", cheb_ripples[r]);
+        for (int n = 1; n <= PROTO_TABLE_ORDER; n++)
+            printf(" %.17g,%s", cf3db[r][n], (n % 4 == 0 && n < PROTO_TABLE_ORDER) ? "\n       " : "");
+        printf("\n    },\n");
+    }
+    printf("};\n\n");
+
+    printf("// Bessel ladder g-values normalized to unit group delay, g[n-1][0..n] (g(n+1) last)\n");
+    printf("static const double afc_bessel_delay_g[%d][%d] = {\n", BESSEL_TABLE_ORDER, BESSEL_TABLE_ORDER + 1);
+    for (int n = 1; n <= BESSEL_TABLE_ORDER; n++)
+        print_row(n, bg[n], "    ");
+    printf("};\n\n");
+
+    printf("// -3 dB frequency of the unit-delay Bessel prototype\n");
+    printf("static const double afc_bessel_w3db[%d] = {\n", BESSEL_TABLE_ORDER);
+    for (int n = 1; n <= BESSEL_TABLE_ORDER; n++)
+        printf("    %.17g,%s", w3db[n], "\n");
+    printf("};\n\n#endif\n");
+    return 0;
+}